@@ -0,0 +1,45 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+
+//----------------------------------------------------------------------------------
+// Minimal benchmark helpers shared by the bench/*.cpp programs
+//----------------------------------------------------------------------------------
+
+// Keep the optimizer from discarding a computed value
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r"(&value) : "memory");
+#else
+    static volatile char sink;
+    sink = *(const volatile char*)&value;
+#endif
+}
+
+// Seconds since an arbitrary epoch (monotonic)
+inline double BenchTime(void)
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Run fn() repeatedly for at least minSeconds and return the best time of one call in seconds
+template <typename Fn>
+inline double BenchBest(Fn&& fn, double minSeconds = 0.2)
+{
+    fn();   // Warm-up: page in buffers, fill caches
+
+    double best = 1e30;
+    double start = BenchTime();
+    do
+    {
+        double t0 = BenchTime();
+        fn();
+        double t1 = BenchTime();
+        if (t1 - t0 < best) best = t1 - t0;
+    } while (BenchTime() - start < minSeconds);
+
+    return best;
+}
@@ -0,0 +1,375 @@
+// Benchmark and validation of the dynamic AABB tree (src/AabbTree.h)
+// Level walls from 8 to 1024 px next to 20k bullets of 2-6 px, 5% of the bullets die and
+// respawn every frame. Per frame: the tree (moves + churn + pairs), the walls in a static tree
+// of their own, the spatial grid rebuilt with small and large cells, and brute force
+// CheckCollisionRecs on every pair. Then rectangle, point and ray queries against a scan, and
+// the height after sorted inserts
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc /Iinclude bench\BenchAabbTree.cpp
+#include "AabbTree.h"
+#include "SpatialGrid.h"
+#include "RaylibReference.h"
+#include "Bench.h"
+#include <algorithm>
+#include <vector>
+
+static const float WORLD_SIZE = 4096.0f;
+static const int WALL_COUNT = 1000;
+static const int BULLET_COUNT = 20000;
+static const int CHURN_COUNT = BULLET_COUNT/20;
+static const int FRAME_COUNT = 60;
+static const int CHECK_EVERY = 20;              // Frames between brute force checks
+static const float MARGIN = 2.0f;
+static const int QUERY_COUNT = 1000;
+static const int SORTED_COUNT = 100000;
+
+struct Scene {
+    std::vector<Rectangle> recs;                // Walls first, then bullets
+    std::vector<Vector2> velocities;
+    std::vector<int> proxies;                   // Proxy of each object in the single tree
+    std::vector<int> split;                     // Proxy in the wall tree or the bullet tree
+};
+
+static Rectangle RandomWall()
+{
+    // Log-uniform sizes: many small walls, a few huge ones
+    float width = 8.0f*powf(128.0f, Random(0.0f, 1.0f));
+    float height = 8.0f*powf(128.0f, Random(0.0f, 1.0f));
+    return Rectangle{ Random(0.0f, WORLD_SIZE - width), Random(0.0f, WORLD_SIZE - height), width, height };
+}
+
+static void SpawnBullet(Scene* scene, int i)
+{
+    float size = Random(2.0f, 6.0f);
+    float angle = Random(0.0f, 2.0f*PI), speed = Random(100.0f, 500.0f);
+    scene->recs[i] = Rectangle{ Random(0.0f, WORLD_SIZE), Random(0.0f, WORLD_SIZE), size, size };
+    scene->velocities[i] = Vector2{ cosf(angle)*speed, sinf(angle)*speed };
+}
+
+static void BruteForcePairs(const std::vector<Rectangle>& recs, std::vector<AabbPair>* pairs)
+{
+    pairs->clear();
+    for (int i = 0; i < (int)recs.size(); i++)
+    {
+        for (int j = i + 1; j < (int)recs.size(); j++) if (ref::CheckCollisionRecs(recs[i], recs[j])) pairs->push_back(AabbPair{ i, j });
+    }
+}
+
+static bool SamePairs(std::vector<AabbPair> a, std::vector<AabbPair> b)
+{
+    auto less = [](AabbPair x, AabbPair y) { return (x.a < y.a) || (x.a == y.a && x.b < y.b); };
+    std::sort(a.begin(), a.end(), less);
+    std::sort(b.begin(), b.end(), less);
+
+    return (a.size() == b.size()) && std::equal(a.begin(), a.end(), b.begin(), [](AabbPair x, AabbPair y) { return x.a == y.a && x.b == y.b; });
+}
+
+static bool SameSet(std::vector<int> a, std::vector<int> b)
+{
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+
+    return a == b;
+}
+
+// Fraction along start + delta*t where the segment enters 'rec', -1 when it misses
+static float SegmentRecFraction(Vector2 start, Vector2 delta, Rectangle rec)
+{
+    float tMin = 0.0f, tMax = 1.0f;
+    const float origin[2] = { start.x, start.y }, direction[2] = { delta.x, delta.y };
+    const float low[2] = { rec.x, rec.y }, high[2] = { rec.x + rec.width, rec.y + rec.height };
+    for (int axis = 0; axis < 2; axis++)
+    {
+        if (direction[axis] == 0.0f)
+        {
+            if ((origin[axis] < low[axis]) || (origin[axis] > high[axis])) return -1.0f;
+            continue;
+        }
+
+        float t1 = (low[axis] - origin[axis])/direction[axis];
+        float t2 = (high[axis] - origin[axis])/direction[axis];
+        tMin = fmaxf(tMin, fminf(t1, t2));
+        tMax = fminf(tMax, fmaxf(t1, t2));
+        if (tMin > tMax) return -1.0f;
+    }
+
+    return tMin;
+}
+
+int main()
+{
+    bool ok = true;
+    SeedRandom(1005);
+    const float dt = 1.0f/60.0f;
+
+    Scene scene;
+    scene.recs.resize(WALL_COUNT + BULLET_COUNT);
+    scene.velocities.resize(WALL_COUNT + BULLET_COUNT, Vector2{ 0.0f, 0.0f });
+    scene.proxies.resize(WALL_COUNT + BULLET_COUNT);
+    scene.split.resize(WALL_COUNT + BULLET_COUNT);
+    for (int i = 0; i < WALL_COUNT; i++) scene.recs[i] = RandomWall();
+    for (int i = WALL_COUNT; i < WALL_COUNT + BULLET_COUNT; i++) SpawnBullet(&scene, i);
+
+    AabbTree tree = CreateAabbTree(MARGIN);
+    for (int i = 0; i < (int)scene.recs.size(); i++) scene.proxies[i] = CreateAabbProxy(&tree, AabbBoxFromRec(scene.recs[i]), i);
+    std::vector<AabbPair> treePairs, movedPairs, pairs, reference;
+    FindAabbTreeMovedPairs(&tree, &movedPairs);
+
+    // The same objects with the walls in a static tree of their own, their pairs found once
+    AabbTree wallTree = CreateAabbTree(0.0f);
+    AabbTree bulletTree = CreateAabbTree(MARGIN);
+    for (int i = 0; i < WALL_COUNT; i++) scene.split[i] = CreateAabbProxy(&wallTree, AabbBoxFromRec(scene.recs[i]), i);
+    for (int i = WALL_COUNT; i < (int)scene.recs.size(); i++) scene.split[i] = CreateAabbProxy(&bulletTree, AabbBoxFromRec(scene.recs[i]), i);
+    std::vector<AabbPair> wallPairs, splitPairs;
+    FindAabbTreePairs(&wallTree, &treePairs);
+    for (AabbPair pair : treePairs)
+    {
+        int a = GetAabbProxyData(&wallTree, pair.a), b = GetAabbProxyData(&wallTree, pair.b);
+        if (ref::CheckCollisionRecs(scene.recs[a], scene.recs[b])) wallPairs.push_back((a < b) ? AabbPair{ a, b } : AabbPair{ b, a });
+    }
+
+    SpatialGrid smallGrid = CreateSpatialGrid(16.0f, 0);
+    SpatialGrid largeGrid = CreateSpatialGrid(256.0f, 0);
+    std::vector<GridPair> gridCandidates;
+
+    printf("AABB tree, %d walls of 8-1024 px, %d bullets of 2-6 px, %d respawns per frame, %d frames\n\n", WALL_COUNT, BULLET_COUNT, CHURN_COUNT, FRAME_COUNT);
+
+    double splitTime = 0.0, moveTime = 0.0, churnTime = 0.0, allPairsTime = 0.0, movedPairsTime = 0.0, smallGridTime = 0.0, largeGridTime = 0.0, bruteTime = 0.0;
+    long long reinserted = 0, movedPairCount = 0, pairCount = 0;
+    int bruteFrames = 0;
+    std::vector<char> wasMoved;
+    std::vector<int> respawned;
+    for (int frame = 0; frame < FRAME_COUNT; frame++)
+    {
+        // Move the bullets, wrapping around the world
+        double t0 = BenchTime();
+        for (int i = WALL_COUNT; i < (int)scene.recs.size(); i++)
+        {
+            Rectangle& rec = scene.recs[i];
+            Vector2 step = scene.velocities[i]*dt;
+            rec.x += step.x;
+            rec.y += step.y;
+            if (rec.x < 0.0f) rec.x += WORLD_SIZE;
+            if (rec.x > WORLD_SIZE) rec.x -= WORLD_SIZE;
+            if (rec.y < 0.0f) rec.y += WORLD_SIZE;
+            if (rec.y > WORLD_SIZE) rec.y -= WORLD_SIZE;
+            reinserted += MoveAabbProxy(&tree, scene.proxies[i], AabbBoxFromRec(rec), step);
+        }
+
+        // Some bullets die, the same number spawn elsewhere
+        double t1 = BenchTime();
+        respawned.clear();
+        for (int k = 0; k < CHURN_COUNT; k++)
+        {
+            int i = WALL_COUNT + (int)(NextRandom(GetThreadRandomState()) % BULLET_COUNT);
+            respawned.push_back(i);
+            DestroyAabbProxy(&tree, scene.proxies[i]);
+            SpawnBullet(&scene, i);
+            scene.proxies[i] = CreateAabbProxy(&tree, AabbBoxFromRec(scene.recs[i]), i);
+        }
+
+        double t2 = BenchTime();
+        wasMoved.assign(tree.nodes.size(), 0);
+        for (int proxy : tree.moved) wasMoved[proxy] = 1;
+        double t3 = BenchTime();
+        movedPairCount += FindAabbTreeMovedPairs(&tree, &movedPairs);
+        double t4 = BenchTime();
+        FindAabbTreePairs(&tree, &treePairs);
+        pairs.clear();
+        for (AabbPair pair : treePairs)
+        {
+            int a = GetAabbProxyData(&tree, pair.a), b = GetAabbProxyData(&tree, pair.b);
+            if (ref::CheckCollisionRecs(scene.recs[a], scene.recs[b])) pairs.push_back((a < b) ? AabbPair{ a, b } : AabbPair{ b, a });
+        }
+        double t5 = BenchTime();
+        pairCount += pairs.size();
+
+        // Two trees: update the bullet tree, then bullets against bullets and against walls
+        double s0 = BenchTime();
+        for (int i = WALL_COUNT; i < (int)scene.recs.size(); i++) MoveAabbProxy(&bulletTree, scene.split[i], AabbBoxFromRec(scene.recs[i]), scene.velocities[i]*dt);
+        for (int i : respawned)
+        {
+            DestroyAabbProxy(&bulletTree, scene.split[i]);
+            scene.split[i] = CreateAabbProxy(&bulletTree, AabbBoxFromRec(scene.recs[i]), i);
+        }
+        splitPairs = wallPairs;
+        for (int t = 0; t < 2; t++)
+        {
+            const AabbTree* other = (t == 0) ? &bulletTree : &wallTree;
+            if (t == 0) FindAabbTreePairs(&bulletTree, &treePairs);
+            else FindAabbTreePairs(&bulletTree, &wallTree, &treePairs);
+            for (AabbPair pair : treePairs)
+            {
+                int a = GetAabbProxyData(&bulletTree, pair.a), b = GetAabbProxyData(other, pair.b);
+                if (ref::CheckCollisionRecs(scene.recs[a], scene.recs[b])) splitPairs.push_back((a < b) ? AabbPair{ a, b } : AabbPair{ b, a });
+            }
+        }
+        splitTime += BenchTime() - s0;
+
+        moveTime += t1 - t0;
+        churnTime += t2 - t1;
+        movedPairsTime += t4 - t3;
+        allPairsTime += t5 - t4;
+
+        // The grid rebuilt from scratch on the same rectangles, same narrowphase
+        int gridPairCount[2] = { 0, 0 };
+        SpatialGrid* grids[2] = { &smallGrid, &largeGrid };
+        for (int g = 0; g < 2; g++)
+        {
+            double g0 = BenchTime();
+            BuildSpatialGridRecs(grids[g], scene.recs.data(), (int)scene.recs.size());
+            FindSpatialGridPairs(grids[g], &gridCandidates);
+            for (GridPair pair : gridCandidates) gridPairCount[g] += ref::CheckCollisionRecs(scene.recs[pair.a], scene.recs[pair.b]);
+            double g1 = BenchTime();
+            if (g == 0) smallGridTime += g1 - g0;
+            else largeGridTime += g1 - g0;
+        }
+        bool pass = (gridPairCount[0] == (int)pairs.size()) && (gridPairCount[1] == (int)pairs.size());
+
+        // Every CHECK_EVERY frames: brute force pairs, the moved pairs and the tree structure
+        if ((frame % CHECK_EVERY) == 0 || (frame == FRAME_COUNT - 1))
+        {
+            double b0 = BenchTime();
+            BruteForcePairs(scene.recs, &reference);
+            bruteTime += BenchTime() - b0;
+            bruteFrames++;
+            pass = pass && SamePairs(pairs, reference) && SamePairs(splitPairs, reference);
+            pass = pass && ValidateAabbTree(&bulletTree) && ValidateAabbTree(&wallTree);
+
+            std::vector<AabbPair> expected;
+            std::vector<int> live;
+            for (int proxy = 0; proxy < (int)tree.nodes.size(); proxy++) if (tree.nodes[proxy].height == 0) live.push_back(proxy);
+            for (size_t i = 0; i < live.size(); i++)
+            {
+                for (size_t j = i + 1; j < live.size(); j++)
+                {
+                    int a = live[i], b = live[j];
+                    if ((wasMoved[a] || wasMoved[b]) && AabbBoxesOverlap(GetAabbProxyBox(&tree, a), GetAabbProxyBox(&tree, b))) expected.push_back(AabbPair{ a, b });
+                }
+            }
+            pass = pass && SamePairs(movedPairs, expected);
+            pass = pass && ValidateAabbTree(&tree) && (tree.proxyCount == (int)scene.recs.size());
+            for (int i = 0; i < (int)scene.recs.size(); i++) pass = pass && AabbBoxContains(GetAabbProxyBox(&tree, scene.proxies[i]), AabbBoxFromRec(scene.recs[i]));
+        }
+        if (!pass) printf("Mismatch in frame %d\n", frame);
+        ok = ok && pass;
+    }
+
+    printf("%-36s %10s\n", "Per frame", "ms");
+    printf("%-36s %10.3f   %.1f%% of bullets reinserted\n", "Tree: move bullets", moveTime*1e3/FRAME_COUNT, 100.0*reinserted/((double)BULLET_COUNT*FRAME_COUNT));
+    printf("%-36s %10.3f\n", "Tree: destroy + create 5%", churnTime*1e3/FRAME_COUNT);
+    printf("%-36s %10.3f   %lld new candidate pairs per frame\n", "Tree: moved pairs", movedPairsTime*1e3/FRAME_COUNT, movedPairCount/FRAME_COUNT);
+    printf("%-36s %10.3f   %lld pairs per frame\n", "Tree: all pairs + narrowphase", allPairsTime*1e3/FRAME_COUNT, pairCount/FRAME_COUNT);
+    printf("%-36s %10.3f\n", "Tree: update + moved pairs", (moveTime + churnTime + movedPairsTime)*1e3/FRAME_COUNT);
+    printf("%-36s %10.3f\n", "Tree: update + all pairs", (moveTime + churnTime + allPairsTime)*1e3/FRAME_COUNT);
+    printf("%-36s %10.3f\n", "Walls in a static tree: update + pairs", splitTime*1e3/FRAME_COUNT);
+    printf("%-36s %10.3f\n", "Grid, 16 px cells (rebuild + pairs)", smallGridTime*1e3/FRAME_COUNT);
+    printf("%-36s %10.3f\n", "Grid, 256 px cells (rebuild + pairs)", largeGridTime*1e3/FRAME_COUNT);
+    printf("%-36s %10.3f\n", "Brute force", bruteTime*1e3/bruteFrames);
+    printf("Tree height %d for %d proxies, %d nodes\n", GetAabbTreeHeight(&tree), tree.proxyCount, (int)tree.nodes.size());
+
+    // Queries against a scan of the fat boxes, rays against the nearest hit of a scan
+    {
+        std::vector<Rectangle> rects(QUERY_COUNT);
+        std::vector<Vector2> points(QUERY_COUNT), ends(QUERY_COUNT);
+        for (int q = 0; q < QUERY_COUNT; q++)
+        {
+            rects[q] = Rectangle{ Random(0.0f, WORLD_SIZE), Random(0.0f, WORLD_SIZE), Random(10.0f, 400.0f), Random(10.0f, 400.0f) };
+            points[q] = Vector2{ Random(0.0f, WORLD_SIZE), Random(0.0f, WORLD_SIZE) };
+            float angle = Random(0.0f, 2.0f*PI), length = Random(100.0f, 2000.0f);
+            ends[q] = points[q] + Vector2{ cosf(angle)*length, sinf(angle)*length };
+        }
+
+        bool pass = true;
+        std::vector<int> found, expected;
+        for (int q = 0; q < QUERY_COUNT; q++)
+        {
+            found.clear();
+            expected.clear();
+            QueryAabbTreeRec(&tree, rects[q], &found);
+            for (int proxy : scene.proxies) if (AabbBoxesOverlap(GetAabbProxyBox(&tree, proxy), AabbBoxFromRec(rects[q]))) expected.push_back(proxy);
+            pass = pass && SameSet(found, expected);
+
+            found.clear();
+            expected.clear();
+            QueryAabbTreePoint(&tree, points[q], &found);
+            AabbBox point = { points[q].x, points[q].y, points[q].x, points[q].y };
+            for (int proxy : scene.proxies) if (AabbBoxesOverlap(GetAabbProxyBox(&tree, proxy), point)) expected.push_back(proxy);
+            pass = pass && SameSet(found, expected);
+        }
+
+        // Closest hit on the objects themselves
+        auto Raycast = [&](int q) {
+            float nearest = 2.0f;
+            Vector2 delta = ends[q] - points[q];
+            RaycastAabbTree(&tree, points[q], ends[q], [&](int proxy, float maxFraction) {
+                float fraction = SegmentRecFraction(points[q], delta, scene.recs[GetAabbProxyData(&tree, proxy)]);
+                if ((fraction < 0.0f) || (fraction >= maxFraction)) return maxFraction;
+                nearest = fraction;
+                return fraction;
+            });
+            return nearest;
+        };
+        for (int q = 0; q < QUERY_COUNT; q++)
+        {
+            float nearest = 2.0f;
+            for (const Rectangle& rec : scene.recs)
+            {
+                float fraction = SegmentRecFraction(points[q], ends[q] - points[q], rec);
+                if ((fraction >= 0.0f) && (fraction < nearest)) nearest = fraction;
+            }
+            pass = pass && (Raycast(q) == nearest);
+        }
+        ok = ok && pass;
+
+        double rectTime = BenchBest([&]() {
+            for (int q = 0; q < QUERY_COUNT; q++) { found.clear(); QueryAabbTreeRec(&tree, rects[q], &found); }
+            DoNotOptimize(found.size());
+        });
+        double pointTime = BenchBest([&]() {
+            for (int q = 0; q < QUERY_COUNT; q++) { found.clear(); QueryAabbTreePoint(&tree, points[q], &found); }
+            DoNotOptimize(found.size());
+        });
+        double rayTime = BenchBest([&]() {
+            float sum = 0.0f;
+            for (int q = 0; q < QUERY_COUNT; q++) sum += Raycast(q);
+            DoNotOptimize(sum);
+        });
+        double scanTime = BenchBest([&]() {
+            float sum = 0.0f;
+            for (int q = 0; q < QUERY_COUNT; q++)
+            {
+                float nearest = 2.0f;
+                for (const Rectangle& rec : scene.recs)
+                {
+                    float fraction = SegmentRecFraction(points[q], ends[q] - points[q], rec);
+                    if ((fraction >= 0.0f) && (fraction < nearest)) nearest = fraction;
+                }
+                sum += nearest;
+            }
+            DoNotOptimize(sum);
+        }, 0.0);
+        printf("\n%-36s %10s\n", "Queries", "us/query");
+        printf("%-36s %10.3f %s\n", "Rectangle", rectTime*1e6/QUERY_COUNT, pass ? "" : "FAIL");
+        printf("%-36s %10.3f %s\n", "Point", pointTime*1e6/QUERY_COUNT, pass ? "" : "FAIL");
+        printf("%-36s %10.3f   (scan %.3f us) %s\n", "Raycast, closest hit", rayTime*1e6/QUERY_COUNT, scanTime*1e6/QUERY_COUNT, pass ? "" : "FAIL");
+    }
+
+    // Sorted inserts degenerate an unbalanced tree into a list, rotations keep it shallow
+    {
+        AabbTree sorted = CreateAabbTree(0.0f);
+        for (int i = 0; i < SORTED_COUNT; i++) CreateAabbProxy(&sorted, AabbBox{ (float)i, 0.0f, i + 0.5f, 0.5f }, i);
+        int height = GetAabbTreeHeight(&sorted);
+        bool pass = ValidateAabbTree(&sorted) && (height <= 2*(int)ceil(log2((double)SORTED_COUNT)));
+        ok = ok && pass;
+        printf("\n%-36s %10d   (log2 %.1f) %s\n", "Height after 100k sorted inserts", height, log2((double)SORTED_COUNT), pass ? "" : "FAIL");
+        DestroyAabbTree(&sorted);
+    }
+
+    DestroyAabbTree(&tree);
+    DestroyAabbTree(&wallTree);
+    DestroyAabbTree(&bulletTree);
+
+    printf("\n%s\n", ok ? "Tree pairs and queries match brute force" : "Tree mismatch");
+
+    return ok ? 0 : 1;
+}
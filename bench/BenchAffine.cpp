@@ -0,0 +1,171 @@
+// Benchmark and validation of the compact Transform2D/Affine3 types (src/Affine.h) against the 4x4 Matrix path
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchAffine.cpp
+#include "Affine.h"
+#include "Bench.h"
+#include <vector>
+
+static const int NODE_COUNT = 4096;
+
+// Largest element-wise difference, relative to the magnitude of the reference element
+static float MatrixError(Matrix a, Matrix reference)
+{
+    const float* pa = &a.m0;
+    const float* pr = &reference.m0;
+
+    float maxError = 0.0f;
+    for (int i = 0; i < 16; i++) maxError = fmaxf(maxError, fabsf(pa[i] - pr[i]) / fmaxf(1.0f, fabsf(pr[i])));
+
+    return maxError;
+}
+
+static float PointError(Vector3 a, Vector3 reference)
+{
+    float scale = fmaxf(1.0f, fmaxf(fabsf(reference.x), fmaxf(fabsf(reference.y), fabsf(reference.z))));
+    return fmaxf(fabsf(a.x - reference.x), fmaxf(fabsf(a.y - reference.y), fabsf(a.z - reference.z))) / scale;
+}
+
+static void Report(const char* name, double matrixSeconds, double compactSeconds)
+{
+    double toNs = 1e9 / NODE_COUNT;
+    printf("%-26s %10.2f %10.2f %7.2fx\n", name, matrixSeconds * toNs, compactSeconds * toNs, matrixSeconds / compactSeconds);
+}
+
+int main()
+{
+    std::vector<Affine3> a(NODE_COUNT), b(NODE_COUNT), outAffine(NODE_COUNT);
+    std::vector<Matrix> ma(NODE_COUNT), mb(NODE_COUNT), outMatrix(NODE_COUNT);
+    std::vector<Transform2D> t(NODE_COUNT), u(NODE_COUNT), outTransform(NODE_COUNT);
+    std::vector<Matrix> mt(NODE_COUNT), mu(NODE_COUNT);
+    std::vector<Vector3> points(NODE_COUNT), outPoints(NODE_COUNT);
+    std::vector<Vector2> points2(NODE_COUNT), outPoints2(NODE_COUNT);
+
+    // Typical scene nodes: non-uniform scale, rotation and translation
+    SeedRandom(1005);
+    for (int i = 0; i < NODE_COUNT; i++)
+    {
+        Vector3 axis = Normalize(Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) + 0.001f });
+        Vector3 scale = { Random(0.5f, 2.0f), Random(0.5f, 2.0f), Random(0.5f, 2.0f) };
+        Vector3 position = { Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+        a[i] = Affine3FromTRS(position, FromAxisAngle(axis, Random(-PI, PI)), scale);
+        b[i] = Affine3FromTRS(Scale(position, 0.5f), FromAxisAngle(axis, Random(-PI, PI)), Vector3{ 1.0f, 1.0f, 1.0f });
+        ma[i] = ToMatrix(a[i]);
+        mb[i] = ToMatrix(b[i]);
+
+        t[i] = Transform2DFromTRS(Vector2{ position.x, position.y }, Random(-PI, PI), Vector2{ scale.x, scale.y });
+        u[i] = Transform2DFromTRS(Vector2{ position.z, position.x }, Random(-PI, PI), Vector2{ 1.0f, 1.0f });
+        mt[i] = ToMatrix(t[i]);
+        mu[i] = ToMatrix(u[i]);
+
+        points[i] = Vector3{ Random(-10.0f, 10.0f), Random(-10.0f, 10.0f), Random(-10.0f, 10.0f) };
+        points2[i] = Vector2{ points[i].x, points[i].y };
+    }
+
+    printf("Compact affine transforms, %d nodes, Matrix %d bytes, Affine3 %d bytes, Transform2D %d bytes\n\n",
+        NODE_COUNT, (int)sizeof(Matrix), (int)sizeof(Affine3), (int)sizeof(Transform2D));
+
+    // Accuracy against the Matrix path
+    float composeError = 0.0f, invertError = 0.0f, pointError = 0.0f;
+    float compose2DError = 0.0f, invert2DError = 0.0f, point2DError = 0.0f;
+    for (int i = 0; i < NODE_COUNT; i++)
+    {
+        composeError = fmaxf(composeError, MatrixError(ToMatrix(Multiply(a[i], b[i])), MultiplyScalar(ma[i], mb[i])));
+        invertError = fmaxf(invertError, MatrixError(ToMatrix(Invert(a[i])), InvertScalar(ma[i])));
+        pointError = fmaxf(pointError, PointError(Multiply(points[i], a[i]), Multiply(points[i], ma[i])));
+
+        compose2DError = fmaxf(compose2DError, MatrixError(ToMatrix(Multiply(t[i], u[i])), MultiplyScalar(mt[i], mu[i])));
+        invert2DError = fmaxf(invert2DError, MatrixError(ToMatrix(Invert(t[i])), InvertScalar(mt[i])));
+        Vector2 p = Multiply(points2[i], t[i]);
+        Vector2 reference = Multiply(points2[i], mt[i]);
+        point2DError = fmaxf(point2DError, PointError(Vector3{ p.x, p.y, 0.0f }, Vector3{ reference.x, reference.y, 0.0f }));
+
+        // Round trips are exact
+        if (MatrixError(ToMatrix(ToAffine3(ma[i])), ma[i]) != 0.0f) composeError = 1.0f;
+        if (MatrixError(ToMatrix(ToTransform2D(mt[i])), mt[i]) != 0.0f) compose2DError = 1.0f;
+    }
+
+    // Affine3
+    double matrixMul = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outMatrix[i] = Multiply(ma[i], mb[i]);
+        DoNotOptimize(outMatrix[NODE_COUNT - 1]);
+    });
+    double affineMul = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outAffine[i] = Multiply(a[i], b[i]);
+        DoNotOptimize(outAffine[NODE_COUNT - 1]);
+    });
+
+    // Dependent chain, as in a transform hierarchy walk
+    double matrixChain = BenchBest([&]() {
+        Matrix world = MatrixIdentity();
+        for (int i = 0; i < NODE_COUNT; i++) world = Multiply(ma[i], world);
+        DoNotOptimize(world);
+    });
+    double affineChain = BenchBest([&]() {
+        Affine3 world = Affine3Identity();
+        for (int i = 0; i < NODE_COUNT; i++) world = Multiply(a[i], world);
+        DoNotOptimize(world);
+    });
+
+    double matrixInv = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outMatrix[i] = Invert(ma[i]);
+        DoNotOptimize(outMatrix[NODE_COUNT - 1]);
+    });
+    double affineInv = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outAffine[i] = Invert(a[i]);
+        DoNotOptimize(outAffine[NODE_COUNT - 1]);
+    });
+
+    double matrixPoint = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outPoints[i] = Multiply(points[i], ma[i]);
+        DoNotOptimize(outPoints[NODE_COUNT - 1]);
+    });
+    double affinePoint = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outPoints[i] = Multiply(points[i], a[i]);
+        DoNotOptimize(outPoints[NODE_COUNT - 1]);
+    });
+
+    // Transform2D
+    double matrixMul2D = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outMatrix[i] = Multiply(mt[i], mu[i]);
+        DoNotOptimize(outMatrix[NODE_COUNT - 1]);
+    });
+    double transformMul = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outTransform[i] = Multiply(t[i], u[i]);
+        DoNotOptimize(outTransform[NODE_COUNT - 1]);
+    });
+
+    double matrixInv2D = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outMatrix[i] = Invert(mt[i]);
+        DoNotOptimize(outMatrix[NODE_COUNT - 1]);
+    });
+    double transformInv = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outTransform[i] = Invert(t[i]);
+        DoNotOptimize(outTransform[NODE_COUNT - 1]);
+    });
+
+    double matrixPoint2D = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outPoints2[i] = Multiply(points2[i], mt[i]);
+        DoNotOptimize(outPoints2[NODE_COUNT - 1]);
+    });
+    double transformPoint = BenchBest([&]() {
+        for (int i = 0; i < NODE_COUNT; i++) outPoints2[i] = Multiply(points2[i], t[i]);
+        DoNotOptimize(outPoints2[NODE_COUNT - 1]);
+    });
+
+    printf("%-26s %10s %10s %8s\n", "", "Matrix ns", "compact ns", "speedup");
+    Report("Affine3 Multiply", matrixMul, affineMul);
+    Report("Affine3 Multiply (chain)", matrixChain, affineChain);
+    Report("Affine3 Invert", matrixInv, affineInv);
+    Report("Affine3 point", matrixPoint, affinePoint);
+    Report("Transform2D Multiply", matrixMul2D, transformMul);
+    Report("Transform2D Invert", matrixInv2D, transformInv);
+    Report("Transform2D point", matrixPoint2D, transformPoint);
+
+    printf("\nmax error: Affine3 Multiply %.2e, Invert %.2e, point %.2e\n", composeError, invertError, pointError);
+    printf("           Transform2D Multiply %.2e, Invert %.2e, point %.2e\n", compose2DError, invert2DError, point2DError);
+
+    bool ok = (composeError <= EPSILON) && (invertError <= 16 * EPSILON) && (pointError <= EPSILON) &&
+        (compose2DError <= EPSILON) && (invert2DError <= 16 * EPSILON) && (point2DError <= EPSILON);
+    printf("%s\n", ok ? "Compact transforms match the Matrix path" : "Mismatch against the Matrix path");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+// Benchmark and validation of the frame arena and pools (src/Arena.h)
+// Per-frame scratch work (collision pairs, a visible list and HUD strings) on the heap and in
+// the frame arena, pool objects against new/delete, and the game frame (StepGame, DrawGame,
+// EndFrameArena) checked to make no heap allocation once it runs steadily
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchArena.cpp
+#define GAME_HEADLESS
+#include "Game.h"
+#include "Arena.h"
+#include "Bench.h"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+static const int POOL_OBJECTS = 100000;
+static const int HUD_STRINGS = 200;
+static const int STEADY_FRAMES = 600;
+
+// Longer than the std::string small buffer, as most HUD lines are
+#define HUD_FORMAT "ball %d of %d, tick %lld"
+
+// Count heap allocations, every path through operator new
+static long allocationCount = 0;
+
+void* operator new(size_t size)
+{
+    allocationCount++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+#if defined(_MSC_VER)
+static void* AlignedMalloc(size_t size, size_t alignment) { return _aligned_malloc(size, alignment); }
+static void AlignedFree(void* p) { _aligned_free(p); }
+#else
+static void* AlignedMalloc(size_t size, size_t alignment) { return aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1)); }
+static void AlignedFree(void* p) { free(p); }
+#endif
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    allocationCount++;
+    void* p = AlignedMalloc(size ? size : 1, (size_t)alignment);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { AlignedFree(p); }
+
+struct Pair {
+    int a;
+    int b;
+};
+
+struct Projectile {
+    Vector2 position;
+    Vector2 velocity;
+    float life;
+    int owner;
+};
+
+// Scratch work of one frame: overlapping ball pairs, balls on screen and HUD lines
+template <typename PairVector, typename IndexVector, typename MakeString>
+static long long ScratchWork(const Game& game, PairVector& pairs, IndexVector& visible, MakeString&& makeString)
+{
+    const std::vector<Ball>& balls = game.current.balls;
+    const float reach = 4.0f*GAME_BALL_RADIUS;
+    long long checksum = 0;
+
+    for (int i = 0; i < (int)balls.size(); i++)
+    {
+        if (balls[i].position.y >= 0.0f) visible.push_back(i);
+        for (int j = i + 1; j < (int)balls.size(); j++)
+        {
+            if (DistanceSqr(balls[i].position, balls[j].position) < reach*reach) pairs.push_back(Pair{ i, j });
+        }
+    }
+    for (const Pair& pair : pairs) checksum += pair.a*31 + pair.b;
+    for (int index : visible) checksum += index;
+    for (int i = 0; i < HUD_STRINGS; i++) checksum += makeString(i)[0];
+
+    return checksum;
+}
+
+int main()
+{
+    bool ok = true;
+    Game game = {};
+    InitGame(&game, GAME_BALL_COUNT, 1005);
+    const double frameSeconds = 1.0/GAME_TICKS_PER_SECOND;
+
+    printf("Frame arena, %d balls, %d HUD strings per frame\n\n", GAME_BALL_COUNT, HUD_STRINGS);
+    printf("%-34s %10s %12s\n", "Scratch work per frame", "us/frame", "allocations");
+
+    // Heap: std::vector and std::string, freed at the end of the frame
+    long long heapChecksum = 0;
+    long before = allocationCount;
+    {
+        std::vector<Pair> pairs;
+        std::vector<int> visible;
+        std::vector<std::string> hud;
+        heapChecksum = ScratchWork(game, pairs, visible, [&](int i) {
+            char buffer[64];
+            snprintf(buffer, sizeof(buffer), HUD_FORMAT, i, GAME_BALL_COUNT, game.loop.tick);
+            hud.emplace_back(buffer);
+            return hud.back().c_str();
+        });
+    }
+    long heapAllocations = allocationCount - before;
+    double heapTime = BenchBest([&]() {
+        std::vector<Pair> pairs;
+        std::vector<int> visible;
+        std::vector<std::string> hud;
+        DoNotOptimize(ScratchWork(game, pairs, visible, [&](int i) {
+            char buffer[64];
+            snprintf(buffer, sizeof(buffer), HUD_FORMAT, i, GAME_BALL_COUNT, game.loop.tick);
+            hud.emplace_back(buffer);
+            return hud.back().c_str();
+        }));
+    });
+    printf("%-34s %10.2f %12ld\n", "Heap (std::vector, std::string)", heapTime*1e6, heapAllocations);
+
+    // Frame arena: the same containers on ArenaAllocator, FrameFormat() for the strings
+    FrameArena frame = CreateFrameArena(0);
+    auto ArenaFrame = [&]() {
+        ArenaVector<Pair> pairs(ArenaAllocator<Pair>(&frame.frame));
+        ArenaVector<int> visible(ArenaAllocator<int>(&frame.frame));
+        long long checksum = ScratchWork(game, pairs, visible, [&](int i) { return FrameFormat(&frame, HUD_FORMAT, i, GAME_BALL_COUNT, game.loop.tick); });
+        EndFrameArena(&frame);
+        return checksum;
+    };
+    long long arenaChecksum = ArenaFrame();
+    before = allocationCount;
+    arenaChecksum = ArenaFrame();
+    long arenaAllocations = allocationCount - before;
+    ok = ok && (arenaChecksum == heapChecksum) && (arenaAllocations == 0);
+    double arenaTime = BenchBest([&]() { DoNotOptimize(ArenaFrame()); });
+    printf("%-34s %10.2f %12ld   %.2fx %s\n", "Frame arena", arenaTime*1e6, arenaAllocations, heapTime/arenaTime,
+        (arenaChecksum == heapChecksum) ? "" : "FAIL");
+
+    // Pool: allocate every object, free them in a scattered order, allocate again
+    printf("\n%-34s %10s\n", "Alloc + free of 100k objects", "ns/object");
+    std::vector<Projectile*> objects(POOL_OBJECTS);
+    std::vector<int> order(POOL_OBJECTS);
+    for (int i = 0; i < POOL_OBJECTS; i++) order[i] = (int)(((long long)i*7919) % POOL_OBJECTS);
+
+    double newTime = BenchBest([&]() {
+        for (int i = 0; i < POOL_OBJECTS; i++) objects[i] = new Projectile{ { 0.0f, 0.0f }, { 1.0f, 0.0f }, 1.0f, i };
+        for (int i : order) delete objects[i];
+    });
+    printf("%-34s %10.2f\n", "new/delete", newTime*1e9/POOL_OBJECTS);
+
+    Pool pool = CreatePool(sizeof(Projectile), POOL_OBJECTS, alignof(Projectile));
+    before = allocationCount;
+    bool poolPass = true;
+    double poolTime = BenchBest([&]() {
+        for (int i = 0; i < POOL_OBJECTS; i++) objects[i] = PoolNew<Projectile>(&pool, Projectile{ { 0.0f, 0.0f }, { 1.0f, 0.0f }, 1.0f, i });
+        for (int i = 0; i < POOL_OBJECTS; i++) poolPass = poolPass && objects[i] && (objects[i]->owner == i);
+        poolPass = poolPass && (PoolAlloc(&pool) == nullptr);
+        for (int i : order) PoolDelete(&pool, objects[i]);
+    });
+    poolPass = poolPass && (pool.count == 0) && (allocationCount == before);
+    ok = ok && poolPass;
+    printf("%-34s %10.2f   %.2fx %s\n", "Pool", poolTime*1e9/POOL_OBJECTS, newTime/poolTime, poolPass ? "" : "FAIL");
+    DestroyPool(&pool);
+
+    // Buffered memory survives one EndFrameArena() and is reused after the second
+    bool bufferPass = true;
+    int* carried = (int*)FrameAllocBuffered(&frame, 1000*sizeof(int));
+    for (int i = 0; i < 1000; i++) carried[i] = i;
+    EndFrameArena(&frame);
+    int* next = (int*)FrameAllocBuffered(&frame, 1000*sizeof(int));
+    int* scratch = FrameAllocArray<int>(&frame, 1000);
+    for (int i = 0; i < 1000; i++) next[i] = scratch[i] = -1;
+    for (int i = 0; i < 1000; i++) bufferPass = bufferPass && (carried[i] == i);
+    EndFrameArena(&frame);
+    bufferPass = bufferPass && (FrameAllocBuffered(&frame, 1000*sizeof(int)) == carried);
+    EndFrameArena(&frame);
+    ok = ok && bufferPass;
+    printf("\n%-34s %s\n", "Double-buffered lifetime", bufferPass ? "ok" : "FAIL");
+
+    // Steady state: the game frame plus the arena scratch work, recorded draw calls
+    DrawList list = {};
+    list.mode = DRAW_LIST_RECORD;
+    long long frames = 0;
+    auto GameFrame = [&]() {
+        frames++;
+        StepGame(&game, frames*frameSeconds);
+        ClearDrawList(&list);
+        DrawGame(game, &list, &frame);
+        ArenaVector<Pair> pairs(ArenaAllocator<Pair>(&frame.frame));
+        ArenaVector<int> visible(ArenaAllocator<int>(&frame.frame));
+        DoNotOptimize(ScratchWork(game, pairs, visible, [&](int i) { return FrameFormat(&frame, HUD_FORMAT, i, GAME_BALL_COUNT, game.loop.tick); }));
+        EndFrameArena(&frame);
+    };
+    for (int i = 0; i < 10; i++) GameFrame();
+    before = allocationCount;
+    for (int i = 0; i < STEADY_FRAMES; i++) GameFrame();
+    long steadyAllocations = allocationCount - before;
+    ok = ok && (steadyAllocations == 0);
+    printf("%-34s %ld allocations in %d frames, arena peak %zu bytes %s\n", "Steady-state game frames", steadyAllocations, STEADY_FRAMES,
+        frame.frame.peak, (steadyAllocations == 0) ? "" : "FAIL");
+
+    DestroyFrameArena(&frame);
+
+    printf("\n%s\n", ok ? "Arena results match the heap" : "Arena mismatch");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+// Benchmark and validation of the Vector2 SoA batch kernels (src/MathBatch.h)
+// Reports entities per millisecond for the per-call loop and every available SIMD path
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchBatch.cpp
+#include "MathBatch.h"
+#include "Bench.h"
+#include <vector>
+
+static const int ENTITY_COUNT = 200000;
+
+struct Entities {
+    std::vector<float> x, y, tx, ty;
+    std::vector<float> outX, outY;
+};
+
+// Largest relative error of the batch output against the reference scalar results
+static float MaxError(const Entities& e, const std::vector<Vector2>& reference)
+{
+    float maxError = 0.0f;
+    for (int i = 0; i < ENTITY_COUNT; i++)
+    {
+        float ex = fabsf(e.outX[i] - reference[i].x) / fmaxf(1.0f, fabsf(reference[i].x));
+        float ey = fabsf(e.outY[i] - reference[i].y) / fmaxf(1.0f, fabsf(reference[i].y));
+        maxError = fmaxf(maxError, fmaxf(ex, ey));
+    }
+    return maxError;
+}
+
+template <typename ScalarFn, typename BatchFn>
+static bool Run(const char* name, Entities& e, ScalarFn scalarOp, BatchFn batchOp)
+{
+    std::vector<Vector2> reference(ENTITY_COUNT);
+
+    // Baseline: one Math.h call per entity
+    double callTime = BenchBest([&]() {
+        for (int i = 0; i < ENTITY_COUNT; i++) reference[i] = scalarOp(i);
+        DoNotOptimize(reference[ENTITY_COUNT - 1]);
+    });
+    printf("%-14s %-8s %10.1f entities/ms\n", name, "Call", ENTITY_COUNT / (callTime * 1000.0));
+
+    bool ok = true;
+    SimdLevel supported = DetectSimdLevel();
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        double time = BenchBest([&]() {
+            batchOp();
+            DoNotOptimize(e.outX[ENTITY_COUNT - 1]);
+        });
+
+        float error = MaxError(e, reference);
+        bool pass = error <= EPSILON;
+        ok = ok && pass;
+
+        printf("%-14s %-8s %10.1f entities/ms   max error %.2e %s\n", name, SimdLevelName((SimdLevel)level),
+            ENTITY_COUNT / (time * 1000.0), error, pass ? "" : "FAIL");
+    }
+    SetSimdLevel(supported);
+
+    return ok;
+}
+
+int main()
+{
+    Entities e;
+    e.x.resize(ENTITY_COUNT); e.y.resize(ENTITY_COUNT);
+    e.tx.resize(ENTITY_COUNT); e.ty.resize(ENTITY_COUNT);
+    e.outX.resize(ENTITY_COUNT); e.outY.resize(ENTITY_COUNT);
+
+    SeedRandom(1005);
+    for (int i = 0; i < ENTITY_COUNT; i++)
+    {
+        e.x[i] = Random(-100.0f, 100.0f);
+        e.y[i] = Random(-100.0f, 100.0f);
+        e.tx[i] = Random(-100.0f, 100.0f);
+        e.ty[i] = Random(-100.0f, 100.0f);
+    }
+
+    // Exercise the special cases: zero vectors and entities already at their target
+    e.x[0] = e.y[0] = 0.0f;
+    e.tx[1] = e.x[1]; e.ty[1] = e.y[1];
+
+    const float dt = 1.0f / 60.0f;
+    const Vector2 boundsMin = { -50.0f, -50.0f };
+    const Vector2 boundsMax = { 50.0f, 50.0f };
+
+    printf("Vector2 batch kernels, %d entities, detected %s\n\n", ENTITY_COUNT, SimdLevelName(DetectSimdLevel()));
+
+    bool ok = true;
+    ok &= Run("Add", e,
+        [&](int i) { return Add(Vector2{ e.x[i], e.y[i] }, Vector2{ e.tx[i], e.ty[i] }); },
+        [&]() { AddBatch(e.x.data(), e.y.data(), e.tx.data(), e.ty.data(), e.outX.data(), e.outY.data(), ENTITY_COUNT); });
+    ok &= Run("Scale", e,
+        [&](int i) { return Scale(Vector2{ e.x[i], e.y[i] }, dt); },
+        [&]() { ScaleBatch(e.x.data(), e.y.data(), dt, e.outX.data(), e.outY.data(), ENTITY_COUNT); });
+    ok &= Run("Normalize", e,
+        [&](int i) { return Normalize(Vector2{ e.x[i], e.y[i] }); },
+        [&]() { NormalizeBatch(e.x.data(), e.y.data(), e.outX.data(), e.outY.data(), ENTITY_COUNT); });
+    ok &= Run("Lerp", e,
+        [&](int i) { return Lerp(Vector2{ e.x[i], e.y[i] }, Vector2{ e.tx[i], e.ty[i] }, 0.25f); },
+        [&]() { LerpBatch(e.x.data(), e.y.data(), e.tx.data(), e.ty.data(), 0.25f, e.outX.data(), e.outY.data(), ENTITY_COUNT); });
+    ok &= Run("MoveTowards", e,
+        [&](int i) { return MoveTowards(Vector2{ e.x[i], e.y[i] }, Vector2{ e.tx[i], e.ty[i] }, 20.0f); },
+        [&]() { MoveTowardsBatch(e.x.data(), e.y.data(), e.tx.data(), e.ty.data(), 20.0f, e.outX.data(), e.outY.data(), ENTITY_COUNT); });
+    ok &= Run("Clamp", e,
+        [&](int i) { return Clamp(Vector2{ e.x[i], e.y[i] }, boundsMin, boundsMax); },
+        [&]() { ClampBatch(e.x.data(), e.y.data(), boundsMin, boundsMax, e.outX.data(), e.outY.data(), ENTITY_COUNT); });
+    ok &= Run("ClampLength", e,
+        [&](int i) { return Clamp(Vector2{ e.x[i], e.y[i] }, 10.0f, 60.0f); },
+        [&]() { ClampBatch(e.x.data(), e.y.data(), 10.0f, 60.0f, e.outX.data(), e.outY.data(), ENTITY_COUNT); });
+
+    printf("\n%s\n", ok ? "All paths match the scalar functions" : "Mismatch against the scalar functions");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+// Benchmark and validation of the archetype ECS (src/Ecs.h)
+// Integrates position += velocity*dt over 1M entities spread over four archetypes: array of
+// fat game objects (AoS), chunk query, per-entity query and parallel chunk query. Then moves
+// entities between archetypes (add/remove) and recycles handles, checking that every
+// component survives the moves
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchEcs.cpp
+#include "Ecs.h"
+#include "Math.h"
+#include "Bench.h"
+#include <vector>
+
+static const int ENTITY_COUNT = 1 << 20;
+static const int CHURN_COUNT = 10000;
+
+struct Position { Vector2 value; };
+struct Velocity { Vector2 value; };
+struct Sprite { int texture; float rotation; float scale; unsigned int tint; };
+struct Health { float value; };
+
+// What an entity would be without an ECS: everything the game knows about an object in one struct
+struct GameObject {
+    Vector2 position;
+    Vector2 velocity;
+    Sprite sprite;
+    float health;
+    int flags;
+    char name[24];
+};
+
+static bool SameVector(Vector2 a, Vector2 b)
+{
+    return memcmp(&a, &b, sizeof(Vector2)) == 0;
+}
+
+int main()
+{
+    const float dt = 1.0f/60.0f;
+
+    // Every entity moves, one in four has a sprite, one in eight has health
+    std::vector<GameObject> objects(ENTITY_COUNT);
+    std::vector<Entity> entities(ENTITY_COUNT);
+    std::vector<char> hasHealth(ENTITY_COUNT);
+    EcsWorld* world = CreateEcsWorld();
+
+    SeedRandom(1005);
+    for (int i = 0; i < ENTITY_COUNT; i++)
+    {
+        GameObject& object = objects[i];
+        object = GameObject{};
+        object.position = Vector2{ Random(0.0f, 1000.0f), Random(0.0f, 1000.0f) };
+        object.velocity = Vector2{ Random(-50.0f, 50.0f), Random(-50.0f, 50.0f) };
+        object.sprite = Sprite{ i & 15, 0.0f, 1.0f, 0xffffffffu };
+        object.health = 100.0f;
+
+        entities[i] = CreateEntity(world, Position{ object.position }, Velocity{ object.velocity });
+        if ((i & 3) == 0) AddComponent(world, entities[i], object.sprite);
+        hasHealth[i] = ((i & 7) == 0);
+        if (hasHealth[i]) AddComponent(world, entities[i], Health{ object.health });
+    }
+
+    // Reference step with the Math.h operators
+    std::vector<Vector2> reference(ENTITY_COUNT);
+    for (int i = 0; i < ENTITY_COUNT; i++) reference[i] = objects[i].position + objects[i].velocity*dt;
+
+    int hardwareThreads = (int)std::thread::hardware_concurrency();
+    JobSystem* jobs = CreateJobSystem(0);
+
+    printf("ECS, %d entities, %d archetypes, %d byte chunks, %d workers\n\n", ENTITY_COUNT, (int)world->archetypes.size(), ECS_CHUNK_SIZE, GetJobWorkerCount(jobs));
+    printf("%-34s %10s %10s\n", "position += velocity*dt", "ns/entity", "vs AoS");
+
+    double aosTime = BenchBest([&]() {
+        for (GameObject& object : objects) object.position = object.position + object.velocity*dt;
+        DoNotOptimize(objects[ENTITY_COUNT - 1]);
+    });
+    printf("%-34s %10.3f %9.2fx\n", "AoS game objects", aosTime*1e9/ENTITY_COUNT, 1.0);
+
+    // Each variant runs one validated step from the initial state, then the timed steps
+    bool ok = true;
+    std::vector<Vector2> initial(ENTITY_COUNT);
+    for (int i = 0; i < ENTITY_COUNT; i++) initial[i] = GetComponent<Position>(world, entities[i])->value;
+
+    auto Reset = [&]() {
+        for (int i = 0; i < ENTITY_COUNT; i++) GetComponent<Position>(world, entities[i])->value = initial[i];
+    };
+    auto Check = [&]() {
+        bool pass = true;
+        for (int i = 0; i < ENTITY_COUNT; i++) pass = pass && SameVector(GetComponent<Position>(world, entities[i])->value, reference[i]);
+        return pass;
+    };
+    auto Report = [&](const char* name, double time, bool pass) {
+        printf("%-34s %10.3f %9.2fx %s\n", name, time*1e9/ENTITY_COUNT, aosTime/time, pass ? "" : "FAIL");
+    };
+
+    auto ChunkStep = [&]() {
+        QueryChunks<Position, Velocity>(world, [&](const Entity*, int count, Position* p, const Velocity* v) {
+            for (int i = 0; i < count; i++) p[i].value = p[i].value + v[i].value*dt;
+        });
+    };
+    auto EachStep = [&]() {
+        QueryEach<Position, Velocity>(world, [&](Position& p, const Velocity& v) { p.value = p.value + v.value*dt; });
+    };
+    auto ParallelStep = [&]() {
+        ParallelQueryChunks<Position, Velocity>(world, jobs, [&](const Entity*, int count, Position* p, const Velocity* v) {
+            for (int i = 0; i < count; i++) p[i].value = p[i].value + v[i].value*dt;
+        });
+    };
+
+    Reset();
+    ChunkStep();
+    bool pass = Check();
+    ok = ok && pass;
+    Report("QueryChunks", BenchBest([&]() { ChunkStep(); }), pass);
+
+    Reset();
+    EachStep();
+    pass = Check();
+    ok = ok && pass;
+    Report("QueryEach", BenchBest([&]() { EachStep(); }), pass);
+
+    Reset();
+    ParallelStep();
+    pass = Check();
+    ok = ok && pass;
+    char name[64];
+    snprintf(name, sizeof(name), "ParallelQueryChunks (%d workers)", GetJobWorkerCount(jobs));
+    Report(name, BenchBest([&]() { ParallelStep(); }), pass);
+    if (hardwareThreads <= 1) printf("  (single hardware thread, the parallel query runs serially)\n");
+
+    // Archetype moves: each frame gives health to entities without it and takes it from as many others
+    // (hasHealth 2 and 3 mark the entities picked this frame, so that none is picked twice)
+    Reset();
+    const int churnFrames = 20;
+    double churnTime = 1e30;
+    std::vector<int> gain, lose;
+    for (int frame = 0; frame < churnFrames; frame++)
+    {
+        gain.clear();
+        lose.clear();
+        while ((int)gain.size() < CHURN_COUNT || (int)lose.size() < CHURN_COUNT)
+        {
+            int i = (int)(NextRandom(GetThreadRandomState()) % ENTITY_COUNT);
+            if (hasHealth[i] == 0 && (int)gain.size() < CHURN_COUNT) { gain.push_back(i); hasHealth[i] = 2; }
+            else if (hasHealth[i] == 1 && (int)lose.size() < CHURN_COUNT) { lose.push_back(i); hasHealth[i] = 3; }
+        }
+
+        double t0 = BenchTime();
+        for (int i : gain) AddComponent(world, entities[i], Health{ 100.0f });
+        for (int i : lose) RemoveComponent<Health>(world, entities[i]);
+        double t1 = BenchTime();
+        if (t1 - t0 < churnTime) churnTime = t1 - t0;
+
+        for (int i : gain) hasHealth[i] = 1;
+        for (int i : lose) hasHealth[i] = 0;
+    }
+    printf("\n%-34s %10.1f ns/move (%d moves per frame)\n", "Add/RemoveComponent<Health>", churnTime*1e9/(2*CHURN_COUNT), 2*CHURN_COUNT);
+
+    // Every entity kept its components and its archetype matches the expected set
+    pass = true;
+    int healthCount = 0;
+    for (int i = 0; i < ENTITY_COUNT; i++)
+    {
+        pass = pass && SameVector(GetComponent<Position>(world, entities[i])->value, initial[i]);
+        pass = pass && SameVector(GetComponent<Velocity>(world, entities[i])->value, objects[i].velocity);
+        pass = pass && (HasComponent<Health>(world, entities[i]) == (hasHealth[i] == 1));
+        pass = pass && (HasComponent<Sprite>(world, entities[i]) == ((i & 3) == 0));
+        if (hasHealth[i] == 1) healthCount++;
+    }
+    int queried = 0;
+    QueryChunks<Health, Position>(world, [&](const Entity* ids, int count, Health*, Position* p) {
+        for (int i = 0; i < count; i++) pass = pass && SameVector(p[i].value, initial[ids[i].index]);
+        queried += count;
+    });
+    pass = pass && (queried == healthCount);
+    ok = ok && pass;
+    printf("%-34s %s\n", "Components after the moves", pass ? "match" : "FAIL");
+
+    // Handle recycling: destroyed handles stay dead after their index is reused
+    pass = true;
+    for (int i = 0; i < CHURN_COUNT; i++) DestroyEntity(world, entities[i]);
+    for (int i = 0; i < CHURN_COUNT; i++)
+    {
+        Entity fresh = CreateEntity(world, Position{ initial[i] }, Velocity{ objects[i].velocity });
+        pass = pass && !IsEntityAlive(world, entities[i]) && IsEntityAlive(world, fresh) && (fresh.index < (uint32_t)ENTITY_COUNT);
+        entities[i] = fresh;
+    }
+    pass = pass && (GetEntityCount(world) == ENTITY_COUNT);
+    ok = ok && pass;
+    printf("%-34s %s\n", "Destroy/create recycling", pass ? "match" : "FAIL");
+
+    DestroyJobSystem(jobs);
+    DestroyEcsWorld(world);
+
+    printf("\n%s\n", ok ? "ECS results match the AoS update" : "ECS mismatch");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+// Validation of the fixed timestep loop (src/GameLoop.h)
+// Feeds the loop jittery and stalling frame times and checks the tick count, the catch-up cap
+// and that interpolated render positions follow real time without steps
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchGameLoop.cpp
+#include "GameLoop.h"
+#include "Bench.h"
+
+static const int FRAME_COUNT = 100000;
+
+int main()
+{
+    bool ok = true;
+    SeedRandom(1005);
+
+    // Jittery frames between 2 ms and 40 ms: every elapsed whole tick is run
+    GameLoop loop = CreateGameLoop(60, 8);
+    double time = 1.0;
+    AdvanceGameLoop(&loop, time);
+    int maxTicks = 0;
+    for (int i = 0; i < FRAME_COUNT; i++)
+    {
+        time += Random(0.002f, 0.040f);
+        int ticks = AdvanceGameLoop(&loop, time);
+        if (ticks > maxTicks) maxTicks = ticks;
+    }
+    long long expected = (long long)((time - 1.0)/loop.tickSeconds);
+    bool pass = (llabs(loop.tick - expected) <= 1) && (loop.droppedSeconds == 0.0);
+    ok = ok && pass;
+    printf("%-34s %lld ticks for %lld expected, at most %d per frame %s\n", "Jittery frames", loop.tick, expected, maxTicks, pass ? "" : "FAIL");
+
+    // A 2 second stall runs 8 ticks and drops the rest, the phase within the tick is kept
+    loop = CreateGameLoop(60, 8);
+    AdvanceGameLoop(&loop, 0.0);
+    int stallTicks = AdvanceGameLoop(&loop, 2.0 + 0.25/60.0);
+    float alpha = GetGameLoopAlpha(loop);
+    pass = (stallTicks == 8) && (fabs(loop.droppedSeconds - (120 - 8)/60.0) < 1e-9) && (fabsf(alpha - 0.25f) < 1e-4f);
+    ok = ok && pass;
+    printf("%-34s %d ticks, dropped %.4f s, alpha %.4f %s\n", "2 s stall", stallTicks, loop.droppedSeconds, alpha, pass ? "" : "FAIL");
+
+    // A clock going backwards runs nothing
+    int backTicks = AdvanceGameLoop(&loop, 1.0);
+    pass = (backTicks == 0);
+    ok = ok && pass;
+    printf("%-34s %d ticks %s\n", "Clock going backwards", backTicks, pass ? "" : "FAIL");
+
+    // Constant velocity: the interpolated position lags real time by exactly one tick
+    loop = CreateGameLoop(30, 8);
+    time = 0.0;
+    AdvanceGameLoop(&loop, time);
+    Vector2 previous = { 0 }, current = { 0 };
+    const Vector2 velocity = { 100.0f, -50.0f };
+    float maxError = 0.0f;
+    for (int i = 0; i < FRAME_COUNT; i++)
+    {
+        time += Random(0.001f, 0.050f);
+        int ticks = AdvanceGameLoop(&loop, time);
+        for (int t = 0; t < ticks; t++)
+        {
+            // From the tick index, accumulating float positions would drift over 75k ticks
+            previous = current;
+            current = velocity*(float)((loop.tick - ticks + t + 1)*loop.tickSeconds);
+        }
+
+        Vector2 rendered = InterpolatePosition(previous, current, GetGameLoopAlpha(loop));
+        Vector2 expectedPosition = velocity*(float)(time - loop.tickSeconds);
+        if (loop.tick > 0) maxError = fmaxf(maxError, Distance(rendered, expectedPosition)/fmaxf(1.0f, Length(expectedPosition)));
+    }
+    pass = maxError < 1e-4f;
+    ok = ok && pass;
+    printf("%-34s max relative error %.2e %s\n", "Interpolated constant velocity", maxError, pass ? "" : "FAIL");
+
+    // Shortest arc across the -PI/PI seam
+    float angle = InterpolateAngle(PI - 0.1f, -PI + 0.1f, 0.5f);
+    pass = fabsf(fabsf(angle) - PI) < 1e-5f;
+    ok = ok && pass;
+    printf("%-34s %.5f %s\n", "InterpolateAngle across PI", angle, pass ? "" : "FAIL");
+
+    printf("\n%s\n", ok ? "Game loop behaves as documented" : "Game loop mismatch");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+// Benchmark and validation of the work-stealing job system (src/JobSystem.h)
+// Checks ParallelFor coverage, parent/child completion and dependency order, then measures
+// how an entity update scales with the worker count (1, 2, 4... up to the hardware threads)
+// From 8 workers on, the run fails if the per-core efficiency drops under SCALING_TARGET
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchJobSystem.cpp
+#include "JobSystem.h"
+#include "Math.h"
+#include "Bench.h"
+#include <algorithm>
+#include <vector>
+
+static const int ENTITY_COUNT = 1 << 20;
+static const int ENTITY_GRAIN = 4096;
+static const double SCALING_TARGET = 0.7;     // Near-linear: per-core efficiency on 8 workers and up
+static const int SCALING_MIN_WORKERS = 8;
+
+struct Entity {
+    Vector2 position;
+    Vector2 velocity;
+    Vector2 target;
+};
+
+// Per-entity work of a steering update, heavy enough that memory bandwidth does not cap the scaling
+static void UpdateEntities(Entity* entities, int begin, int end, float dt)
+{
+    for (int i = begin; i < end; i++)
+    {
+        Entity& e = entities[i];
+        for (int step = 0; step < 4; step++)
+        {
+            Vector2 desired = Normalize(e.target - e.position)*120.0f;
+            e.velocity = Clamp(e.velocity + (desired - e.velocity)*(2.0f*dt), 0.0f, 150.0f);
+            e.position = e.position + e.velocity*dt;
+        }
+    }
+}
+
+static bool Validate(JobSystem* jobs)
+{
+    bool ok = true;
+
+    // Every index visited exactly once
+    std::vector<int> visits(ENTITY_COUNT + 77, 0);
+    ParallelFor(jobs, (int)visits.size(), 1000, [&](int begin, int end) { for (int i = begin; i < end; i++) visits[i]++; });
+    for (int v : visits) ok = ok && (v == 1);
+
+    // More pieces asked for than a job ring holds (count/grain > JOB_POOL_SIZE)
+    const int manyPieces[][2] = { { 6000, 1 }, { 8192, 1 }, { 65536, 1 }, { 1000000, 16 } };
+    for (const auto& test : manyPieces)
+    {
+        std::fill(visits.begin(), visits.end(), 0);
+        ParallelFor(jobs, test[0], test[1], [&](int begin, int end) { for (int i = begin; i < end; i++) visits[i]++; });
+        for (int i = 0; i < (int)visits.size(); i++) ok = ok && (visits[i] == ((i < test[0]) ? 1 : 0));
+    }
+
+    // Children keep the parent unfinished
+    std::atomic<int> childCount(0);
+    Job* root = CreateJob(jobs, [&]() {});
+    for (int i = 0; i < 100; i++) RunJob(jobs, CreateJob(jobs, [&]() { childCount++; }, root));
+    RunJob(jobs, root);
+    WaitJob(jobs, root);
+    ok = ok && (childCount == 100);
+
+    // Diamond: a -> (b, c) -> d, each job records the order in which it ran
+    std::atomic<int> order(0);
+    int ranA = -1, ranB = -1, ranC = -1, ranD = -1;
+    Job* a = CreateJob(jobs, [&]() { ranA = order++; });
+    Job* b = CreateJob(jobs, [&]() { ranB = order++; });
+    Job* c = CreateJob(jobs, [&]() { ranC = order++; });
+    Job* d = CreateJob(jobs, [&]() { ranD = order++; });
+    AddJobDependency(a, b);
+    AddJobDependency(a, c);
+    AddJobDependency(b, d);
+    AddJobDependency(c, d);
+    RunJob(jobs, d);
+    RunJob(jobs, c);
+    RunJob(jobs, b);
+    RunJob(jobs, a);
+    WaitJob(jobs, d);
+    ok = ok && (ranA == 0) && (ranB > ranA) && (ranC > ranA) && (ranD == 3);
+
+    return ok;
+}
+
+int main()
+{
+    int hardwareThreads = (int)std::thread::hardware_concurrency();
+    if (hardwareThreads < 1) hardwareThreads = 1;
+
+    std::vector<Entity> initial(ENTITY_COUNT), reference, entities;
+    SeedRandom(1005);
+    for (Entity& e : initial)
+    {
+        e.position = Vector2{ Random(0.0f, 1000.0f), Random(0.0f, 1000.0f) };
+        e.velocity = Vector2{ Random(-50.0f, 50.0f), Random(-50.0f, 50.0f) };
+        e.target = Vector2{ Random(0.0f, 1000.0f), Random(0.0f, 1000.0f) };
+    }
+
+    const float dt = 1.0f/60.0f;
+    reference = initial;
+    UpdateEntities(reference.data(), 0, ENTITY_COUNT, dt);
+
+    printf("Job system, %d entities, grain %d, %d hardware threads\n\n", ENTITY_COUNT, ENTITY_GRAIN, hardwareThreads);
+    printf("%-10s %10s %10s %10s\n", "workers", "ms", "speedup", "per core");
+
+    // Validation also runs oversubscribed (more workers than cores), which shakes out races
+    bool ok = true;
+    double singleTime = 0.0;
+    int maxWorkers = (hardwareThreads > 4) ? hardwareThreads : 4;
+    for (int workers = 1; workers <= maxWorkers; workers *= 2)
+    {
+        JobSystem* jobs = CreateJobSystem(workers);
+
+        bool pass = Validate(jobs);
+        entities = initial;
+        ParallelFor(jobs, ENTITY_COUNT, ENTITY_GRAIN, [&](int begin, int end) { UpdateEntities(entities.data(), begin, end, dt); });
+        pass = pass && (memcmp(entities.data(), reference.data(), sizeof(Entity) * ENTITY_COUNT) == 0);
+        ok = ok && pass;
+
+        // Timing only means something up to the number of cores
+        if (workers <= hardwareThreads)
+        {
+            double time = BenchBest([&]() {
+                ParallelFor(jobs, ENTITY_COUNT, ENTITY_GRAIN, [&](int begin, int end) { UpdateEntities(entities.data(), begin, end, dt); });
+                DoNotOptimize(entities[ENTITY_COUNT - 1]);
+            });
+            if (workers == 1) singleTime = time;
+            double efficiency = singleTime / (time * workers);
+            bool scales = (workers < SCALING_MIN_WORKERS) || (efficiency >= SCALING_TARGET);
+            ok = ok && scales;
+            printf("%-10d %10.2f %9.2fx %9.0f%% %s\n", workers, time * 1000.0, singleTime / time, 100.0 * efficiency, !pass ? "FAIL" : (scales ? "" : "BELOW TARGET"));
+        }
+        else printf("%-10d %10s %10s %10s %s\n", workers, "-", "-", "-", pass ? "(validated, oversubscribed)" : "FAIL");
+
+        DestroyJobSystem(jobs);
+    }
+
+    if (hardwareThreads < SCALING_MIN_WORKERS) printf("\nScaling target (%.0f%% per core from %d workers) not checked, only %d hardware threads\n", 100.0 * SCALING_TARGET, SCALING_MIN_WORKERS, hardwareThreads);
+    printf("\n%s\n", ok ? "Job system results match the serial update" : "Job system mismatch or scaling below target");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,438 @@
+// Micro-benchmark suite for every Math.h operation and the raylib collision primitives
+// Prints one JSON document with ns/op and ops/s per operation, for comparing builds over time
+//
+// Usage: BenchMath [--batch N] [--min-time SECONDS] [--filter TEXT] [--out FILE]
+//   --batch     elements per timed pass (default 4096, stays in L1/L2 like a frame's worth of entities)
+//   --min-time  seconds spent per operation (default 0.05)
+//   --filter    only run operations whose "Group/Name" contains TEXT
+//   --out       write the JSON to FILE and a readable table to stdout
+//
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc /Iinclude bench\BenchMath.cpp
+#include "raylib.h"
+#include "RaylibReference.h"
+#include "MathBatch.h"
+#include "Bench.h"
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct BenchResult {
+    std::string group;
+    std::string name;
+    double nsPerOp;
+    double opsPerSecond;
+};
+
+struct BenchSuite {
+    int batch = 4096;
+    double minSeconds = 0.05;
+    const char* filter = nullptr;
+    std::vector<BenchResult> results;
+
+    // Time fn(i) over the whole batch, storing results so the work cannot be discarded
+    template <typename T, typename Fn>
+    void Run(const char* group, const char* name, std::vector<T>& out, Fn fn)
+    {
+        std::string fullName = std::string(group) + "/" + name;
+        if ((filter != nullptr) && (fullName.find(filter) == std::string::npos)) return;
+
+        T* dst = out.data();
+        int count = batch;
+        double seconds = BenchBest([&]() {
+            for (int i = 0; i < count; i++) dst[i] = fn(i);
+            DoNotOptimize(dst[count - 1]);
+        }, minSeconds);
+
+        double nsPerOp = seconds * 1e9 / count;
+        results.push_back(BenchResult{ group, name, nsPerOp, 1e9 / nsPerOp });
+    }
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static const char* CompilerName(void)
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+#define BENCH_STR2(x) #x
+#define BENCH_STR(x) BENCH_STR2(x)
+    return "msvc " BENCH_STR(_MSC_FULL_VER);
+#else
+    return "unknown";
+#endif
+}
+
+static void WriteJson(FILE* file, const BenchSuite& suite)
+{
+    char timestamp[32] = { 0 };
+    time_t now = time(nullptr);
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"suite\": \"Math.h\",\n");
+    fprintf(file, "  \"timestamp\": \"%s\",\n", timestamp);
+    fprintf(file, "  \"compiler\": \"%s\",\n", CompilerName());
+    fprintf(file, "  \"simd_level\": \"%s\",\n", SimdLevelName(GetSimdLevel()));
+    fprintf(file, "  \"matrix_simd\": %s,\n", MATH_SIMD_SSE ? "true" : "false");
+#if defined(MATH_FAST_TRIG)
+    fprintf(file, "  \"fast_trig\": true,\n");
+#else
+    fprintf(file, "  \"fast_trig\": false,\n");
+#endif
+    fprintf(file, "  \"batch\": %d,\n", suite.batch);
+    fprintf(file, "  \"min_time_s\": %g,\n", suite.minSeconds);
+    fprintf(file, "  \"results\": [\n");
+
+    for (size_t i = 0; i < suite.results.size(); i++)
+    {
+        const BenchResult& r = suite.results[i];
+        fprintf(file, "    { \"group\": \"%s\", \"name\": \"%s\", \"ns_per_op\": %.4f, \"ops_per_s\": %.6g }%s\n",
+            r.group.c_str(), r.name.c_str(), r.nsPerOp, r.opsPerSecond, (i + 1 < suite.results.size()) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+}
+
+static Matrix RandomTransform(void)
+{
+    Vector3 axis = Normalize(Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) });
+    Matrix result = Scale(Random(0.5f, 2.0f), Random(0.5f, 2.0f), Random(0.5f, 2.0f));
+    result = Multiply(result, Rotate(axis, Random(-PI, PI)));
+    result = Multiply(result, Translate(Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f)));
+
+    return result;
+}
+
+static Vector3 RandomDirection3(void)
+{
+    return Normalize(Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) + 0.001f });
+}
+
+// Wrappers that turn the out-parameter functions into values
+static Vector3 OrthoNormalizeValue(Vector3 v1, Vector3 v2)
+{
+    OrthoNormalize(&v1, &v2);
+    return Add(v1, v2);
+}
+
+static Vector4 ToAxisAngleValue(Quaternion q)
+{
+    Vector3 axis;
+    float angle;
+    ToAxisAngle(q, &axis, &angle);
+    return Vector4{ axis.x, axis.y, axis.z, angle };
+}
+
+static Vector2 SinCosValue(float angle)
+{
+    Vector2 result;
+    TrigSinCos(angle, &result.y, &result.x);
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    BenchSuite suite;
+    const char* outPath = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--batch") == 0) && (i + 1 < argc)) suite.batch = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--min-time") == 0) && (i + 1 < argc)) suite.minSeconds = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--filter") == 0) && (i + 1 < argc)) suite.filter = argv[++i];
+        else if ((strcmp(argv[i], "--out") == 0) && (i + 1 < argc)) outPath = argv[++i];
+        else
+        {
+            fprintf(stderr, "Usage: %s [--batch N] [--min-time SECONDS] [--filter TEXT] [--out FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (suite.batch < 1) suite.batch = 1;
+    const int n = suite.batch;
+
+    // Inputs
+    SeedRandom(1005);
+    std::vector<float> fa(n), fb(n), amount(n), angles(n), unit(n), radiusA(n), radiusB(n);
+    std::vector<Vector2> va2(n), vb2(n), da2(n), db2(n);
+    std::vector<Vector3> va3(n), vb3(n), vc3(n), da3(n), db3(n), ndc(n);
+    std::vector<Matrix> ma(n), mb(n);
+    std::vector<Quaternion> qa(n), qb(n);
+    std::vector<Rectangle> ra(n), rb(n);
+    std::vector<Vector2> ta(n), tb(n), tc(n), polygons(n * 8);
+    std::vector<BoundingBox> ba(n), bb(n);
+    std::vector<Ray> rays(n);
+    std::vector<Vec3d> wa(n), wb(n);
+    std::vector<Vec2i> tileA(n), tileB(n);
+    std::vector<Vec4s> sa(n), sb(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        fa[i] = Random(-100.0f, 100.0f);
+        fb[i] = Random(-100.0f, 100.0f);
+        amount[i] = Random(0.0f, 1.0f);
+        angles[i] = Random(-PI, PI);
+        unit[i] = Random(-1.0f, 1.0f);
+        radiusA[i] = Random(1.0f, 20.0f);
+        radiusB[i] = Random(1.0f, 20.0f);
+
+        va2[i] = Vector2{ Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+        vb2[i] = Vector2{ Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+        da2[i] = Direction(Random(-PI, PI));
+        db2[i] = Direction(Random(-PI, PI));
+
+        va3[i] = Vector3{ Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+        vb3[i] = Vector3{ Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+        vc3[i] = Vector3{ Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+        da3[i] = RandomDirection3();
+        db3[i] = RandomDirection3();
+        ndc[i] = Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(0.0f, 1.0f) };
+
+        ma[i] = RandomTransform();
+        mb[i] = RandomTransform();
+        qa[i] = FromAxisAngle(RandomDirection3(), Random(-PI, PI));
+        qb[i] = FromAxisAngle(RandomDirection3(), Random(-PI, PI));
+
+        // Shapes sized so roughly half of the pairwise tests hit
+        ra[i] = Rectangle{ Random(-50.0f, 50.0f), Random(-50.0f, 50.0f), Random(5.0f, 60.0f), Random(5.0f, 60.0f) };
+        rb[i] = Rectangle{ Random(-50.0f, 50.0f), Random(-50.0f, 50.0f), Random(5.0f, 60.0f), Random(5.0f, 60.0f) };
+        ta[i] = Add(va2[i], Vector2{ Random(-40.0f, 40.0f), Random(-40.0f, 40.0f) });
+        tb[i] = Add(va2[i], Vector2{ Random(-40.0f, 40.0f), Random(-40.0f, 40.0f) });
+        tc[i] = Add(va2[i], Vector2{ Random(-40.0f, 40.0f), Random(-40.0f, 40.0f) });
+        for (int k = 0; k < 8; k++) polygons[i * 8 + k] = Add(va2[i], Scale(Direction(2.0f * PI * k / 8.0f), Random(10.0f, 50.0f)));
+
+        Vector3 extentA = { Random(5.0f, 40.0f), Random(5.0f, 40.0f), Random(5.0f, 40.0f) };
+        Vector3 extentB = { Random(5.0f, 40.0f), Random(5.0f, 40.0f), Random(5.0f, 40.0f) };
+        Vector3 centerA = Scale(va3[i], 0.5f), centerB = Scale(vb3[i], 0.5f);
+        ba[i] = BoundingBox{ Subtract(centerA, extentA), Add(centerA, extentA) };
+        bb[i] = BoundingBox{ Subtract(centerB, extentB), Add(centerB, extentB) };
+
+        rays[i].position = Vector3{ Random(-150.0f, 150.0f), Random(-150.0f, 150.0f), Random(-150.0f, 150.0f) };
+        rays[i].direction = Normalize(Subtract(Add(centerA, Scale(RandomDirection3(), 30.0f)), rays[i].position));
+
+        // Double precision world positions, integer tile coordinates
+        wa[i] = Vec3d{ { va3[i].x * 1e4, va3[i].y * 1e4, va3[i].z * 1e4 } };
+        wb[i] = Vec3d{ { vb3[i].x * 1e4, vb3[i].y * 1e4, vb3[i].z * 1e4 } };
+        tileA[i] = Vec2i{ { (int32_t)va2[i].x, (int32_t)va2[i].y } };
+        tileB[i] = Vec2i{ { (int32_t)vb2[i].x, (int32_t)vb2[i].y } };
+        sa[i] = Vec4s{ { (int16_t)fa[i], (int16_t)fb[i], (int16_t)va2[i].x, (int16_t)va2[i].y } };
+        sb[i] = Vec4s{ { (int16_t)vb2[i].x, (int16_t)vb2[i].y, (int16_t)fb[i], (int16_t)fa[i] } };
+    }
+
+    Matrix projection = Perspective(45.0 * DEG2RAD, 16.0 / 9.0, 0.01, 1000.0);
+    Matrix view = LookAt(Vector3{ 10.0f, 12.0f, 10.0f }, Vector3Zero(), Vector3{ 0.0f, 1.0f, 0.0f });
+    Vector3 up = { 0.0f, 1.0f, 0.0f };
+
+    // Outputs
+    std::vector<float> of(n);
+    std::vector<int> oi(n);
+    std::vector<char> ob(n);
+    std::vector<Vector2> ov2(n);
+    std::vector<Vector3> ov3(n);
+    std::vector<Vector4> ov4(n);
+    std::vector<Matrix> om(n);
+    std::vector<Quaternion> oq(n);
+    std::vector<float3> of3(n);
+    std::vector<float16> of16(n);
+    std::vector<RayCollision> orc(n);
+    std::vector<double> od(n);
+    std::vector<Vec3d> ow(n);
+    std::vector<Vec2i> otile(n);
+    std::vector<Vec4s> os(n);
+
+#define BENCH(group, name, out, expr) suite.Run(group, name, out, [&](int i) { return expr; })
+
+    // Utils
+    BENCH("Utils", "Random", of, Random(fa[i], fb[i]));
+    BENCH("Utils", "Clamp(float)", of, Clamp(fa[i], -50.0f, 50.0f));
+    BENCH("Utils", "Lerp(float)", of, Lerp(fa[i], fb[i], amount[i]));
+    BENCH("Utils", "Normalize(float)", of, Normalize(fa[i], -100.0f, fb[i]));
+    BENCH("Utils", "Remap", of, Remap(fa[i], -100.0f, 100.0f, 0.0f, fb[i]));
+    BENCH("Utils", "Wrap", of, Wrap(fa[i], -PI, PI));
+    BENCH("Utils", "Equals(float)", oi, Equals(fa[i], fb[i]));
+    BENCH("Utils", "TrigSinCos", ov2, SinCosValue(angles[i]));
+    BENCH("Utils", "TrigAtan2", of, TrigAtan2(fa[i], fb[i]));
+    BENCH("Utils", "TrigAcos", of, TrigAcos(unit[i]));
+    BENCH("Utils", "Sign", of, Sign(fa[i]));
+
+    // Vector2
+    BENCH("Vector2", "Vector2Zero", ov2, Vector2Zero());
+    BENCH("Vector2", "Vector2One", ov2, Vector2One());
+    BENCH("Vector2", "ToV3", ov3, ToV3(va2[i]));
+    BENCH("Vector2", "FromV3", ov2, FromV3(va3[i]));
+    BENCH("Vector2", "Add(Vector2, Vector2)", ov2, Add(va2[i], vb2[i]));
+    BENCH("Vector2", "Add(Vector2, float)", ov2, Add(va2[i], fa[i]));
+    BENCH("Vector2", "Subtract(Vector2, Vector2)", ov2, Subtract(va2[i], vb2[i]));
+    BENCH("Vector2", "Subtract(Vector2, float)", ov2, Subtract(va2[i], fa[i]));
+    BENCH("Vector2", "Length", of, Length(va2[i]));
+    BENCH("Vector2", "LengthSqr", of, LengthSqr(va2[i]));
+    BENCH("Vector2", "Dot", of, Dot(va2[i], vb2[i]));
+    BENCH("Vector2", "Cross", of, Cross(va2[i], vb2[i]));
+    BENCH("Vector2", "Distance", of, Distance(va2[i], vb2[i]));
+    BENCH("Vector2", "DistanceSqr", of, DistanceSqr(va2[i], vb2[i]));
+    BENCH("Vector2", "Direction", ov2, Direction(angles[i]));
+    BENCH("Vector2", "Angle", of, Angle(va2[i]));
+    BENCH("Vector2", "UnsignedAngle", of, UnsignedAngle(da2[i], db2[i]));
+    BENCH("Vector2", "SignedAngle", of, SignedAngle(da2[i], db2[i]));
+    BENCH("Vector2", "Scale", ov2, Scale(va2[i], fa[i]));
+    BENCH("Vector2", "Project", ov2, Project(va2[i], vb2[i]));
+    BENCH("Vector2", "ProjectPointLine", ov2, ProjectPointLine(va2[i], vb2[i], ta[i]));
+    BENCH("Vector2", "Multiply(Vector2, Vector2)", ov2, Multiply(va2[i], vb2[i]));
+    BENCH("Vector2", "Negate", ov2, Negate(va2[i]));
+    BENCH("Vector2", "Divide", ov2, Divide(va2[i], vb2[i]));
+    BENCH("Vector2", "Normalize", ov2, Normalize(va2[i]));
+    BENCH("Vector2", "Multiply(Vector2, Matrix)", ov2, Multiply(va2[i], ma[i]));
+    BENCH("Vector2", "Lerp", ov2, Lerp(va2[i], vb2[i], amount[i]));
+    BENCH("Vector2", "Reflect", ov2, Reflect(va2[i], da2[i]));
+    BENCH("Vector2", "Rotate", ov2, Rotate(va2[i], angles[i]));
+    BENCH("Vector2", "MoveTowards", ov2, MoveTowards(va2[i], vb2[i], 10.0f));
+    BENCH("Vector2", "RotateTowards", ov2, RotateTowards(da2[i], db2[i], 0.1f));
+    BENCH("Vector2", "Invert", ov2, Invert(va2[i]));
+    BENCH("Vector2", "Clamp(Vector2, Vector2, Vector2)", ov2, Clamp(va2[i], Vector2{ -50.0f, -50.0f }, Vector2{ 50.0f, 50.0f }));
+    BENCH("Vector2", "Clamp(Vector2, float, float)", ov2, Clamp(va2[i], 10.0f, 50.0f));
+    BENCH("Vector2", "Equals", ob, Equals(va2[i], vb2[i]));
+
+    // Vector3
+    BENCH("Vector3", "Vector3Zero", ov3, Vector3Zero());
+    BENCH("Vector3", "Vector3One", ov3, Vector3One());
+    BENCH("Vector3", "Add(Vector3, Vector3)", ov3, Add(va3[i], vb3[i]));
+    BENCH("Vector3", "Add(Vector3, float)", ov3, Add(va3[i], fa[i]));
+    BENCH("Vector3", "Subtract(Vector3, Vector3)", ov3, Subtract(va3[i], vb3[i]));
+    BENCH("Vector3", "Subtract(Vector3, float)", ov3, Subtract(va3[i], fa[i]));
+    BENCH("Vector3", "Scale", ov3, Scale(va3[i], fa[i]));
+    BENCH("Vector3", "Multiply(Vector3, Vector3)", ov3, Multiply(va3[i], vb3[i]));
+    BENCH("Vector3", "Cross", ov3, Cross(va3[i], vb3[i]));
+    BENCH("Vector3", "Perpendicular", ov3, Perpendicular(va3[i]));
+    BENCH("Vector3", "Length", of, Length(va3[i]));
+    BENCH("Vector3", "LengthSqr", of, LengthSqr(va3[i]));
+    BENCH("Vector3", "Dot", of, Dot(va3[i], vb3[i]));
+    BENCH("Vector3", "Distance", of, Distance(va3[i], vb3[i]));
+    BENCH("Vector3", "DistanceSqr", of, DistanceSqr(va3[i], vb3[i]));
+    BENCH("Vector3", "Project", ov3, Project(va3[i], vb3[i]));
+    BENCH("Vector3", "ProjectPointLine", ov3, ProjectPointLine(va3[i], vb3[i], vc3[i]));
+    BENCH("Vector3", "Angle", of, Angle(va3[i], vb3[i]));
+    BENCH("Vector3", "Negate", ov3, Negate(va3[i]));
+    BENCH("Vector3", "Divide", ov3, Divide(va3[i], vb3[i]));
+    BENCH("Vector3", "Normalize", ov3, Normalize(va3[i]));
+    BENCH("Vector3", "OrthoNormalize", ov3, OrthoNormalizeValue(da3[i], db3[i]));
+    BENCH("Vector3", "Multiply(Vector3, Matrix)", ov3, Multiply(va3[i], ma[i]));
+    BENCH("Vector3", "Rotate(Vector3, Quaternion)", ov3, Rotate(va3[i], qa[i]));
+    BENCH("Vector3", "Rotate(Vector3, Vector3, float)", ov3, Rotate(va3[i], da3[i], angles[i]));
+    BENCH("Vector3", "Lerp", ov3, Lerp(va3[i], vb3[i], amount[i]));
+    BENCH("Vector3", "Reflect", ov3, Reflect(va3[i], da3[i]));
+    BENCH("Vector3", "Min", ov3, Min(va3[i], vb3[i]));
+    BENCH("Vector3", "Max", ov3, Max(va3[i], vb3[i]));
+    BENCH("Vector3", "Barycenter", ov3, Barycenter(vc3[i], va3[i], vb3[i], Vector3{ 0.0f, 0.0f, 1.0f }));
+    BENCH("Vector3", "Unproject", ov3, Unproject(ndc[i], projection, view));
+    BENCH("Vector3", "ToFloatV", of3, ToFloatV(va3[i]));
+    BENCH("Vector3", "Invert", ov3, Invert(va3[i]));
+    BENCH("Vector3", "Clamp(Vector3, Vector3, Vector3)", ov3, Clamp(va3[i], Vector3{ -50.0f, -50.0f, -50.0f }, Vector3{ 50.0f, 50.0f, 50.0f }));
+    BENCH("Vector3", "Clamp(Vector3, float, float)", ov3, Clamp(va3[i], 10.0f, 50.0f));
+    BENCH("Vector3", "Equals", oi, Equals(va3[i], vb3[i]));
+    BENCH("Vector3", "Refract", ov3, Refract(da3[i], db3[i], 0.75f));
+
+    // Matrix
+    BENCH("Matrix", "Determinant", of, Determinant(ma[i]));
+    BENCH("Matrix", "Trace", of, Trace(ma[i]));
+    BENCH("Matrix", "Transpose", om, Transpose(ma[i]));
+    BENCH("Matrix", "InvertScalar", om, InvertScalar(ma[i]));
+    BENCH("Matrix", "Invert", om, Invert(ma[i]));
+    BENCH("Matrix", "MatrixIdentity", om, MatrixIdentity());
+    BENCH("Matrix", "Add", om, Add(ma[i], mb[i]));
+    BENCH("Matrix", "Subtract", om, Subtract(ma[i], mb[i]));
+    BENCH("Matrix", "MultiplyScalar", om, MultiplyScalar(ma[i], mb[i]));
+    BENCH("Matrix", "Multiply", om, Multiply(ma[i], mb[i]));
+    BENCH("Matrix", "Translate", om, Translate(va3[i].x, va3[i].y, va3[i].z));
+    BENCH("Matrix", "Rotate", om, Rotate(da3[i], angles[i]));
+    BENCH("Matrix", "RotateX", om, RotateX(angles[i]));
+    BENCH("Matrix", "RotateY", om, RotateY(angles[i]));
+    BENCH("Matrix", "RotateZ", om, RotateZ(angles[i]));
+    BENCH("Matrix", "RotateXYZ", om, RotateXYZ(Vector3{ angles[i], unit[i], amount[i] }));
+    BENCH("Matrix", "RotateZYX", om, RotateZYX(Vector3{ angles[i], unit[i], amount[i] }));
+    BENCH("Matrix", "Scale", om, Scale(va3[i].x, va3[i].y, va3[i].z));
+    BENCH("Matrix", "Frustum", om, Frustum(-1.0, 1.0, -1.0, 1.0, 0.1 + amount[i], 1000.0));
+    BENCH("Matrix", "Perspective", om, Perspective(0.5 + amount[i], 16.0 / 9.0, 0.01, 1000.0));
+    BENCH("Matrix", "Ortho", om, Ortho(-fa[i], fa[i], -fb[i], fb[i], 0.01, 1000.0));
+    BENCH("Matrix", "LookAt", om, LookAt(va3[i], vb3[i], up));
+    BENCH("Matrix", "ToFloatV", of16, ToFloatV(ma[i]));
+
+    // Quaternion
+    BENCH("Quaternion", "Add(Quaternion, Quaternion)", oq, Add(qa[i], qb[i]));
+    BENCH("Quaternion", "Add(Quaternion, float)", oq, Add(qa[i], fa[i]));
+    BENCH("Quaternion", "Subtract(Quaternion, Quaternion)", oq, Subtract(qa[i], qb[i]));
+    BENCH("Quaternion", "Subtract(Quaternion, float)", oq, Subtract(qa[i], fa[i]));
+    BENCH("Quaternion", "QuaternionIdentity", oq, QuaternionIdentity());
+    BENCH("Quaternion", "Length", of, Length(qa[i]));
+    BENCH("Quaternion", "Normalize", oq, Normalize(qa[i]));
+    BENCH("Quaternion", "Invert", oq, Invert(qa[i]));
+    BENCH("Quaternion", "Multiply", oq, Multiply(qa[i], qb[i]));
+    BENCH("Quaternion", "Scale", oq, Scale(qa[i], fa[i]));
+    BENCH("Quaternion", "Divide", oq, Divide(qa[i], qb[i]));
+    BENCH("Quaternion", "Lerp", oq, Lerp(qa[i], qb[i], amount[i]));
+    BENCH("Quaternion", "Nlerp", oq, Nlerp(qa[i], qb[i], amount[i]));
+    BENCH("Quaternion", "Slerp", oq, Slerp(qa[i], qb[i], amount[i]));
+    BENCH("Quaternion", "FromTo", oq, FromTo(da3[i], db3[i]));
+    BENCH("Quaternion", "FromMatrix", oq, FromMatrix(ma[i]));
+    BENCH("Quaternion", "ToMatrix", om, ToMatrix(qa[i]));
+    BENCH("Quaternion", "FromAxisAngle", oq, FromAxisAngle(da3[i], angles[i]));
+    BENCH("Quaternion", "ToAxisAngle", ov4, ToAxisAngleValue(qa[i]));
+    BENCH("Quaternion", "FromEuler", oq, FromEuler(angles[i], unit[i], amount[i]));
+    BENCH("Quaternion", "ToEuler", ov3, ToEuler(qa[i]));
+    BENCH("Quaternion", "Multiply(Quaternion, Matrix)", oq, Multiply(qa[i], ma[i]));
+    BENCH("Quaternion", "Equals", oi, Equals(qa[i], qb[i]));
+
+    // Vec<N, T> instantiations the raylib types do not cover
+    BENCH("Vec", "Add(Vec2i, Vec2i)", otile, Add(tileA[i], tileB[i]));
+    BENCH("Vec", "Scale(Vec2i, int)", otile, Scale(tileA[i], 3));
+    BENCH("Vec", "Add(Vec4s, Vec4s)", os, Add(sa[i], sb[i]));
+    BENCH("Vec", "Lerp(Vec3d)", ow, Lerp(wa[i], wb[i], (double)amount[i]));
+    BENCH("Vec", "DistanceSqr(Vec3d)", od, DistanceSqr(wa[i], wb[i]));
+    BENCH("Vec", "Min(Vec3d)", ow, Min(wa[i], wb[i]));
+
+    // Collision primitives (raylib reference implementations)
+    BENCH("Collision", "CheckCollisionRecs", ob, ref::CheckCollisionRecs(ra[i], rb[i]));
+    BENCH("Collision", "CheckCollisionCircles", ob, ref::CheckCollisionCircles(va2[i], radiusA[i], vb2[i], radiusB[i]));
+    BENCH("Collision", "CheckCollisionCircleRec", ob, ref::CheckCollisionCircleRec(va2[i], radiusA[i], ra[i]));
+    BENCH("Collision", "CheckCollisionPointRec", ob, ref::CheckCollisionPointRec(va2[i], ra[i]));
+    BENCH("Collision", "CheckCollisionPointCircle", ob, ref::CheckCollisionPointCircle(va2[i], vb2[i], radiusA[i] * 4.0f));
+    BENCH("Collision", "CheckCollisionPointTriangle", ob, ref::CheckCollisionPointTriangle(va2[i], ta[i], tb[i], tc[i]));
+    BENCH("Collision", "CheckCollisionPointPoly", ob, ref::CheckCollisionPointPoly(vb2[i], &polygons[i * 8], 8));
+    BENCH("Collision", "CheckCollisionLines", ob, ref::CheckCollisionLines(va2[i], vb2[i], ta[i], tb[i], &ov2[i]));
+    BENCH("Collision", "CheckCollisionPointLine", ob, ref::CheckCollisionPointLine(tc[i], ta[i], tb[i], 4));
+    BENCH("Collision", "CheckCollisionSpheres", ob, ref::CheckCollisionSpheres(va3[i], radiusA[i] * 4.0f, vb3[i], radiusB[i] * 4.0f));
+    BENCH("Collision", "CheckCollisionBoxes", ob, ref::CheckCollisionBoxes(ba[i], bb[i]));
+    BENCH("Collision", "CheckCollisionBoxSphere", ob, ref::CheckCollisionBoxSphere(ba[i], vb3[i], radiusA[i] * 4.0f));
+    BENCH("Collision", "GetRayCollisionSphere", orc, ref::GetRayCollisionSphere(rays[i], va3[i], radiusA[i] * 2.0f));
+    BENCH("Collision", "GetRayCollisionBox", orc, ref::GetRayCollisionBox(rays[i], ba[i]));
+    BENCH("Collision", "GetRayCollisionTriangle", orc, ref::GetRayCollisionTriangle(rays[i], va3[i], vb3[i], vc3[i]));
+    BENCH("Collision", "GetRayCollisionQuad", orc, ref::GetRayCollisionQuad(rays[i], ba[i].min, Vector3{ ba[i].max.x, ba[i].min.y, ba[i].min.z },
+        ba[i].max, Vector3{ ba[i].min.x, ba[i].max.y, ba[i].max.z }));
+
+#undef BENCH
+
+    if (outPath != nullptr)
+    {
+        FILE* file = fopen(outPath, "w");
+        if (file == nullptr)
+        {
+            fprintf(stderr, "Cannot write %s\n", outPath);
+            return 1;
+        }
+        WriteJson(file, suite);
+        fclose(file);
+
+        printf("%-12s %-36s %10s %14s\n", "Group", "Operation", "ns/op", "ops/s");
+        for (const BenchResult& r : suite.results) printf("%-12s %-36s %10.3f %14.4g\n", r.group.c_str(), r.name.c_str(), r.nsPerOp, r.opsPerSecond);
+    }
+    else WriteJson(stdout, suite);
+
+    return 0;
+}
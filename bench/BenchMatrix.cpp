@@ -0,0 +1,95 @@
+// Benchmark and validation of the SIMD Matrix Multiply/Invert paths against the scalar reference
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchMatrix.cpp
+#include "Math.h"
+#include "Bench.h"
+#include <vector>
+
+static const int MATRIX_COUNT = 4096;
+
+// Largest element-wise difference, relative to the magnitude of the reference element
+static float MatrixError(Matrix a, Matrix reference)
+{
+    const float* pa = &a.m0;
+    const float* pr = &reference.m0;
+
+    float maxError = 0.0f;
+    for (int i = 0; i < 16; i++) maxError = fmaxf(maxError, fabsf(pa[i] - pr[i]) / fmaxf(1.0f, fabsf(pr[i])));
+
+    return maxError;
+}
+
+// Typical scene transform: scale, rotation and translation
+static Matrix RandomTransform(void)
+{
+    Vector3 axis = { Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) };
+    Matrix result = Scale(Random(0.5f, 2.0f), Random(0.5f, 2.0f), Random(0.5f, 2.0f));
+    result = MultiplyScalar(result, Rotate(axis, Random(-PI, PI)));
+    result = MultiplyScalar(result, Translate(Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f)));
+
+    return result;
+}
+
+int main()
+{
+    std::vector<Matrix> a(MATRIX_COUNT), b(MATRIX_COUNT), out(MATRIX_COUNT);
+
+    SeedRandom(1005);
+    for (int i = 0; i < MATRIX_COUNT; i++)
+    {
+        a[i] = RandomTransform();
+        b[i] = RandomTransform();
+    }
+
+    const char* path = MATH_SIMD_SSE ? (SIMD_AVX2 ? "SSE (VEX)" : "SSE") : "Scalar";
+    printf("Matrix kernels, %d matrices, compiled path %s\n\n", MATRIX_COUNT, path);
+
+    // Accuracy: the Invert check uses the relative error of the inverse of a well-conditioned matrix
+    float multiplyError = 0.0f;
+    float invertError = 0.0f;
+    for (int i = 0; i < MATRIX_COUNT; i++)
+    {
+        multiplyError = fmaxf(multiplyError, MatrixError(Multiply(a[i], b[i]), MultiplyScalar(a[i], b[i])));
+        invertError = fmaxf(invertError, MatrixError(Invert(a[i]), InvertScalar(a[i])));
+    }
+
+    double scalarMul = BenchBest([&]() {
+        for (int i = 0; i < MATRIX_COUNT; i++) out[i] = MultiplyScalar(a[i], b[i]);
+        DoNotOptimize(out[MATRIX_COUNT - 1]);
+    });
+    double simdMul = BenchBest([&]() {
+        for (int i = 0; i < MATRIX_COUNT; i++) out[i] = Multiply(a[i], b[i]);
+        DoNotOptimize(out[MATRIX_COUNT - 1]);
+    });
+    double scalarInv = BenchBest([&]() {
+        for (int i = 0; i < MATRIX_COUNT; i++) out[i] = InvertScalar(a[i]);
+        DoNotOptimize(out[MATRIX_COUNT - 1]);
+    });
+    double simdInv = BenchBest([&]() {
+        for (int i = 0; i < MATRIX_COUNT; i++) out[i] = Invert(a[i]);
+        DoNotOptimize(out[MATRIX_COUNT - 1]);
+    });
+
+    // Dependent chain, as in a transform hierarchy walk
+    double scalarChain = BenchBest([&]() {
+        Matrix world = MatrixIdentity();
+        for (int i = 0; i < MATRIX_COUNT; i++) world = MultiplyScalar(a[i], world);
+        DoNotOptimize(world);
+    });
+    double simdChain = BenchBest([&]() {
+        Matrix world = MatrixIdentity();
+        for (int i = 0; i < MATRIX_COUNT; i++) world = Multiply(a[i], world);
+        DoNotOptimize(world);
+    });
+
+    double toNs = 1e9 / MATRIX_COUNT;
+    printf("%-18s %10s %10s %8s\n", "", "scalar ns", "simd ns", "speedup");
+    printf("%-18s %10.2f %10.2f %7.2fx\n", "Multiply", scalarMul * toNs, simdMul * toNs, scalarMul / simdMul);
+    printf("%-18s %10.2f %10.2f %7.2fx\n", "Multiply (chain)", scalarChain * toNs, simdChain * toNs, scalarChain / simdChain);
+    printf("%-18s %10.2f %10.2f %7.2fx\n", "Invert", scalarInv * toNs, simdInv * toNs, scalarInv / simdInv);
+    printf("\nmax error: Multiply %.2e, Invert %.2e\n", multiplyError, invertError);
+
+    bool ok = (multiplyError <= EPSILON) && (invertError <= 16 * EPSILON);
+    printf("%s\n", ok ? "SIMD paths match the scalar reference" : "Mismatch against the scalar reference");
+
+    return ok ? 0 : 1;
+}
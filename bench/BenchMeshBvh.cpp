@@ -0,0 +1,299 @@
+// Benchmark and validation of the mesh BVH (src/MeshBvh.h)
+// A 200k triangle level (heightmap terrain and crates, not indexed) and an indexed torus.
+// Picking rays from a camera, line of sight rays between points above the ground and rays
+// straight down through the grid vertices (hits on shared edges and corners) are tested by
+// raylib's GetRayCollisionMesh() and by the BVH: every hit must match exactly with an identity
+// transform (build without FP contraction, as CMakeLists.txt does) and within rounding with a
+// rotated, scaled and moved model. Then per ray times, batches and batches on all workers
+// of the job system
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc /Iinclude bench\BenchMeshBvh.cpp
+#include "MeshBvh.h"
+#include "RaylibReference.h"
+#include "Bench.h"
+#include <cstring>
+#include <vector>
+
+static const int TERRAIN_QUADS = 312;          // Per side, 2*312^2 = 194688 triangles
+static const float TERRAIN_SIZE = 400.0f;
+static const int CRATE_COUNT = 450;             // 12 triangles each
+static const int RAY_COUNT = 200;               // Rays per set checked against GetRayCollisionMesh()
+static const int BATCH_COUNT = 100000;
+static const int LARGE_BATCH_COUNT = 1000000;  // More than JOB_POOL_SIZE pieces of the old fixed grain (64)
+
+// Vertex storage of a raylib Mesh
+struct MeshData {
+    std::vector<Vector3> vertices;
+    std::vector<unsigned short> indices;
+    Mesh mesh;
+};
+
+static void FinishMesh(MeshData* data)
+{
+    memset(&data->mesh, 0, sizeof(Mesh));
+    data->mesh.vertices = (float*)data->vertices.data();
+    data->mesh.vertexCount = (int)data->vertices.size();
+    if (data->indices.empty()) data->mesh.triangleCount = (int)data->vertices.size()/3;
+    else
+    {
+        data->mesh.indices = data->indices.data();
+        data->mesh.triangleCount = (int)data->indices.size()/3;
+    }
+}
+
+static float TerrainHeight(float x, float z)
+{
+    return 6.0f*sinf(x*0.05f)*cosf(z*0.04f) + 2.0f*sinf(x*0.23f + z*0.17f);
+}
+
+static Vector3 TerrainVertex(int i, int j)
+{
+    float step = TERRAIN_SIZE/TERRAIN_QUADS;
+    float x = -0.5f*TERRAIN_SIZE + i*step;
+    float z = -0.5f*TERRAIN_SIZE + j*step;
+
+    return Vector3{ x, TerrainHeight(x, z), z };
+}
+
+static void PushQuad(MeshData* data, Vector3 a, Vector3 b, Vector3 c, Vector3 d)
+{
+    Vector3 quad[6] = { a, b, c, a, c, d };
+    data->vertices.insert(data->vertices.end(), quad, quad + 6);
+}
+
+// Heightmap terrain and crates resting on it, triangle soup like GenMeshHeightmap()
+static MeshData MakeLevel()
+{
+    MeshData data;
+    for (int i = 0; i < TERRAIN_QUADS; i++)
+    {
+        for (int j = 0; j < TERRAIN_QUADS; j++) PushQuad(&data, TerrainVertex(i, j), TerrainVertex(i, j + 1), TerrainVertex(i + 1, j + 1), TerrainVertex(i + 1, j));
+    }
+
+    for (int c = 0; c < CRATE_COUNT; c++)
+    {
+        float s = Random(1.0f, 6.0f);
+        float x = Random(-180.0f, 180.0f), z = Random(-180.0f, 180.0f);
+        Vector3 lo = { x - s, TerrainHeight(x, z) - 1.0f, z - s };
+        Vector3 hi = { x + s, lo.y + 2.0f*s, z + s };
+        Vector3 p[8];
+        for (int k = 0; k < 8; k++) p[k] = Vector3{ (k & 1) ? hi.x : lo.x, (k & 2) ? hi.y : lo.y, (k & 4) ? hi.z : lo.z };
+        PushQuad(&data, p[0], p[4], p[6], p[2]);
+        PushQuad(&data, p[1], p[3], p[7], p[5]);
+        PushQuad(&data, p[0], p[1], p[5], p[4]);
+        PushQuad(&data, p[2], p[6], p[7], p[3]);
+        PushQuad(&data, p[0], p[2], p[3], p[1]);
+        PushQuad(&data, p[4], p[5], p[7], p[6]);
+    }
+    FinishMesh(&data);
+
+    return data;
+}
+
+// Indexed torus like GenMeshTorus(), radius 10, tube 3
+static MeshData MakeTorus(int rings, int sides)
+{
+    MeshData data;
+    for (int r = 0; r <= rings; r++)
+    {
+        for (int s = 0; s <= sides; s++)
+        {
+            float u = 2.0f*PI*r/rings, v = 2.0f*PI*s/sides;
+            data.vertices.push_back(Vector3{ (10.0f + 3.0f*cosf(v))*cosf(u), 3.0f*sinf(v), (10.0f + 3.0f*cosf(v))*sinf(u) });
+        }
+    }
+    for (int r = 0; r < rings; r++)
+    {
+        for (int s = 0; s < sides; s++)
+        {
+            unsigned short a = (unsigned short)(r*(sides + 1) + s), b = (unsigned short)(a + sides + 1);
+            unsigned short quad[6] = { a, b, (unsigned short)(b + 1), a, (unsigned short)(b + 1), (unsigned short)(a + 1) };
+            data.indices.insert(data.indices.end(), quad, quad + 6);
+        }
+    }
+    FinishMesh(&data);
+
+    return data;
+}
+
+static Vector3 RandomInBox(Vector3 lo, Vector3 hi)
+{
+    return Vector3{ Random(lo.x, hi.x), Random(lo.y, hi.y), Random(lo.z, hi.z) };
+}
+
+// Picking from a camera above the level, line of sight between points a little above the
+// ground, straight down through grid vertices
+static std::vector<Ray> MakeLevelRays(int count)
+{
+    std::vector<Ray> rays(count);
+    for (int i = 0; i < count; i++)
+    {
+        Ray& ray = rays[i];
+        if (i % 3 == 0)
+        {
+            ray.position = Vector3{ Random(-50.0f, 50.0f), 80.0f, Random(-250.0f, -150.0f) };
+            ray.direction = Normalize(RandomInBox(Vector3{ -200.0f, -10.0f, -200.0f }, Vector3{ 200.0f, 10.0f, 200.0f }) - ray.position);
+        }
+        else if (i % 3 == 1)
+        {
+            float x = Random(-190.0f, 190.0f), z = Random(-190.0f, 190.0f);
+            ray.position = Vector3{ x, TerrainHeight(x, z) + 1.8f, z };
+            float x2 = Random(-190.0f, 190.0f), z2 = Random(-190.0f, 190.0f);
+            ray.direction = Normalize(Vector3{ x2, TerrainHeight(x2, z2) + 1.8f, z2 } - ray.position);
+        }
+        else
+        {
+            Vector3 v = TerrainVertex((int)Random(1.0f, (float)TERRAIN_QUADS), (int)Random(1.0f, (float)TERRAIN_QUADS));
+            ray.position = Vector3{ v.x, 50.0f, v.z };
+            ray.direction = Vector3{ 0.0f, -1.0f, 0.0f };
+        }
+    }
+
+    return rays;
+}
+
+static std::vector<Ray> MakeTorusRays(int count)
+{
+    std::vector<Ray> rays(count);
+    for (Ray& ray : rays)
+    {
+        ray.position = RandomInBox(Vector3{ -30.0f, -30.0f, -30.0f }, Vector3{ 30.0f, 30.0f, 30.0f });
+        ray.direction = Normalize(RandomInBox(Vector3{ -12.0f, -4.0f, -12.0f }, Vector3{ 12.0f, 4.0f, 12.0f }) - ray.position);
+    }
+
+    return rays;
+}
+
+// Rays made for the mesh, moved along with the model
+static std::vector<Ray> TransformRays(std::vector<Ray> rays, Matrix transform)
+{
+    for (Ray& ray : rays)
+    {
+        Vector3 position = Multiply(ray.position, transform);
+        ray.direction = Normalize(Multiply(ray.position + ray.direction, transform) - position);
+        ray.position = position;
+    }
+
+    return rays;
+}
+
+static bool SameBits(Vector3 a, Vector3 b)
+{
+    return memcmp(&a, &b, sizeof(Vector3)) == 0;
+}
+
+static bool SameCollision(RayCollision a, RayCollision b, bool exact)
+{
+    if (a.hit != b.hit) return false;
+    if (!a.hit) return true;
+    if (exact) return (a.distance == b.distance) && SameBits(a.point, b.point) && SameBits(a.normal, b.normal);
+
+    return (fabsf(a.distance - b.distance) <= 1e-4f*fmaxf(1.0f, a.distance)) && (Dot(a.normal, b.normal) > 0.999f);
+}
+
+// Every ray against GetRayCollisionMesh(), returns the mismatch count and the reference time per ray
+static int CheckRays(const MeshData& data, const MeshBvh& bvh, const std::vector<Ray>& rays, Matrix transform, bool exact, double* refTime, int* hits)
+{
+    int mismatches = 0;
+    *hits = 0;
+    double t0 = BenchTime();
+    for (const Ray& ray : rays)
+    {
+        RayCollision expected = ref::GetRayCollisionMesh(ray, data.mesh, transform);
+        RayCollision found = GetRayCollisionMeshBvh(ray, &bvh, transform);
+        mismatches += !SameCollision(found, expected, exact);
+        *hits += expected.hit;
+    }
+    *refTime = (BenchTime() - t0)/rays.size();
+
+    return mismatches;
+}
+
+static bool RunMesh(const char* name, const MeshData& data, std::vector<Ray> (*makeRays)(int), Matrix transform, JobSystem* jobs)
+{
+    MeshBvh bvh = {};
+    double buildTime = BenchBest([&]() { bvh = CreateMeshBvh(data.mesh); }, 0.0);
+
+    // Identity must match exactly, the model transform within rounding: a grazing ray can
+    // flip between two triangles of an edge, allow one in a thousand
+    std::vector<Ray> rays = makeRays(RAY_COUNT);
+    double refTime = 0.0, refTimeMoved = 0.0;
+    int hits = 0, hitsMoved = 0;
+    int mismatches = CheckRays(data, bvh, rays, MatrixIdentity(), true, &refTime, &hits);
+    std::vector<Ray> movedRays = TransformRays(rays, transform);
+    int movedMismatches = CheckRays(data, bvh, movedRays, transform, false, &refTimeMoved, &hitsMoved);
+    bool ok = (mismatches == 0) && (movedMismatches*1000 <= RAY_COUNT);
+
+    // Throughput on many rays
+    std::vector<Ray> batch = TransformRays(makeRays(BATCH_COUNT), transform);
+    std::vector<RayCollision> collisions(BATCH_COUNT), parallel(BATCH_COUNT);
+    double singleTime = BenchBest([&]() {
+        for (int i = 0; i < BATCH_COUNT; i++) collisions[i] = GetRayCollisionMeshBvh(batch[i], &bvh, transform);
+        DoNotOptimize(collisions.data());
+    });
+    double batchTime = BenchBest([&]() { GetRayCollisionMeshBvhBatch(batch.data(), collisions.data(), BATCH_COUNT, &bvh, transform); DoNotOptimize(collisions.data()); });
+    double parallelTime = BenchBest([&]() { GetRayCollisionMeshBvhParallel(batch.data(), parallel.data(), BATCH_COUNT, &bvh, transform, jobs); DoNotOptimize(parallel.data()); });
+    for (int i = 0; i < BATCH_COUNT; i++) ok = ok && SameCollision(parallel[i], collisions[i], true);
+
+    int leaves = 0;
+    for (const BvhNode& node : bvh.nodes) leaves += (node.count > 0);
+    printf("%-8s %8d %8.1f %6d %5d %5.2f %11.1f %9.3f %9.0fx %8.2f %8.2f %8.2f %4d/%d %s\n", name, data.mesh.triangleCount, buildTime*1e3,
+        (int)bvh.nodes.size(), bvh.depth, (double)data.mesh.triangleCount/leaves, refTime*1e6, singleTime*1e6/BATCH_COUNT, refTimeMoved/(singleTime/BATCH_COUNT),
+        BATCH_COUNT/singleTime*1e-6, BATCH_COUNT/batchTime*1e-6, BATCH_COUNT/parallelTime*1e-6, hits, RAY_COUNT, ok ? "" : "FAIL");
+    if (mismatches || movedMismatches) printf("  %d identity and %d transformed mismatches\n", mismatches, movedMismatches);
+
+    DestroyMeshBvh(&bvh);
+
+    return ok;
+}
+
+int main()
+{
+    bool ok = true;
+    SeedRandom(1005);
+    JobSystem* jobs = CreateJobSystem(0);
+
+    MeshData level = MakeLevel();
+    MeshData torus = MakeTorus(128, 64);
+    Matrix transform = Multiply(Multiply(Scale(1.5f, 0.8f, 1.2f), RotateXYZ(Vector3{ 0.3f, 1.1f, -0.2f })), Translate(20.0f, -5.0f, 40.0f));
+
+    printf("Mesh BVH, %d bins, leaves of up to %d triangles, %d rays checked against GetRayCollisionMesh(), %d workers\n", BVH_BIN_COUNT, BVH_MAX_LEAF_SIZE, RAY_COUNT,
+        GetJobWorkerCount(jobs));
+    printf("raylib: us per ray, speedup: raylib against BVH with a rotated and scaled model, Mrays/s over %d rays\n\n", BATCH_COUNT);
+    printf("%-8s %8s %8s %6s %5s %5s %11s %9s %10s %8s %8s %8s %s\n", "mesh", "tris", "build ms", "nodes", "depth", "leaf", "raylib us", "bvh us", "speedup", "single", "batch", "jobs", "hits");
+
+    ok = RunMesh("level", level, MakeLevelRays, transform, jobs) && ok;
+    ok = RunMesh("torus", torus, MakeTorusRays, transform, jobs) && ok;
+
+    // One large parallel batch, every ray straight down onto the terrain must hit as the serial call does
+    {
+        MeshBvh bvh = CreateMeshBvh(level.mesh);
+        std::vector<Ray> batch(LARGE_BATCH_COUNT, Ray{ Vector3{ 10.0f, 500.0f, 10.0f }, Vector3{ 0.0f, -1.0f, 0.0f } });
+        std::vector<RayCollision> collisions(LARGE_BATCH_COUNT);
+        RayCollision expected = GetRayCollisionMeshBvh(batch[0], &bvh, MatrixIdentity());
+        GetRayCollisionMeshBvhParallel(batch.data(), collisions.data(), LARGE_BATCH_COUNT, &bvh, MatrixIdentity(), jobs);
+        bool pass = expected.hit;
+        for (const RayCollision& collision : collisions) pass = pass && SameCollision(collision, expected, true);
+        ok = ok && pass;
+        printf("\n%-34s %s\n", "Parallel batch of 1M rays", pass ? "ok" : "FAIL");
+        DestroyMeshBvh(&bvh);
+    }
+
+    // Empty and degenerate meshes: no hits, no crash
+    {
+        MeshData flat;
+        for (int i = 0; i < 64; i++) flat.vertices.push_back(Vector3{ 1.0f, 1.0f, 1.0f });
+        FinishMesh(&flat);
+        MeshBvh bvh = CreateMeshBvh(flat.mesh);
+        Mesh none = {};
+        MeshBvh empty = CreateMeshBvh(none);
+        Ray ray = { Vector3{ 1.0f, 5.0f, 1.0f }, Vector3{ 0.0f, -1.0f, 0.0f } };
+        bool pass = !GetRayCollisionMeshBvh(ray, &bvh, MatrixIdentity()).hit && !GetRayCollisionMeshBvh(ray, &empty, MatrixIdentity()).hit;
+        ok = ok && pass;
+        printf("%-34s %s\n", "Empty and degenerate meshes", pass ? "ok" : "FAIL");
+    }
+
+    printf("\n%s\n", ok ? "BVH hits match GetRayCollisionMesh" : "BVH mismatch");
+    DestroyJobSystem(jobs);
+
+    return ok ? 0 : 1;
+}
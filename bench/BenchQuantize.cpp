@@ -0,0 +1,252 @@
+// Benchmark and validation of the quantized storage types (src/Quantize.h)
+// Checks that every batch path matches the scalar encoders bit for bit, measures the
+// error bounds documented in Quantize.h and reports the pack/unpack throughput
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchQuantize.cpp
+#include "Quantize.h"
+#include "Bench.h"
+#include <vector>
+
+static const int ELEMENT_COUNT = 1 << 18;
+
+// Bounds checked against the measurements, Quantize.h documents the measured values
+static const float HALF_RELATIVE_BOUND = 1.0f/2048.0f;
+static const float OCT16_DEGREES_BOUND = 0.95f;
+static const float OCT32_DEGREES_BOUND = 0.004f;
+static const float QUATERNION_DEGREES_BOUND = 0.26f;
+
+static bool IsHalfNan(uint16_t h) { return (h & 0x7fff) > 0x7c00; }
+
+// Angle between two directions, in double: acosf() near 1 alone is off by ~0.02 deg
+static float AngleDegrees(Vector3 a, Vector3 b)
+{
+    double dot = (double)a.x*b.x + (double)a.y*b.y + (double)a.z*b.z;
+    double lengths = sqrt(((double)a.x*a.x + (double)a.y*a.y + (double)a.z*a.z)*((double)b.x*b.x + (double)b.y*b.y + (double)b.z*b.z));
+    return (float)(acos(fmin(fabs(dot)/lengths, 1.0)*((dot < 0.0) ? -1.0 : 1.0))*180.0/3.14159265358979323846);
+}
+
+static void Report(const char* name, const char* level, double seconds, bool match, bool& ok)
+{
+    ok = ok && match;
+    printf("%-24s %-8s %10.1f elements/ms %s\n", name, level, ELEMENT_COUNT / (seconds * 1000.0), match ? "" : "MISMATCH");
+}
+
+int main()
+{
+    bool ok = true;
+    SeedRandom(1005);
+    SimdLevel supported = DetectSimdLevel();
+
+    printf("Quantized storage, %d elements, detected %s\n\n", ELEMENT_COUNT, SimdLevelName(supported));
+
+    //------------------------------------------------------------------------------
+    // Half floats
+    //------------------------------------------------------------------------------
+    std::vector<float> floats(ELEMENT_COUNT), decoded(ELEMENT_COUNT);
+    std::vector<uint16_t> halves(ELEMENT_COUNT), reference(ELEMENT_COUNT);
+
+    // Edge values first (zeros, denormals, rounding ties, overflow, inf, nan), then random bit patterns and magnitudes
+    const uint32_t edges[] = { 0x00000000u, 0x80000000u, 0x33000000u, 0x33000001u, 0x387fc000u, 0x387fe000u, 0x38800000u,
+        0x3f801000u, 0x3f803000u, 0x477fe000u, 0x477fefffu, 0x477ff000u, 0x47800000u, 0x7f800000u, 0xff800000u, 0x7fc00000u, 0x7f800001u };
+    int edgeCount = (int)(sizeof(edges)/sizeof(edges[0]));
+    for (int i = 0; i < ELEMENT_COUNT; i++)
+    {
+        if (i < edgeCount) floats[i] = QuantizeBitsFloat(edges[i]);
+        else if (i & 1) floats[i] = QuantizeBitsFloat(NextRandom(GetThreadRandomState()));
+        else floats[i] = Random(-1.0f, 1.0f)*powf(2.0f, Random(-26.0f, 17.0f));
+    }
+    FloatToHalfBatchScalar(floats.data(), reference.data(), ELEMENT_COUNT);
+
+    float halfError = 0.0f;
+    for (int i = 0; i < ELEMENT_COUNT; i++)
+    {
+        float f = fabsf(floats[i]);
+        if (f >= 6.1035156e-5f && f <= 65504.0f) halfError = fmaxf(halfError, fabsf(HalfToFloat(reference[i]) - floats[i])/f);
+    }
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        double time = BenchBest([&]() {
+            FloatToHalfBatch(floats.data(), halves.data(), ELEMENT_COUNT);
+            DoNotOptimize(halves[ELEMENT_COUNT - 1]);
+        });
+
+        bool match = true;
+        for (int i = 0; i < ELEMENT_COUNT; i++) match = match && ((halves[i] == reference[i]) || (IsHalfNan(halves[i]) && IsHalfNan(reference[i])));
+        Report("FloatToHalfBatch", SimdLevelName((SimdLevel)level), time, match, ok);
+    }
+
+    // Every half value, scalar conversion against each batch path
+    std::vector<uint16_t> allHalves(65536);
+    std::vector<float> allFloats(65536);
+    for (int i = 0; i < 65536; i++) allHalves[i] = (uint16_t)i;
+    for (int i = 0; i < ELEMENT_COUNT; i++) halves[i] = (uint16_t)(i*40503u);
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        HalfToFloatBatch(allHalves.data(), allFloats.data(), 65536);
+
+        bool match = true;
+        for (int i = 0; i < 65536; i++)
+        {
+            float f = HalfToFloat((uint16_t)i);
+            bool bothNan = (f != f) && (allFloats[i] != allFloats[i]);
+            match = match && (bothNan || (QuantizeFloatBits(f) == QuantizeFloatBits(allFloats[i])));
+
+            // Round trip of every non-nan half is exact
+            match = match && (bothNan || (FloatToHalf(f) == (uint16_t)i));
+        }
+
+        double time = BenchBest([&]() {
+            HalfToFloatBatch(halves.data(), decoded.data(), ELEMENT_COUNT);
+            DoNotOptimize(decoded[ELEMENT_COUNT - 1]);
+        });
+        Report("HalfToFloatBatch", SimdLevelName((SimdLevel)level), time, match, ok);
+    }
+    SetSimdLevel(supported);
+
+    //------------------------------------------------------------------------------
+    // Octahedral directions
+    //------------------------------------------------------------------------------
+    std::vector<float> x(ELEMENT_COUNT), y(ELEMENT_COUNT), z(ELEMENT_COUNT);
+    std::vector<float> outX(ELEMENT_COUNT), outY(ELEMENT_COUNT), outZ(ELEMENT_COUNT);
+    RandomDirectionBatch(GetThreadRandomState(), x.data(), y.data(), z.data(), ELEMENT_COUNT);
+
+    // Axes and octant boundaries, where the fold changes sides
+    const Vector3 axes[] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 }, { 0.6f, -0.8f, 0 }, { -0.6f, 0, -0.8f } };
+    for (int i = 0; i < (int)(sizeof(axes)/sizeof(axes[0])); i++) { x[i] = axes[i].x; y[i] = axes[i].y; z[i] = axes[i].z; }
+
+    std::vector<DirectionOct16> oct16(ELEMENT_COUNT), oct16Reference(ELEMENT_COUNT);
+    std::vector<DirectionOct32> oct32(ELEMENT_COUNT), oct32Reference(ELEMENT_COUNT);
+    PackDirectionBatchScalar(x.data(), y.data(), z.data(), oct16Reference.data(), ELEMENT_COUNT);
+    PackDirectionBatchScalar(x.data(), y.data(), z.data(), oct32Reference.data(), ELEMENT_COUNT);
+
+    float oct16Error = 0.0f, oct32Error = 0.0f;
+    for (int i = 0; i < ELEMENT_COUNT; i++)
+    {
+        Vector3 v = { x[i], y[i], z[i] };
+        oct16Error = fmaxf(oct16Error, AngleDegrees(v, UnpackDirection(oct16Reference[i])));
+        oct32Error = fmaxf(oct32Error, AngleDegrees(v, UnpackDirection(oct32Reference[i])));
+    }
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        const char* name = SimdLevelName((SimdLevel)level);
+
+        double time = BenchBest([&]() {
+            PackDirectionBatch(x.data(), y.data(), z.data(), oct16.data(), ELEMENT_COUNT);
+            DoNotOptimize(oct16[ELEMENT_COUNT - 1]);
+        });
+        Report("PackDirectionBatch 16", name, time, memcmp(oct16.data(), oct16Reference.data(), sizeof(DirectionOct16) * ELEMENT_COUNT) == 0, ok);
+
+        time = BenchBest([&]() {
+            PackDirectionBatch(x.data(), y.data(), z.data(), oct32.data(), ELEMENT_COUNT);
+            DoNotOptimize(oct32[ELEMENT_COUNT - 1]);
+        });
+        Report("PackDirectionBatch 32", name, time, memcmp(oct32.data(), oct32Reference.data(), sizeof(DirectionOct32) * ELEMENT_COUNT) == 0, ok);
+
+        time = BenchBest([&]() {
+            UnpackDirectionBatch(oct16Reference.data(), outX.data(), outY.data(), outZ.data(), ELEMENT_COUNT);
+            DoNotOptimize(outZ[ELEMENT_COUNT - 1]);
+        });
+        bool match = true;
+        for (int i = 0; i < ELEMENT_COUNT; i++)
+        {
+            Vector3 v = UnpackDirection(oct16Reference[i]);
+            match = match && (v.x == outX[i]) && (v.y == outY[i]) && (v.z == outZ[i]);
+        }
+        Report("UnpackDirectionBatch 16", name, time, match, ok);
+
+        time = BenchBest([&]() {
+            UnpackDirectionBatch(oct32Reference.data(), outX.data(), outY.data(), outZ.data(), ELEMENT_COUNT);
+            DoNotOptimize(outZ[ELEMENT_COUNT - 1]);
+        });
+        match = true;
+        for (int i = 0; i < ELEMENT_COUNT; i++)
+        {
+            Vector3 v = UnpackDirection(oct32Reference[i]);
+            match = match && (v.x == outX[i]) && (v.y == outY[i]) && (v.z == outZ[i]);
+        }
+        Report("UnpackDirectionBatch 32", name, time, match, ok);
+    }
+    SetSimdLevel(supported);
+
+    //------------------------------------------------------------------------------
+    // Smallest three quaternions
+    //------------------------------------------------------------------------------
+    std::vector<float> qx(ELEMENT_COUNT), qy(ELEMENT_COUNT), qz(ELEMENT_COUNT), qw(ELEMENT_COUNT);
+    std::vector<float> rx(ELEMENT_COUNT), ry(ELEMENT_COUNT), rz(ELEMENT_COUNT), rw(ELEMENT_COUNT);
+    for (int i = 0; i < ELEMENT_COUNT; i++)
+    {
+        Vector3 axis = Normalize(Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) + 0.001f });
+        Quaternion q = FromAxisAngle(axis, Random(-2.0f*PI, 2.0f*PI));
+
+        // Ties between the largest components
+        if (i == 0) q = Quaternion{ 0.5f, -0.5f, 0.5f, -0.5f };
+        if (i == 1) q = Quaternion{ 0.0f, QUANTIZE_SQRT1_2, -QUANTIZE_SQRT1_2, 0.0f };
+        qx[i] = q.x; qy[i] = q.y; qz[i] = q.z; qw[i] = q.w;
+    }
+    QuaternionSoA quaternions = { qx.data(), qy.data(), qz.data(), qw.data() };
+    QuaternionSoA unpacked = { rx.data(), ry.data(), rz.data(), rw.data() };
+
+    std::vector<QuaternionPacked> packed(ELEMENT_COUNT), packedReference(ELEMENT_COUNT);
+    PackQuaternionBatchScalar(quaternions, packedReference.data(), ELEMENT_COUNT);
+
+    float quaternionError = 0.0f, componentError = 0.0f;
+    for (int i = 0; i < ELEMENT_COUNT; i++)
+    {
+        Quaternion q = { qx[i], qy[i], qz[i], qw[i] };
+        Quaternion r = UnpackQuaternion(packedReference[i]);
+        double dot = fabs((double)q.x*r.x + (double)q.y*r.y + (double)q.z*r.z + (double)q.w*r.w);
+        double lengths = sqrt(((double)q.x*q.x + (double)q.y*q.y + (double)q.z*q.z + (double)q.w*q.w)*((double)r.x*r.x + (double)r.y*r.y + (double)r.z*r.z + (double)r.w*r.w));
+        quaternionError = fmaxf(quaternionError, (float)(2.0*acos(fmin(dot/lengths, 1.0))*180.0/3.14159265358979323846));
+
+        // Compare against the same sign, the encoder may negate the quaternion
+        float sign = (q.x*r.x + q.y*r.y + q.z*r.z + q.w*r.w < 0.0f) ? -1.0f : 1.0f;
+        componentError = fmaxf(componentError, fmaxf(fmaxf(fabsf(q.x*sign - r.x), fabsf(q.y*sign - r.y)), fmaxf(fabsf(q.z*sign - r.z), fabsf(q.w*sign - r.w))));
+    }
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        const char* name = SimdLevelName((SimdLevel)level);
+
+        double time = BenchBest([&]() {
+            PackQuaternionBatch(quaternions, packed.data(), ELEMENT_COUNT);
+            DoNotOptimize(packed[ELEMENT_COUNT - 1]);
+        });
+        Report("PackQuaternionBatch", name, time, memcmp(packed.data(), packedReference.data(), sizeof(QuaternionPacked) * ELEMENT_COUNT) == 0, ok);
+
+        time = BenchBest([&]() {
+            UnpackQuaternionBatch(packedReference.data(), unpacked, ELEMENT_COUNT);
+            DoNotOptimize(rw[ELEMENT_COUNT - 1]);
+        });
+        bool match = true;
+        for (int i = 0; i < ELEMENT_COUNT; i++)
+        {
+            Quaternion r = UnpackQuaternion(packedReference[i]);
+            match = match && (r.x == rx[i]) && (r.y == ry[i]) && (r.z == rz[i]) && (r.w == rw[i]);
+        }
+        Report("UnpackQuaternionBatch", name, time, match, ok);
+    }
+    SetSimdLevel(supported);
+
+    //------------------------------------------------------------------------------
+    // Error bounds
+    //------------------------------------------------------------------------------
+    bool bounds = (halfError <= HALF_RELATIVE_BOUND) && (oct16Error <= OCT16_DEGREES_BOUND) &&
+        (oct32Error <= OCT32_DEGREES_BOUND) && (quaternionError <= QUATERNION_DEGREES_BOUND);
+    ok = ok && bounds;
+
+    printf("\nMax error\n");
+    printf("%-24s %.3e relative\n", "Half", halfError);
+    printf("%-24s %.4f deg\n", "DirectionOct16", oct16Error);
+    printf("%-24s %.4f deg\n", "DirectionOct32", oct32Error);
+    printf("%-24s %.4f deg, %.2e per component\n", "QuaternionPacked", quaternionError, componentError);
+
+    printf("\n%s\n", ok ? "Batch paths match the scalar encoders within the documented bounds" : "Mismatch or error bound exceeded");
+
+    return ok ? 0 : 1;
+}
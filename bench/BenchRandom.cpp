@@ -0,0 +1,177 @@
+// Benchmark and validation of the random generators (src/Random.h, src/MathBatch.h)
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchRandom.cpp
+#include "MathBatch.h"
+#include "Bench.h"
+#include <vector>
+
+static const int SAMPLE_COUNT = 1 << 20;
+
+static bool Check(const char* name, double value, double expected, double tolerance)
+{
+    bool pass = fabs(value - expected) <= tolerance;
+    printf("%-34s %.5f (expected %.5f) %s\n", name, value, expected, pass ? "" : "FAIL");
+    return pass;
+}
+
+int main()
+{
+    std::vector<float> x(SAMPLE_COUNT), y(SAMPLE_COUNT), z(SAMPLE_COUNT);
+    bool ok = true;
+
+    // Throughput against the previous rand() based Random()
+    double toNs = 1e9 / SAMPLE_COUNT;
+    srand(1005);
+    double crtTime = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) x[i] = -1.0f + (rand() / ((float)RAND_MAX / 2.0f));
+        DoNotOptimize(x[SAMPLE_COUNT - 1]);
+    });
+
+    SeedRandom(1005);
+    double randomTime = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) x[i] = Random(-1.0f, 1.0f);
+        DoNotOptimize(x[SAMPLE_COUNT - 1]);
+    });
+
+    RandomState rng = CreateRandomState(1005);
+    double fillTime = BenchBest([&]() {
+        RandomFill(&rng, x.data(), SAMPLE_COUNT, -1.0f, 1.0f);
+        DoNotOptimize(x[SAMPLE_COUNT - 1]);
+    });
+
+    double dir2Time = BenchBest([&]() {
+        RandomDirectionBatch(&rng, x.data(), y.data(), SAMPLE_COUNT);
+        DoNotOptimize(x[SAMPLE_COUNT - 1]);
+    });
+    double dir3Time = BenchBest([&]() {
+        RandomDirectionBatch(&rng, x.data(), y.data(), z.data(), SAMPLE_COUNT);
+        DoNotOptimize(x[SAMPLE_COUNT - 1]);
+    });
+    double diskTime = BenchBest([&]() {
+        RandomInDiskBatch(&rng, 1.0f, x.data(), y.data(), SAMPLE_COUNT);
+        DoNotOptimize(x[SAMPLE_COUNT - 1]);
+    });
+    double sphereTime = BenchBest([&]() {
+        RandomInSphereBatch(&rng, 1.0f, x.data(), y.data(), z.data(), SAMPLE_COUNT);
+        DoNotOptimize(x[SAMPLE_COUNT - 1]);
+    });
+
+    printf("Random generation, %d samples\n\n", SAMPLE_COUNT);
+    printf("%-34s %8.2f ns/sample\n", "rand() (previous Random)", crtTime * toNs);
+    printf("%-34s %8.2f ns/sample\n", "Random(min, max)", randomTime * toNs);
+    printf("%-34s %8.2f ns/sample\n", "RandomFill", fillTime * toNs);
+    printf("%-34s %8.2f ns/sample\n", "RandomDirectionBatch (Vector2)", dir2Time * toNs);
+    printf("%-34s %8.2f ns/sample\n", "RandomDirectionBatch (Vector3)", dir3Time * toNs);
+    printf("%-34s %8.2f ns/sample\n", "RandomInDiskBatch", diskTime * toNs);
+    printf("%-34s %8.2f ns/sample\n\n", "RandomInSphereBatch", sphereTime * toNs);
+
+    // Uniform floats: mean 0.5 and variance 1/12 in [0, 1), distinct values use all 24 bits
+    RandomFill(&rng, x.data(), SAMPLE_COUNT, 0.0f, 1.0f);
+    double mean = 0.0, variance = 0.0;
+    float minValue = 1.0f, maxValue = 0.0f;
+    for (int i = 0; i < SAMPLE_COUNT; i++) { mean += x[i]; minValue = fminf(minValue, x[i]); maxValue = fmaxf(maxValue, x[i]); }
+    mean /= SAMPLE_COUNT;
+    for (int i = 0; i < SAMPLE_COUNT; i++) variance += (x[i] - mean) * (x[i] - mean);
+    variance /= SAMPLE_COUNT;
+
+    double tolerance = 4.0 / sqrt((double)SAMPLE_COUNT);
+    ok &= Check("RandomFill mean", mean, 0.5, tolerance);
+    ok &= Check("RandomFill variance", variance, 1.0 / 12.0, tolerance);
+    ok &= (minValue >= 0.0f) && (maxValue < 1.0f);
+
+    // Lane fills must not depend on the SIMD level
+    std::vector<float> levelOut(SAMPLE_COUNT + 5);
+    bool levelsMatch = true;
+    SimdLevel supported = DetectSimdLevel();
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        RandomState levelRng = CreateRandomState(99);
+        RandomFill(&levelRng, levelOut.data(), SAMPLE_COUNT + 5, -3.0f, 5.0f);
+        if (level == SIMD_LEVEL_SCALAR) y.assign(levelOut.begin(), levelOut.begin() + SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; i++) levelsMatch &= (levelOut[i] == y[i]);
+    }
+    SetSimdLevel(supported);
+    printf("%-34s %s\n", "RandomFill same on every level", levelsMatch ? "yes" : "FAIL");
+    ok &= levelsMatch;
+
+    // Lane seeds take the high half from the first draw on every compiler
+    RandomState laneRng = CreateRandomState(99);
+    RandomState drawRng = laneRng;
+    RandomLanes lanes;
+    SeedRandomLanes(&laneRng, &lanes);
+    bool lanesMatch = true;
+    for (int l = 0; l < RANDOM_LANES; l++)
+    {
+        uint64_t high = NextRandom(&drawRng);
+        uint64_t low = NextRandom(&drawRng);
+        RandomState lane = CreateRandomState((high << 32) | low);
+        for (int k = 0; k < 4; k++) lanesMatch &= (lanes.s[k][l] == lane.s[k]);
+    }
+    printf("%-34s %s\n", "Lane seeds in draw order", lanesMatch ? "yes" : "FAIL");
+    ok &= lanesMatch;
+
+    // Directions must be unit length with a zero mean
+    RandomDirectionBatch(&rng, x.data(), y.data(), z.data(), SAMPLE_COUNT);
+    double lengthError = 0.0, meanX = 0.0, meanZ = 0.0;
+    for (int i = 0; i < SAMPLE_COUNT; i++)
+    {
+        lengthError = fmax(lengthError, fabs(sqrt((double)x[i] * x[i] + (double)y[i] * y[i] + (double)z[i] * z[i]) - 1.0));
+        meanX += x[i];
+        meanZ += z[i];
+    }
+    ok &= Check("Vector3 direction length error", lengthError, 0.0, 1e-6);
+    ok &= Check("Vector3 direction mean x", meanX / SAMPLE_COUNT, 0.0, tolerance);
+    ok &= Check("Vector3 direction mean z", meanZ / SAMPLE_COUNT, 0.0, tolerance);
+
+    // Uniform area/volume: the inner half radius holds 1/4 of a disk and 1/8 of a sphere
+    RandomInDiskBatch(&rng, 2.0f, x.data(), y.data(), SAMPLE_COUNT);
+    int inside = 0, outside = 0;
+    for (int i = 0; i < SAMPLE_COUNT; i++)
+    {
+        float d2 = x[i] * x[i] + y[i] * y[i];
+        inside += (d2 < 1.0f);
+        outside += (d2 > 4.0f + 1e-5f);
+    }
+    ok &= Check("Disk inner half radius fraction", (double)inside / SAMPLE_COUNT, 0.25, tolerance);
+    ok &= (outside == 0);
+
+    RandomInSphereBatch(&rng, 2.0f, x.data(), y.data(), z.data(), SAMPLE_COUNT);
+    inside = 0; outside = 0;
+    for (int i = 0; i < SAMPLE_COUNT; i++)
+    {
+        float d2 = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        inside += (d2 < 1.0f);
+        outside += (d2 > 4.0f + 1e-5f);
+    }
+    ok &= Check("Sphere inner half radius fraction", (double)inside / SAMPLE_COUNT, 0.125, tolerance);
+    ok &= (outside == 0);
+
+    // Deterministic seeding, and threads never share a stream
+    RandomState a = CreateRandomState(42), b = CreateRandomState(42);
+    bool repeatable = true;
+    for (int i = 0; i < 1000; i++) repeatable &= (NextRandom(&a) == NextRandom(&b));
+
+    SeedRandom(7);
+    float mainFirst = Random(0.0f, 1.0f);
+    SeedRandom(7);
+    repeatable &= (Random(0.0f, 1.0f) == mainFirst);
+
+    float threadFirst[2] = { 0 };
+    std::thread t0([&]() { threadFirst[0] = Random(0.0f, 1.0f); });
+    t0.join();
+    std::thread t1([&]() { threadFirst[1] = Random(0.0f, 1.0f); });
+    t1.join();
+    bool independent = (threadFirst[0] != threadFirst[1]);
+
+    RandomState jumped = CreateRandomState(42);
+    JumpRandomState(&jumped);
+    independent &= (NextRandom(&jumped) != NextRandom(&a));
+
+    printf("%-34s %s\n", "Repeatable seeding", repeatable ? "yes" : "FAIL");
+    printf("%-34s %s\n", "Independent thread streams", independent ? "yes" : "FAIL");
+    ok &= repeatable && independent;
+
+    printf("\n%s\n", ok ? "Random generators pass" : "Random generators FAIL");
+
+    return ok ? 0 : 1;
+}
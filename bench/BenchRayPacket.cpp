@@ -0,0 +1,307 @@
+// Benchmark and validation of the ray packet kernels (src/RayPacket.h)
+// One ray against packets of 8 triangles or boxes and packets of 8 rays against one
+// triangle or box, at every SIMD level, against raylib's GetRayCollisionTriangle() and
+// GetRayCollisionBox() called once per pair. Every hit must match bit for bit: rays from
+// inside boxes, axis aligned rays (zero direction components), rays starting on box faces,
+// degenerate triangles and packets of 1 to 8 lanes are included
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc /Iinclude bench\BenchRayPacket.cpp
+#include "RayPacket.h"
+#include "RaylibReference.h"
+#include "Bench.h"
+#include <vector>
+
+static const int PACKET_COUNT = 20000;
+
+static Vector3 RandomInBox(float lo, float hi)
+{
+    return Vector3{ Random(lo, hi), Random(lo, hi), Random(lo, hi) };
+}
+
+// Rays toward the middle of the scene, one in four axis aligned
+static Ray RandomRay(int i)
+{
+    Ray ray = { RandomInBox(-20.0f, 20.0f), Normalize(RandomInBox(-4.0f, 4.0f) - RandomInBox(-20.0f, 20.0f)) };
+    if (i % 4 == 3)
+    {
+        int axis = i % 3;
+        ray.direction = Vector3{ (axis == 0) ? 1.0f : 0.0f, (axis == 1) ? -1.0f : 0.0f, (axis == 2) ? 1.0f : 0.0f };
+    }
+
+    return ray;
+}
+
+// Triangles around the origin, one in sixteen degenerate (all points in a line)
+static void RandomTriangle(int i, Vector3* points)
+{
+    points[0] = RandomInBox(-8.0f, 8.0f);
+    points[1] = points[0] + RandomInBox(-6.0f, 6.0f);
+    points[2] = points[0] + RandomInBox(-6.0f, 6.0f);
+    if (i % 16 == 15) points[2] = points[0] + (points[1] - points[0])*2.0f;
+}
+
+// Boxes around the origin, whole numbers one time in four so that rays start on their faces
+static BoundingBox RandomBox(int i)
+{
+    Vector3 min = RandomInBox(-10.0f, 8.0f);
+    Vector3 max = min + RandomInBox(0.5f, 8.0f);
+    if (i % 4 == 0)
+    {
+        min = Vector3{ floorf(min.x), floorf(min.y), floorf(min.z) };
+        max = Vector3{ ceilf(max.x), ceilf(max.y), ceilf(max.z) };
+    }
+
+    return BoundingBox{ min, max };
+}
+
+static bool SameFloat(float a, float b)
+{
+    return (a == b) || ((a != a) && (b != b));
+}
+
+static bool SameVector(Vector3 a, Vector3 b)
+{
+    return SameFloat(a.x, b.x) && SameFloat(a.y, b.y) && SameFloat(a.z, b.z);
+}
+
+// raylib leaves the other fields of a miss filled, only hits are compared
+static bool SameCollision(RayCollision a, RayCollision b)
+{
+    if (a.hit != b.hit) return false;
+
+    return !a.hit || (SameFloat(a.distance, b.distance) && SameVector(a.point, b.point) && SameVector(a.normal, b.normal));
+}
+
+struct Scene {
+    std::vector<Ray> rays;                      // 8 per packet
+    std::vector<Vector3> points;                // 8 triangles per packet
+    std::vector<BoundingBox> boxes;             // 8 per packet
+    std::vector<int> counts;                    // Lanes in use per packet
+    std::vector<RayPacket> rayPackets;
+    std::vector<TrianglePacket> trianglePackets;
+    std::vector<BoxPacket> boxPackets;
+};
+
+static Scene MakeScene()
+{
+    Scene scene;
+    for (int p = 0; p < PACKET_COUNT; p++)
+    {
+        // Mostly full packets, every lane count shows up
+        int count = (p % 4 == 0) ? 1 + p % RAY_PACKET_WIDTH : RAY_PACKET_WIDTH;
+        scene.counts.push_back(count);
+        for (int i = 0; i < RAY_PACKET_WIDTH; i++)
+        {
+            int n = p*RAY_PACKET_WIDTH + i;
+            Vector3 points[3];
+            RandomTriangle(n, points);
+            scene.points.insert(scene.points.end(), points, points + 3);
+            scene.boxes.push_back(RandomBox(n));
+            scene.rays.push_back(RandomRay(n));
+        }
+
+        // Even rays aim at a point of the first triangle, ray 0 at one of the others
+        for (int i = 0; i < RAY_PACKET_WIDTH; i += 2)
+        {
+            const Vector3* points = &scene.points[3*(p*RAY_PACKET_WIDTH + ((i == 0) ? p % RAY_PACKET_WIDTH : 0))];
+            float u = Random(0.0f, 1.0f), v = Random(0.0f, 1.0f - u);
+            Vector3 target = points[0] + (points[1] - points[0])*u + (points[2] - points[0])*v;
+            Ray& ray = scene.rays[p*RAY_PACKET_WIDTH + i];
+            ray.direction = Normalize(target - ray.position);
+        }
+
+        // Rays starting inside and on the faces of the first box of the packet
+        BoundingBox box = scene.boxes[p*RAY_PACKET_WIDTH];
+        Ray& inside = scene.rays[p*RAY_PACKET_WIDTH + 1];
+        inside.position = Lerp(box.min, box.max, 0.5f);
+        if (p % 8 == 0) scene.rays[p*RAY_PACKET_WIDTH + 2].position.x = box.min.x;
+
+        scene.rayPackets.push_back(RayPacketFromRays(&scene.rays[p*RAY_PACKET_WIDTH], count));
+        scene.trianglePackets.push_back(TrianglePacketFromPoints(&scene.points[3*p*RAY_PACKET_WIDTH], count));
+        scene.boxPackets.push_back(BoxPacketFromBoxes(&scene.boxes[p*RAY_PACKET_WIDTH], count));
+    }
+
+    return scene;
+}
+
+// Every packet entry point against raylib at the active level
+static bool Validate(const Scene& scene, int* hits)
+{
+    bool ok = true;
+    hits[0] = hits[1] = hits[2] = hits[3] = 0;
+    RayCollision collisions[RAY_PACKET_WIDTH];
+    for (int p = 0; p < PACKET_COUNT; p++)
+    {
+        int count = scene.counts[p];
+        const Ray* rays = &scene.rays[p*RAY_PACKET_WIDTH];
+        const Vector3* points = &scene.points[3*p*RAY_PACKET_WIDTH];
+        const BoundingBox* boxes = &scene.boxes[p*RAY_PACKET_WIDTH];
+
+        // One ray, 8 triangles: closest hit, ties to the first lane like GetRayCollisionMesh()
+        RayCollision expected = { 0 };
+        int expectedLane = -1;
+        for (int i = 0; i < count; i++)
+        {
+            RayCollision hit = ref::GetRayCollisionTriangle(rays[0], points[3*i], points[3*i + 1], points[3*i + 2]);
+            if (hit.hit && (!expected.hit || (expected.distance > hit.distance))) { expected = hit; expectedLane = i; }
+        }
+        int lane = -1;
+        ok = ok && SameCollision(GetRayCollisionTrianglePacket(rays[0], &scene.trianglePackets[p], &lane), expected) && (lane == expectedLane);
+        hits[0] += expected.hit;
+
+        // One ray, 8 boxes: every lane through the mask, then the closest
+        alignas(32) float distances[RAY_PACKET_WIDTH];
+        int mask = IntersectBoxPacket(rays[1], &scene.boxPackets[p], distances);
+        expected = RayCollision{ 0 };
+        expectedLane = -1;
+        for (int i = 0; i < count; i++)
+        {
+            RayCollision hit = ref::GetRayCollisionBox(rays[1], boxes[i]);
+            ok = ok && (((mask >> i) & 1) == (int)hit.hit) && (!hit.hit || SameFloat(distances[i], hit.distance));
+            if (hit.hit && (!expected.hit || (expected.distance > hit.distance))) { expected = hit; expectedLane = i; }
+        }
+        ok = ok && SameCollision(GetRayCollisionBoxPacket(rays[1], &scene.boxPackets[p], &lane), expected) && (lane == expectedLane);
+        ok = ok && (mask >> count) == 0;
+        hits[1] += expected.hit;
+
+        // 8 rays, one triangle and one box
+        GetRayPacketCollisionTriangle(&scene.rayPackets[p], points[0], points[1], points[2], collisions);
+        for (int i = 0; i < count; i++)
+        {
+            RayCollision hit = ref::GetRayCollisionTriangle(rays[i], points[0], points[1], points[2]);
+            ok = ok && SameCollision(collisions[i], hit);
+            hits[2] += hit.hit;
+        }
+        GetRayPacketCollisionBox(&scene.rayPackets[p], boxes[0], collisions);
+        for (int i = 0; i < count; i++)
+        {
+            RayCollision hit = ref::GetRayCollisionBox(rays[i], boxes[0]);
+            ok = ok && SameCollision(collisions[i], hit);
+            hits[3] += hit.hit;
+        }
+    }
+
+    return ok;
+}
+
+int main()
+{
+    bool ok = true;
+    SeedRandom(1005);
+    Scene scene = MakeScene();
+    SimdLevel supported = DetectSimdLevel();
+
+    printf("Ray packets, %d packets of up to %d lanes, detected %s\n", PACKET_COUNT, RAY_PACKET_WIDTH, SimdLevelName(supported));
+    printf("ns per ray-primitive test, raylib: one GetRayCollisionTriangle()/GetRayCollisionBox() call per pair\n\n");
+    printf("%-22s %9s %9s %9s %9s %9s %s\n", "kernel", "raylib", "scalar", "SSE", "AVX2", "speedup", "hits");
+
+    // Only full packets are timed
+    std::vector<int> full;
+    for (int p = 0; p < PACKET_COUNT; p++) if (scene.counts[p] == RAY_PACKET_WIDTH) full.push_back(p);
+    double tests = (double)full.size()*RAY_PACKET_WIDTH;
+
+    int hits[4] = { 0 };
+    double levelTime[4][3] = { { 0.0 } };
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        bool pass = Validate(scene, hits);
+        if (!pass) printf("Mismatch at %s\n", SimdLevelName((SimdLevel)level));
+        ok = ok && pass;
+
+        alignas(32) float distances[RAY_PACKET_WIDTH];
+        levelTime[0][level] = BenchBest([&]() {
+            int sum = 0;
+            for (int p : full) sum += IntersectTrianglePacket(scene.rays[p*RAY_PACKET_WIDTH], &scene.trianglePackets[p], distances);
+            DoNotOptimize(sum);
+        });
+        levelTime[1][level] = BenchBest([&]() {
+            int sum = 0;
+            for (int p : full) sum += IntersectBoxPacket(scene.rays[p*RAY_PACKET_WIDTH], &scene.boxPackets[p], distances);
+            DoNotOptimize(sum);
+        });
+        levelTime[2][level] = BenchBest([&]() {
+            int sum = 0;
+            for (int p : full)
+            {
+                const Vector3* points = &scene.points[3*p*RAY_PACKET_WIDTH];
+                sum += IntersectRayPacketTriangle(&scene.rayPackets[p], points[0], points[1], points[2], distances);
+            }
+            DoNotOptimize(sum);
+        });
+        levelTime[3][level] = BenchBest([&]() {
+            int sum = 0;
+            for (int p : full) sum += IntersectRayPacketBox(&scene.rayPackets[p], scene.boxes[p*RAY_PACKET_WIDTH], distances);
+            DoNotOptimize(sum);
+        });
+    }
+    SetSimdLevel(supported);
+
+    // raylib: one call per pair, only the hit flag and distance are used
+    double refTime[4];
+    refTime[0] = BenchBest([&]() {
+        float sum = 0.0f;
+        for (int p : full)
+        {
+            for (int i = 0; i < RAY_PACKET_WIDTH; i++)
+            {
+                const Vector3* points = &scene.points[3*(p*RAY_PACKET_WIDTH + i)];
+                RayCollision hit = ref::GetRayCollisionTriangle(scene.rays[p*RAY_PACKET_WIDTH], points[0], points[1], points[2]);
+                sum += hit.hit ? hit.distance : 0.0f;
+            }
+        }
+        DoNotOptimize(sum);
+    });
+    refTime[1] = BenchBest([&]() {
+        float sum = 0.0f;
+        for (int p : full)
+        {
+            for (int i = 0; i < RAY_PACKET_WIDTH; i++)
+            {
+                RayCollision hit = ref::GetRayCollisionBox(scene.rays[p*RAY_PACKET_WIDTH], scene.boxes[p*RAY_PACKET_WIDTH + i]);
+                sum += hit.hit ? hit.distance : 0.0f;
+            }
+        }
+        DoNotOptimize(sum);
+    });
+    refTime[2] = BenchBest([&]() {
+        float sum = 0.0f;
+        for (int p : full)
+        {
+            const Vector3* points = &scene.points[3*p*RAY_PACKET_WIDTH];
+            for (int i = 0; i < RAY_PACKET_WIDTH; i++)
+            {
+                RayCollision hit = ref::GetRayCollisionTriangle(scene.rays[p*RAY_PACKET_WIDTH + i], points[0], points[1], points[2]);
+                sum += hit.hit ? hit.distance : 0.0f;
+            }
+        }
+        DoNotOptimize(sum);
+    });
+    refTime[3] = BenchBest([&]() {
+        float sum = 0.0f;
+        for (int p : full)
+        {
+            for (int i = 0; i < RAY_PACKET_WIDTH; i++)
+            {
+                RayCollision hit = ref::GetRayCollisionBox(scene.rays[p*RAY_PACKET_WIDTH + i], scene.boxes[p*RAY_PACKET_WIDTH]);
+                sum += hit.hit ? hit.distance : 0.0f;
+            }
+        }
+        DoNotOptimize(sum);
+    });
+
+    const char* names[4] = { "1 ray x 8 triangles", "1 ray x 8 boxes", "8 rays x 1 triangle", "8 rays x 1 box" };
+    for (int k = 0; k < 4; k++)
+    {
+        printf("%-22s %9.2f %9.2f", names[k], refTime[k]*1e9/tests, levelTime[k][0]*1e9/tests);
+        for (int level = SIMD_LEVEL_SSE; level <= SIMD_LEVEL_AVX2; level++)
+        {
+            if (level <= supported) printf(" %9.2f", levelTime[k][level]*1e9/tests);
+            else printf(" %9s", "-");
+        }
+        printf(" %8.1fx %d\n", refTime[k]/levelTime[k][supported], hits[k]);
+    }
+
+    printf("\n%s\n", ok ? "Packet hits match GetRayCollisionTriangle and GetRayCollisionBox" : "Packet mismatch");
+
+    return ok ? 0 : 1;
+}
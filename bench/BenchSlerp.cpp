@@ -0,0 +1,136 @@
+// Benchmark and validation of the batched quaternion Nlerp/Slerp (src/MathBatch.h)
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchSlerp.cpp
+#include "MathBatch.h"
+#include "Bench.h"
+#include <vector>
+
+// 64 bones x 4096 characters
+static const int QUATERNION_COUNT = 1 << 18;
+
+// Slerp batches use the FastMath.h acos/sin (measured 3.6e-7, sin(halfTheta) >= 0.31 outside the Nlerp range)
+static const float SLERP_TOLERANCE = 1e-6f;
+
+struct QuaternionArrays {
+    std::vector<float> x, y, z, w;
+
+    explicit QuaternionArrays(int count) : x(count), y(count), z(count), w(count) {}
+    QuaternionSoA Soa() { return QuaternionSoA{ x.data(), y.data(), z.data(), w.data() }; }
+    Quaternion Get(int i) const { return Quaternion{ x[i], y[i], z[i], w[i] }; }
+    void Set(int i, Quaternion q) { x[i] = q.x; y[i] = q.y; z[i] = q.z; w[i] = q.w; }
+};
+
+static float MaxError(const QuaternionArrays& a, const std::vector<Quaternion>& reference)
+{
+    float maxError = 0.0f;
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        Quaternion q = a.Get((int)i);
+        maxError = fmaxf(maxError, fabsf(q.x - reference[i].x));
+        maxError = fmaxf(maxError, fabsf(q.y - reference[i].y));
+        maxError = fmaxf(maxError, fabsf(q.z - reference[i].z));
+        maxError = fmaxf(maxError, fabsf(q.w - reference[i].w));
+    }
+    return maxError;
+}
+
+static void Report(const char* name, double seconds, float error, float tolerance, bool& ok)
+{
+    bool pass = error <= tolerance;
+    ok = ok && pass;
+    printf("%-30s %8.3f ms %8.2f ns/quaternion   max error %.2e %s\n", name, seconds * 1000.0, seconds * 1e9 / QUATERNION_COUNT, error, pass ? "" : "FAIL");
+}
+
+int main()
+{
+    QuaternionArrays q1(QUATERNION_COUNT), q2(QUATERNION_COUNT), out(QUATERNION_COUNT);
+    std::vector<float> amounts(QUATERNION_COUNT);
+    std::vector<Quaternion> reference(QUATERNION_COUNT);
+
+    SeedRandom(1005);
+    for (int i = 0; i < QUATERNION_COUNT; i++)
+    {
+        Vector3 axis = Normalize(Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) + 0.001f });
+        Quaternion a = FromAxisAngle(axis, Random(-PI, PI));
+        Quaternion b = FromAxisAngle(axis, Random(-PI, PI));
+
+        // Cover every Slerp branch: identical, nearly identical (Nlerp), opposite hemisphere, orthogonal and far apart
+        switch (i % 8)
+        {
+            case 0: b = a; break;
+            case 1: b = Normalize(Add(a, Scale(b, 0.05f))); break;
+            case 2: b = Scale(b, -1.0f); break;
+            case 3: a = Quaternion{ 1.0f, 0.0f, 0.0f, 0.0f }; b = Quaternion{ -0.0f, -0.6f, -0.8f, -0.0f }; break;     // Dot product of -0.0, no flip
+            default: break;
+        }
+
+        q1.Set(i, a);
+        q2.Set(i, b);
+        amounts[i] = Random(0.0f, 1.0f);
+    }
+
+    printf("Quaternion interpolation, %d pairs, detected %s\n\n", QUATERNION_COUNT, SimdLevelName(DetectSimdLevel()));
+
+    bool ok = true;
+    SimdLevel supported = DetectSimdLevel();
+
+    // Per element amounts
+    double slerpCall = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++) reference[i] = Slerp(q1.Get(i), q2.Get(i), amounts[i]);
+        DoNotOptimize(reference[QUATERNION_COUNT - 1]);
+    });
+    Report("Slerp (per call)", slerpCall, 0.0f, 0.0f, ok);
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        double batch = BenchBest([&]() {
+            SlerpBatch(q1.Soa(), q2.Soa(), amounts.data(), out.Soa(), QUATERNION_COUNT);
+            DoNotOptimize(out.x[QUATERNION_COUNT - 1]);
+        });
+
+        char name[64];
+        snprintf(name, sizeof(name), "SlerpBatch %s", SimdLevelName((SimdLevel)level));
+        Report(name, batch, MaxError(out, reference), SLERP_TOLERANCE, ok);
+    }
+    SetSimdLevel(supported);
+
+    // Uniform amount, e.g. one crossfade weight for a whole pose
+    for (int i = 0; i < QUATERNION_COUNT; i++) reference[i] = Slerp(q1.Get(i), q2.Get(i), 0.3f);
+    SlerpBatch(q1.Soa(), q2.Soa(), 0.3f, out.Soa(), QUATERNION_COUNT);
+    float uniformError = MaxError(out, reference);
+    bool uniformOk = uniformError <= SLERP_TOLERANCE;
+    ok = ok && uniformOk;
+    printf("%-30s %32s max error %.2e %s\n\n", "SlerpBatch uniform amount", "", uniformError, uniformOk ? "" : "FAIL");
+
+    // Nlerp must match exactly
+    double nlerpCall = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++) reference[i] = Nlerp(q1.Get(i), q2.Get(i), amounts[i]);
+        DoNotOptimize(reference[QUATERNION_COUNT - 1]);
+    });
+    Report("Nlerp (per call)", nlerpCall, 0.0f, 0.0f, ok);
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        double batch = BenchBest([&]() {
+            NlerpBatch(q1.Soa(), q2.Soa(), amounts.data(), out.Soa(), QUATERNION_COUNT);
+            DoNotOptimize(out.x[QUATERNION_COUNT - 1]);
+        });
+
+        char name[64];
+        snprintf(name, sizeof(name), "NlerpBatch %s", SimdLevelName((SimdLevel)level));
+        Report(name, batch, MaxError(out, reference), 0.0f, ok);
+    }
+    SetSimdLevel(supported);
+
+    // Odd counts go through the scalar tail
+    SlerpBatch(q1.Soa(), q2.Soa(), amounts.data(), out.Soa(), 13);
+    for (int i = 0; i < 13; i++) reference[i] = Slerp(q1.Get(i), q2.Get(i), amounts[i]);
+    float tailError = 0.0f;
+    for (int i = 0; i < 13; i++) tailError = fmaxf(tailError, fabsf(out.x[i] - reference[i].x) + fabsf(out.w[i] - reference[i].w));
+    ok = ok && (tailError <= 2.0f * SLERP_TOLERANCE);
+
+    printf("\n%s\n", ok ? "Batches match scalar Slerp/Nlerp" : "Mismatch against scalar Slerp/Nlerp");
+
+    return ok ? 0 : 1;
+}
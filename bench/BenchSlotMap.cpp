@@ -0,0 +1,174 @@
+// Benchmark and validation of the generational slot map (src/SlotMap.h)
+// Bullet churn: every frame 100k of the live bullets are erased and 100k new ones inserted,
+// then every live bullet is looked up by handle and all of them are updated. Compared with
+// std::unordered_map keyed by an incrementing id, with 64-bit and 32-bit handles
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchSlotMap.cpp
+#include "SlotMap.h"
+#include "Math.h"
+#include "Bench.h"
+#include <unordered_map>
+#include <vector>
+
+static const int LIVE_COUNT = 250000;
+static const int CHURN_COUNT = 100000;
+static const int FRAME_COUNT = 20;
+
+struct Bullet {
+    Vector2 position;
+    Vector2 velocity;
+    float life;
+    int owner;
+};
+
+static bool SameBullet(const Bullet& a, const Bullet& b)
+{
+    return memcmp(&a, &b, sizeof(Bullet)) == 0;
+}
+
+// Live bullet as the game would track it: a handle into the slot map and the id in the unordered_map
+template <typename H>
+struct LiveBullet {
+    H handle;
+    uint64_t id;
+};
+
+struct FrameTimes {
+    double erase;
+    double insert;
+    double lookup;
+    double iterate;
+};
+
+template <typename H>
+static bool RunChurn(const char* label, FrameTimes* slotBest, FrameTimes* mapBest)
+{
+    const float dt = 1.0f/60.0f;
+
+    SlotMap<Bullet, H> slots;
+    std::unordered_map<uint64_t, Bullet> map;
+    std::vector<LiveBullet<H>> live, erased;
+    std::vector<Bullet> spawned(CHURN_COUNT);
+    uint64_t nextId = 1;
+
+    SeedRandom(1005);
+    auto Spawn = [&](uint64_t id) {
+        return Bullet{ { Random(0.0f, 800.0f), Random(0.0f, 800.0f) }, { Random(-300.0f, 300.0f), Random(-300.0f, 300.0f) }, 2.0f, (int)(id & 7) };
+    };
+    for (int i = 0; i < LIVE_COUNT; i++)
+    {
+        Bullet bullet = Spawn(nextId);
+        live.push_back(LiveBullet<H>{ InsertSlot(&slots, bullet), nextId });
+        map[nextId++] = bullet;
+    }
+
+    *slotBest = FrameTimes{ 1e30, 1e30, 1e30, 1e30 };
+    *mapBest = FrameTimes{ 1e30, 1e30, 1e30, 1e30 };
+    bool ok = true;
+    for (int frame = 0; frame < FRAME_COUNT; frame++)
+    {
+        // Pick the bullets that die this frame (random live ones) and the ones that spawn
+        erased.clear();
+        for (int i = 0; i < CHURN_COUNT; i++)
+        {
+            int pick = (int)(NextRandom(GetThreadRandomState()) % live.size());
+            erased.push_back(live[pick]);
+            live[pick] = live.back();
+            live.pop_back();
+        }
+        for (int i = 0; i < CHURN_COUNT; i++) spawned[i] = Spawn(nextId + i);
+
+        double t0 = BenchTime();
+        for (const LiveBullet<H>& bullet : erased) EraseSlot(&slots, bullet.handle);
+        double t1 = BenchTime();
+        for (const LiveBullet<H>& bullet : erased) map.erase(bullet.id);
+        double t2 = BenchTime();
+        slotBest->erase = fmin(slotBest->erase, t1 - t0);
+        mapBest->erase = fmin(mapBest->erase, t2 - t1);
+
+        size_t first = live.size();
+        t0 = BenchTime();
+        for (int i = 0; i < CHURN_COUNT; i++) live.push_back(LiveBullet<H>{ InsertSlot(&slots, spawned[i]), 0 });
+        t1 = BenchTime();
+        for (int i = 0; i < CHURN_COUNT; i++) map.emplace(nextId + i, spawned[i]);
+        t2 = BenchTime();
+        for (int i = 0; i < CHURN_COUNT; i++) live[first + i].id = nextId + i;
+        nextId += CHURN_COUNT;
+        slotBest->insert = fmin(slotBest->insert, t1 - t0);
+        mapBest->insert = fmin(mapBest->insert, t2 - t1);
+
+        // Follow every reference the game holds, as targeting or rendering by handle would
+        float slotSum = 0.0f, mapSum = 0.0f;
+        t0 = BenchTime();
+        for (const LiveBullet<H>& bullet : live) slotSum += GetSlot(&slots, bullet.handle)->life;
+        t1 = BenchTime();
+        for (const LiveBullet<H>& bullet : live) mapSum += map.find(bullet.id)->second.life;
+        t2 = BenchTime();
+        DoNotOptimize(slotSum);
+        DoNotOptimize(mapSum);
+        slotBest->lookup = fmin(slotBest->lookup, t1 - t0);
+        mapBest->lookup = fmin(mapBest->lookup, t2 - t1);
+
+        // Update every bullet
+        t0 = BenchTime();
+        for (Bullet& bullet : slots.values)
+        {
+            bullet.position = bullet.position + bullet.velocity*dt;
+            bullet.life -= dt;
+        }
+        t1 = BenchTime();
+        for (auto& entry : map)
+        {
+            entry.second.position = entry.second.position + entry.second.velocity*dt;
+            entry.second.life -= dt;
+        }
+        t2 = BenchTime();
+        slotBest->iterate = fmin(slotBest->iterate, t1 - t0);
+        mapBest->iterate = fmin(mapBest->iterate, t2 - t1);
+
+        // Both containers hold the same bullets, erased handles are stale
+        bool pass = (GetSlotMapCount(&slots) == LIVE_COUNT) && (map.size() == (size_t)LIVE_COUNT);
+        for (const LiveBullet<H>& bullet : live)
+        {
+            const Bullet* found = FindSlot(&slots, bullet.handle);
+            pass = pass && found && SameBullet(*found, map[bullet.id]);
+        }
+        for (const LiveBullet<H>& bullet : erased) pass = pass && !IsSlotValid(&slots, bullet.handle) && !FindSlot(&slots, bullet.handle);
+        pass = pass && !EraseSlot(&slots, erased[0].handle);
+        if (!pass) printf("%s: mismatch in frame %d\n", label, frame);
+        ok = ok && pass;
+    }
+
+    // Null handle and ClearSlotMap()
+    ok = ok && !IsSlotValid(&slots, SlotHandleTraits<H>::Make(0, 0));
+    ClearSlotMap(&slots);
+    for (const LiveBullet<H>& bullet : live) ok = ok && !IsSlotValid(&slots, bullet.handle);
+    ok = ok && (GetSlotMapCount(&slots) == 0);
+
+    return ok;
+}
+
+static void PrintTimes(const char* name, const FrameTimes& times, const FrameTimes& reference)
+{
+    double total = times.erase + times.insert + times.lookup + times.iterate;
+    double referenceTotal = reference.erase + reference.insert + reference.lookup + reference.iterate;
+    printf("%-28s %8.2f %8.2f %8.2f %8.2f %8.2f %8.2fx\n", name, times.erase*1e3, times.insert*1e3, times.lookup*1e3, times.iterate*1e3,
+        total*1e3, referenceTotal/total);
+}
+
+int main()
+{
+    printf("Slot map, %d live bullets, %d erased + %d inserted per frame, best of %d frames (ms)\n\n", LIVE_COUNT, CHURN_COUNT, CHURN_COUNT, FRAME_COUNT);
+    printf("%-28s %8s %8s %8s %8s %8s %9s\n", "", "erase", "insert", "lookup", "iterate", "frame", "vs map");
+
+    FrameTimes slot64, map64, slot32, map32;
+    bool ok = RunChurn<SlotHandle>("SlotHandle", &slot64, &map64);
+    ok = RunChurn<SlotHandle32>("SlotHandle32", &slot32, &map32) && ok;
+
+    PrintTimes("std::unordered_map", map64, map64);
+    PrintTimes("SlotMap, 64-bit handles", slot64, map64);
+    PrintTimes("SlotMap, 32-bit handles", slot32, map64);
+
+    printf("\n%s\n", ok ? "Slot map matches std::unordered_map" : "Slot map mismatch");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,249 @@
+// Benchmark and validation of the spatial hash grid broadphase (src/SpatialGrid.h)
+// Moving circles at constant density: all colliding pairs by brute force (raylib's
+// CheckCollisionCircles on every pair) and by grid build + candidate pairs + the same
+// narrowphase, from 1k to 100k circles. Then rectangles, radius and rectangle queries, and
+// a 60 tick run of 100k circles against the 60 Hz frame budget
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc /Iinclude bench\BenchSpatialGrid.cpp
+#include "SpatialGrid.h"
+#include "RaylibReference.h"
+#include "Bench.h"
+#include <algorithm>
+#include <vector>
+
+static const float AREA_PER_OBJECT = 400.0f;    // World area per object, about 20x20 px
+static const float MIN_RADIUS = 2.0f;
+static const float MAX_RADIUS = 5.0f;
+static const int BRUTE_FORCE_LIMIT = 32000;     // Larger scenes are checked with a sweep instead
+static const float CELL_SIZE = 4.0f*MAX_RADIUS;   // Two diameters of the largest circle
+static const int QUERY_COUNT = 1000;
+
+struct Scene {
+    float size;
+    std::vector<Vector2> centers;
+    std::vector<Vector2> velocities;
+    std::vector<float> radii;
+};
+
+static Scene MakeScene(int count)
+{
+    Scene scene;
+    scene.size = sqrtf(count*AREA_PER_OBJECT);
+    for (int i = 0; i < count; i++)
+    {
+        scene.centers.push_back(Vector2{ Random(0.0f, scene.size), Random(0.0f, scene.size) });
+        scene.velocities.push_back(Vector2{ Random(-60.0f, 60.0f), Random(-60.0f, 60.0f) });
+        scene.radii.push_back(Random(MIN_RADIUS, MAX_RADIUS));
+    }
+
+    return scene;
+}
+
+static void MoveScene(Scene* scene, float dt)
+{
+    for (size_t i = 0; i < scene->centers.size(); i++)
+    {
+        Vector2& p = scene->centers[i];
+        Vector2& v = scene->velocities[i];
+        p = p + v*dt;
+        if (p.x < 0.0f || p.x > scene->size) v.x = -v.x;
+        if (p.y < 0.0f || p.y > scene->size) v.y = -v.y;
+        p = Clamp(p, Vector2{ 0.0f, 0.0f }, Vector2{ scene->size, scene->size });
+    }
+}
+
+static void BruteForcePairs(const Scene& scene, std::vector<GridPair>* pairs)
+{
+    pairs->clear();
+    int count = (int)scene.centers.size();
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = i + 1; j < count; j++)
+        {
+            if (ref::CheckCollisionCircles(scene.centers[i], scene.radii[i], scene.centers[j], scene.radii[j])) pairs->push_back(GridPair{ i, j });
+        }
+    }
+}
+
+// Independent reference for the scenes too large for brute force: sort by left edge and sweep
+static void SweepPairs(const Scene& scene, std::vector<GridPair>* pairs)
+{
+    pairs->clear();
+    int count = (int)scene.centers.size();
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return scene.centers[a].x - scene.radii[a] < scene.centers[b].x - scene.radii[b]; });
+
+    for (int i = 0; i < count; i++)
+    {
+        int a = order[i];
+        float right = scene.centers[a].x + scene.radii[a];
+        for (int j = i + 1; j < count && scene.centers[order[j]].x - scene.radii[order[j]] <= right; j++)
+        {
+            int b = order[j];
+            if (ref::CheckCollisionCircles(scene.centers[a], scene.radii[a], scene.centers[b], scene.radii[b])) pairs->push_back((a < b) ? GridPair{ a, b } : GridPair{ b, a });
+        }
+    }
+}
+
+static void GridPairs(SpatialGrid* grid, const Scene& scene, std::vector<GridPair>* candidates, std::vector<GridPair>* pairs)
+{
+    BuildSpatialGridCircles(grid, scene.centers.data(), scene.radii.data(), (int)scene.centers.size());
+    FindSpatialGridPairs(grid, candidates);
+
+    pairs->clear();
+    for (GridPair pair : *candidates)
+    {
+        if (ref::CheckCollisionCircles(scene.centers[pair.a], scene.radii[pair.a], scene.centers[pair.b], scene.radii[pair.b])) pairs->push_back(pair);
+    }
+}
+
+static bool SamePairs(std::vector<GridPair> a, std::vector<GridPair> b)
+{
+    auto less = [](GridPair x, GridPair y) { return (x.a < y.a) || (x.a == y.a && x.b < y.b); };
+    std::sort(a.begin(), a.end(), less);
+    std::sort(b.begin(), b.end(), less);
+
+    return (a.size() == b.size()) && std::equal(a.begin(), a.end(), b.begin(), [](GridPair x, GridPair y) { return x.a == y.a && x.b == y.b; });
+}
+
+static bool SameSet(std::vector<int> a, std::vector<int> b)
+{
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+
+    return a == b;
+}
+
+int main()
+{
+    bool ok = true;
+    SeedRandom(1005);
+
+    printf("Spatial hash grid, circles of radius %.0f-%.0f, %.0f px^2 per circle, cell %.0f px\n\n", MIN_RADIUS, MAX_RADIUS, AREA_PER_OBJECT, CELL_SIZE);
+    printf("%-10s %12s %12s %10s %12s %10s\n", "circles", "brute ms", "grid ms", "speedup", "candidates", "pairs");
+
+    SpatialGrid grid = CreateSpatialGrid(CELL_SIZE, 0);
+    std::vector<GridPair> candidates, pairs, reference;
+    const int counts[] = { 1000, 4000, 16000, 32000, 100000 };
+    for (int count : counts)
+    {
+        Scene scene = MakeScene(count);
+        MoveScene(&scene, 1.0f/60.0f);
+
+        double bruteTime = 0.0;
+        if (count <= BRUTE_FORCE_LIMIT) bruteTime = BenchBest([&]() { BruteForcePairs(scene, &reference); }, (count > 4000) ? 0.0 : 0.2);
+        else SweepPairs(scene, &reference);
+
+        double gridTime = BenchBest([&]() { GridPairs(&grid, scene, &candidates, &pairs); });
+        bool pass = SamePairs(pairs, reference);
+        ok = ok && pass;
+
+        if (count <= BRUTE_FORCE_LIMIT) printf("%-10d %12.3f %12.3f %9.1fx %12d %10d %s\n", count, bruteTime*1e3, gridTime*1e3, bruteTime/gridTime, (int)candidates.size(), (int)pairs.size(), pass ? "" : "FAIL");
+        else printf("%-10d %12s %12.3f %10s %12d %10d %s\n", count, "-", gridTime*1e3, "-", (int)candidates.size(), (int)pairs.size(), pass ? "(checked by sweep)" : "FAIL");
+    }
+
+    // Rectangles of very different widths and heights, CheckCollisionRecs as narrowphase
+    {
+        const int count = 16000;
+        float size = sqrtf(count*AREA_PER_OBJECT);
+        std::vector<Rectangle> recs(count);
+        for (Rectangle& rec : recs) rec = Rectangle{ Random(0.0f, size), Random(0.0f, size), Random(2.0f, 14.0f), Random(2.0f, 14.0f) };
+
+        std::vector<GridPair> recPairs, recReference;
+        for (int i = 0; i < count; i++)
+        {
+            for (int j = i + 1; j < count; j++) if (ref::CheckCollisionRecs(recs[i], recs[j])) recReference.push_back(GridPair{ i, j });
+        }
+
+        SpatialGrid recGrid = CreateSpatialGrid(2.0f*14.0f, 0);
+        double recTime = BenchBest([&]() {
+            BuildSpatialGridRecs(&recGrid, recs.data(), count);
+            FindSpatialGridPairs(&recGrid, &candidates);
+            recPairs.clear();
+            for (GridPair pair : candidates) if (ref::CheckCollisionRecs(recs[pair.a], recs[pair.b])) recPairs.push_back(pair);
+        });
+        bool pass = SamePairs(recPairs, recReference);
+        ok = ok && pass;
+        printf("\n%-34s %8.3f ms, %d pairs %s\n", "16k rectangles", recTime*1e3, (int)recPairs.size(), pass ? "" : "FAIL");
+    }
+
+    // Queries against a brute force scan of the same boxes
+    {
+        Scene scene = MakeScene(16000);
+        BuildSpatialGridCircles(&grid, scene.centers.data(), scene.radii.data(), (int)scene.centers.size());
+
+        std::vector<Rectangle> rects(QUERY_COUNT);
+        std::vector<Vector2> points(QUERY_COUNT);
+        std::vector<float> reach(QUERY_COUNT);
+        for (int q = 0; q < QUERY_COUNT; q++)
+        {
+            rects[q] = Rectangle{ Random(-50.0f, scene.size), Random(-50.0f, scene.size), Random(10.0f, 200.0f), Random(10.0f, 200.0f) };
+            points[q] = Vector2{ Random(0.0f, scene.size), Random(0.0f, scene.size) };
+            reach[q] = Random(5.0f, 100.0f);
+        }
+
+        bool pass = true;
+        std::vector<int> found, expected;
+        for (int q = 0; q < QUERY_COUNT; q++)
+        {
+            found.clear();
+            expected.clear();
+            QuerySpatialGridRec(&grid, rects[q], &found);
+            for (int i = 0; i < (int)scene.centers.size(); i++) if (GridBoxesOverlap(grid.boxes[i], GridBoxFromRec(rects[q]))) expected.push_back(i);
+            pass = pass && SameSet(found, expected);
+
+            found.clear();
+            expected.clear();
+            QuerySpatialGridCircle(&grid, points[q], reach[q], &found);
+            for (int i = 0; i < (int)scene.centers.size(); i++)
+            {
+                const GridBox& box = grid.boxes[i];
+                float dx = points[q].x - Clamp(points[q].x, box.minX, box.maxX);
+                float dy = points[q].y - Clamp(points[q].y, box.minY, box.maxY);
+                if (dx*dx + dy*dy <= reach[q]*reach[q]) expected.push_back(i);
+            }
+            pass = pass && SameSet(found, expected);
+        }
+        ok = ok && pass;
+
+        double rectTime = BenchBest([&]() {
+            for (int q = 0; q < QUERY_COUNT; q++) { found.clear(); QuerySpatialGridRec(&grid, rects[q], &found); }
+            DoNotOptimize(found.size());
+        });
+        double circleTime = BenchBest([&]() {
+            for (int q = 0; q < QUERY_COUNT; q++) { found.clear(); QuerySpatialGridCircle(&grid, points[q], reach[q], &found); }
+            DoNotOptimize(found.size());
+        });
+        double scanTime = BenchBest([&]() {
+            for (int q = 0; q < QUERY_COUNT; q++)
+            {
+                found.clear();
+                GridBox box = GridBoxFromRec(rects[q]);
+                for (int i = 0; i < (int)scene.centers.size(); i++) if (GridBoxesOverlap(grid.boxes[i], box)) found.push_back(i);
+            }
+            DoNotOptimize(found.size());
+        });
+        printf("%-34s %8.3f us/query (scan %.3f us) %s\n", "Rectangle queries, 16k circles", rectTime*1e6/QUERY_COUNT, scanTime*1e6/QUERY_COUNT, pass ? "" : "FAIL");
+        printf("%-34s %8.3f us/query %s\n", "Radius queries, 16k circles", circleTime*1e6/QUERY_COUNT, pass ? "" : "FAIL");
+    }
+
+    // 100k moving circles, one second of ticks: move, rebuild, pairs, narrowphase
+    {
+        Scene scene = MakeScene(100000);
+        double total = 0.0, worst = 0.0;
+        for (int tick = 0; tick < 60; tick++)
+        {
+            double t0 = BenchTime();
+            MoveScene(&scene, 1.0f/60.0f);
+            GridPairs(&grid, scene, &candidates, &pairs);
+            double t1 = BenchTime();
+            total += t1 - t0;
+            worst = fmax(worst, t1 - t0);
+        }
+        printf("%-34s %8.3f ms/tick average, %.3f ms worst (60 Hz budget 16.7 ms)\n", "100k circles, 60 ticks", total*1e3/60, worst*1e3);
+    }
+
+    printf("\n%s\n", ok ? "Grid pairs and queries match brute force" : "Grid mismatch");
+
+    return ok ? 0 : 1;
+}
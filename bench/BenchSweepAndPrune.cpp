@@ -0,0 +1,234 @@
+// Benchmark and validation of the sort and sweep broadphase (src/SweepAndPrune.h)
+// Bullets and enemies moving through a side-scroller strip and, for contrast, through an open
+// square world of the same area. Per frame: the sweep (insertion sort update + pairs at each
+// SIMD level), the spatial grid rebuilt from scratch and, for the smaller scenes, brute force
+// CheckCollisionRecs on every pair. Pairs are checked against the grid every frame and against
+// brute force once per scene, churn (objects added and removed) is checked at the end
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc /Iinclude bench\BenchSweepAndPrune.cpp
+#include "SweepAndPrune.h"
+#include "SpatialGrid.h"
+#include "RaylibReference.h"
+#include "Bench.h"
+#include <algorithm>
+#include <vector>
+
+static const float AREA_PER_OBJECT = 1600.0f;   // World area per object, about 40x40 px
+static const float STRIP_HEIGHT = 720.0f;
+static const float MAX_SIZE = 32.0f;
+static const int BRUTE_FORCE_LIMIT = 16000;
+static const int FRAME_COUNT = 30;
+
+struct Scene {
+    float width;
+    float height;
+    std::vector<Rectangle> recs;
+    std::vector<Vector2> velocities;
+};
+
+// One object in eight is an enemy of 16-32 px, the rest are bullets of 2-8 px
+static void SpawnObject(Scene* scene, int i, bool scroller)
+{
+    bool enemy = (i % 8) == 0;
+    float size = enemy ? Random(16.0f, MAX_SIZE) : Random(2.0f, 8.0f);
+    float speed = enemy ? Random(30.0f, 120.0f) : Random(200.0f, 800.0f);
+    float direction = (Random(0.0f, 1.0f) < 0.5f) ? -1.0f : 1.0f;
+
+    scene->recs[i] = Rectangle{ Random(0.0f, scene->width - size), Random(0.0f, scene->height - size), size, size };
+    if (scroller) scene->velocities[i] = Vector2{ direction*speed, Random(-0.1f, 0.1f)*speed };
+    else
+    {
+        float angle = Random(0.0f, 2.0f*PI);
+        scene->velocities[i] = Vector2{ cosf(angle)*speed, sinf(angle)*speed };
+    }
+}
+
+static Scene MakeScene(int count, bool scroller)
+{
+    Scene scene;
+    float area = count*AREA_PER_OBJECT;
+    scene.height = scroller ? STRIP_HEIGHT : sqrtf(area);
+    scene.width = area/scene.height;
+    scene.recs.resize(count);
+    scene.velocities.resize(count);
+    for (int i = 0; i < count; i++) SpawnObject(&scene, i, scroller);
+
+    return scene;
+}
+
+// Bounce off the world edges
+static void MoveScene(Scene* scene, float dt)
+{
+    for (size_t i = 0; i < scene->recs.size(); i++)
+    {
+        Rectangle& rec = scene->recs[i];
+        Vector2& velocity = scene->velocities[i];
+        rec.x += velocity.x*dt;
+        rec.y += velocity.y*dt;
+        if ((rec.x < 0.0f) || (rec.x + rec.width > scene->width)) velocity.x = -velocity.x;
+        if ((rec.y < 0.0f) || (rec.y + rec.height > scene->height)) velocity.y = -velocity.y;
+        rec.x = Clamp(rec.x, 0.0f, scene->width - rec.width);
+        rec.y = Clamp(rec.y, 0.0f, scene->height - rec.height);
+    }
+}
+
+static void BruteForcePairs(const Scene& scene, std::vector<SweepPair>* pairs)
+{
+    pairs->clear();
+    int count = (int)scene.recs.size();
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = i + 1; j < count; j++) if (ref::CheckCollisionRecs(scene.recs[i], scene.recs[j])) pairs->push_back(SweepPair{ i, j });
+    }
+}
+
+static void Narrowphase(const Scene& scene, const std::vector<SweepPair>& candidates, std::vector<SweepPair>* pairs)
+{
+    pairs->clear();
+    for (SweepPair pair : candidates) if (ref::CheckCollisionRecs(scene.recs[pair.a], scene.recs[pair.b])) pairs->push_back(pair);
+}
+
+static void SortPairs(std::vector<SweepPair>* pairs)
+{
+    std::sort(pairs->begin(), pairs->end(), [](SweepPair x, SweepPair y) { return (x.a < y.a) || (x.a == y.a && x.b < y.b); });
+}
+
+static bool SamePairs(std::vector<SweepPair> a, std::vector<SweepPair> b)
+{
+    SortPairs(&a);
+    SortPairs(&b);
+
+    return (a.size() == b.size()) && std::equal(a.begin(), a.end(), b.begin(), [](SweepPair x, SweepPair y) { return x.a == y.a && x.b == y.b; });
+}
+
+static bool SameAsGrid(std::vector<SweepPair> pairs, const std::vector<GridPair>& grid)
+{
+    std::vector<SweepPair> converted(grid.size());
+    for (size_t i = 0; i < grid.size(); i++) converted[i] = SweepPair{ grid[i].a, grid[i].b };
+
+    return SamePairs(pairs, converted);
+}
+
+static bool RunScene(int count, bool scroller)
+{
+    const float dt = 1.0f/60.0f;
+    SimdLevel supported = DetectSimdLevel();
+    bool ok = true;
+
+    Scene scene = MakeScene(count, scroller);
+    SweepAndPrune sap = CreateSweepAndPrune();
+    SpatialGrid grid = CreateSpatialGrid(2.0f*MAX_SIZE, 0);
+    std::vector<SweepPair> candidates, pairs, reference;
+    std::vector<GridPair> gridCandidates;
+
+    UpdateSweepAndPrune(&sap, scene.recs.data(), count);
+    bool firstFull = sap.fullSort;
+
+    double updateTime = 0.0, gridTime = 0.0, bruteTime = 0.0;
+    double levelTime[3] = { 0.0, 0.0, 0.0 };
+    long long moves = 0;
+    int fullSorts = 0;
+    for (int frame = 0; frame < FRAME_COUNT; frame++)
+    {
+        MoveScene(&scene, dt);
+
+        double t0 = BenchTime();
+        UpdateSweepAndPrune(&sap, scene.recs.data(), count);
+        updateTime += BenchTime() - t0;
+        moves += sap.moves;
+        fullSorts += sap.fullSort;
+
+        for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+        {
+            SetSimdLevel((SimdLevel)level);
+            double t1 = BenchTime();
+            FindSweepPairs(&sap, &candidates);
+            levelTime[level] += BenchTime() - t1;
+        }
+        SetSimdLevel(supported);
+
+        double t2 = BenchTime();
+        BuildSpatialGridRecs(&grid, scene.recs.data(), count);
+        FindSpatialGridPairs(&grid, &gridCandidates);
+        gridTime += BenchTime() - t2;
+
+        bool pass = SameAsGrid(candidates, gridCandidates);
+        if ((frame == 0) && (count <= BRUTE_FORCE_LIMIT))
+        {
+            bruteTime = BenchBest([&]() { BruteForcePairs(scene, &reference); }, 0.0);
+            Narrowphase(scene, candidates, &pairs);
+            pass = pass && SamePairs(pairs, reference);
+        }
+        if (!pass) printf("Mismatch in frame %d\n", frame);
+        ok = ok && pass;
+    }
+
+    // Every SIMD level finds the same pairs
+    std::vector<SweepPair> levelPairs[3];
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        FindSweepPairs(&sap, &levelPairs[level]);
+        ok = ok && (levelPairs[level].size() == levelPairs[0].size()) && std::equal(levelPairs[level].begin(), levelPairs[level].end(), levelPairs[0].begin(),
+            [](SweepPair x, SweepPair y) { return x.a == y.a && x.b == y.b; });
+    }
+    SetSimdLevel(supported);
+
+    double best = levelTime[supported];
+    char brute[32] = "-";
+    if (count <= BRUTE_FORCE_LIMIT) snprintf(brute, sizeof(brute), "%.3f", bruteTime*1e3);
+    printf("%-10s %7d %10s %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %8.2fx %7.2f %5d %s\n", scroller ? "scroller" : "open", count, brute,
+        gridTime*1e3/FRAME_COUNT, updateTime*1e3/FRAME_COUNT, levelTime[0]*1e3/FRAME_COUNT,
+        (supported >= SIMD_LEVEL_SSE) ? levelTime[1]*1e3/FRAME_COUNT : 0.0, (supported >= SIMD_LEVEL_AVX2) ? levelTime[2]*1e3/FRAME_COUNT : 0.0,
+        (updateTime + best)*1e3/FRAME_COUNT, gridTime/(updateTime + best), (double)moves/((double)count*FRAME_COUNT), fullSorts, ok ? "" : "FAIL");
+
+    // Only the first update sorts from scratch in a scroller, objects mostly pass few others
+    ok = ok && firstFull && (!scroller || (fullSorts == 0));
+
+    return ok;
+}
+
+int main()
+{
+    bool ok = true;
+    SeedRandom(1005);
+
+    printf("Sort and sweep, bullets of 2-8 px and enemies of 16-32 px, %.0f px^2 per object, %d frames, detected %s\n", AREA_PER_OBJECT, FRAME_COUNT,
+        SimdLevelName(DetectSimdLevel()));
+    printf("Scroller: %.0f px high strip, open: square world. Grid cells %.0f px (ms per frame)\n", STRIP_HEIGHT, 2.0f*MAX_SIZE);
+    printf("moves: insertion sort moves per object and frame, full: updates that sorted from scratch\n\n");
+    printf("%-10s %7s %10s %9s %9s %9s %9s %9s %9s %9s %7s %5s\n", "scene", "objects", "brute", "grid", "update", "scalar", "SSE", "AVX2", "sweep", "vs grid", "moves", "full");
+
+    const int counts[] = { 4000, 16000, 64000, 256000 };
+    for (int count : counts) ok = RunScene(count, true) && ok;
+    for (int count : counts) ok = RunScene(count, false) && ok;
+
+    // Objects added and removed keep the order of the others, the pairs stay right
+    {
+        Scene scene = MakeScene(20000, true);
+        SweepAndPrune sap = CreateSweepAndPrune();
+        SpatialGrid grid = CreateSpatialGrid(2.0f*MAX_SIZE, 0);
+        std::vector<SweepPair> candidates;
+        std::vector<GridPair> gridCandidates;
+        bool pass = true;
+        const int counts[] = { 20000, 15000, 15000, 18000, 5000, 20000 };
+        for (int count : counts)
+        {
+            scene.recs.resize(count);
+            scene.velocities.resize(count);
+            for (int i = (int)scene.recs.size() - 1; (i >= 0) && (scene.recs[i].width == 0.0f); i--) SpawnObject(&scene, i, true);
+            MoveScene(&scene, 1.0f/60.0f);
+
+            UpdateSweepAndPrune(&sap, scene.recs.data(), count);
+            FindSweepPairs(&sap, &candidates);
+            BuildSpatialGridRecs(&grid, scene.recs.data(), count);
+            FindSpatialGridPairs(&grid, &gridCandidates);
+            pass = pass && SameAsGrid(candidates, gridCandidates) && std::is_sorted(sap.minX.begin(), sap.minX.begin() + count);
+        }
+        ok = ok && pass;
+        printf("\n%-34s %s\n", "Objects added and removed", pass ? "ok" : "FAIL");
+    }
+
+    printf("\n%s\n", ok ? "Sweep pairs match brute force and the grid" : "Sweep mismatch");
+
+    return ok ? 0 : 1;
+}
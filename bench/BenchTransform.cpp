@@ -0,0 +1,100 @@
+// Benchmark and validation of the batched point/direction transforms (src/MathBatch.h)
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchTransform.cpp
+#include "MathBatch.h"
+#include "Bench.h"
+#include <vector>
+
+static const int POINT_COUNT = 1 << 20;
+
+static float MaxError(const std::vector<Vector3>& a, const std::vector<Vector3>& reference)
+{
+    float maxError = 0.0f;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        maxError = fmaxf(maxError, fabsf(a[i].x - reference[i].x) / fmaxf(1.0f, fabsf(reference[i].x)));
+        maxError = fmaxf(maxError, fabsf(a[i].y - reference[i].y) / fmaxf(1.0f, fabsf(reference[i].y)));
+        maxError = fmaxf(maxError, fabsf(a[i].z - reference[i].z) / fmaxf(1.0f, fabsf(reference[i].z)));
+    }
+    return maxError;
+}
+
+static void Report(const char* name, double seconds, float error, bool& ok)
+{
+    bool pass = error <= EPSILON;
+    ok = ok && pass;
+    printf("%-28s %8.3f ms %10.1f Mpoints/s   max error %.2e %s\n", name, seconds * 1000.0, POINT_COUNT / seconds * 1e-6, error, pass ? "" : "FAIL");
+}
+
+int main()
+{
+    std::vector<Vector3> points(POINT_COUNT), out(POINT_COUNT), reference(POINT_COUNT);
+    std::vector<float> x(POINT_COUNT), y(POINT_COUNT), z(POINT_COUNT);
+    std::vector<float> outX(POINT_COUNT), outY(POINT_COUNT), outZ(POINT_COUNT);
+
+    SeedRandom(1005);
+    for (int i = 0; i < POINT_COUNT; i++)
+    {
+        points[i] = { Random(-50.0f, 50.0f), Random(-50.0f, 50.0f), Random(-50.0f, 50.0f) };
+        x[i] = points[i].x; y[i] = points[i].y; z[i] = points[i].z;
+    }
+
+    Matrix mat = Multiply(Rotate(Vector3{ 1.0f, 2.0f, 3.0f }, 0.7f), Translate(10.0f, -5.0f, 3.0f));
+    mat = Multiply(Scale(2.0f, 2.0f, 2.0f), mat);
+
+    printf("Vector3 transforms, %d points, detected %s, %u hardware threads\n\n", POINT_COUNT, SimdLevelName(DetectSimdLevel()), std::thread::hardware_concurrency());
+
+    bool ok = true;
+
+    double callTime = BenchBest([&]() {
+        for (int i = 0; i < POINT_COUNT; i++) reference[i] = Multiply(points[i], mat);
+        DoNotOptimize(reference[POINT_COUNT - 1]);
+    });
+    Report("Multiply(Vector3, Matrix)", callTime, 0.0f, ok);
+
+    SimdLevel supported = DetectSimdLevel();
+    for (int level = SIMD_LEVEL_SCALAR; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        char name[64];
+
+        double aosTime = BenchBest([&]() {
+            TransformPoints(points.data(), out.data(), POINT_COUNT, mat);
+            DoNotOptimize(out[POINT_COUNT - 1]);
+        });
+        snprintf(name, sizeof(name), "TransformPoints AoS %s", SimdLevelName((SimdLevel)level));
+        Report(name, aosTime, MaxError(out, reference), ok);
+
+        double soaTime = BenchBest([&]() {
+            TransformPoints(x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), POINT_COUNT, mat);
+            DoNotOptimize(outX[POINT_COUNT - 1]);
+        });
+        for (int i = 0; i < POINT_COUNT; i++) out[i] = { outX[i], outY[i], outZ[i] };
+        snprintf(name, sizeof(name), "TransformPoints SoA %s", SimdLevelName((SimdLevel)level));
+        Report(name, soaTime, MaxError(out, reference), ok);
+    }
+    SetSimdLevel(supported);
+
+    double parallelTime = BenchBest([&]() {
+        TransformPointsParallel(points.data(), out.data(), POINT_COUNT, mat);
+        DoNotOptimize(out[POINT_COUNT - 1]);
+    });
+    Report("TransformPointsParallel AoS", parallelTime, MaxError(out, reference), ok);
+
+    // Directions drop the translation
+    for (int i = 0; i < POINT_COUNT; i++)
+    {
+        Vector3 p = Multiply(points[i], mat);
+        Vector3 t = Multiply(Vector3Zero(), mat);
+        reference[i] = { p.x - t.x, p.y - t.y, p.z - t.z };
+    }
+    TransformDirections(points.data(), out.data(), POINT_COUNT, mat);
+    float directionError = 0.0f;
+    for (int i = 0; i < POINT_COUNT; i++) directionError = fmaxf(directionError, Distance(out[i], reference[i]) / fmaxf(1.0f, Length(reference[i])));
+    bool directionsOk = directionError <= 16 * EPSILON;
+    ok = ok && directionsOk;
+    printf("\nTransformDirections max error %.2e %s\n", directionError, directionsOk ? "" : "FAIL");
+
+    printf("%s\n", ok ? "All paths match Multiply(Vector3, Matrix)" : "Mismatch against Multiply(Vector3, Matrix)");
+
+    return ok ? 0 : 1;
+}
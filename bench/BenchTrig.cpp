@@ -0,0 +1,158 @@
+// Accuracy and throughput of the FastMath.h trigonometry against libm
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchTrig.cpp
+#include "MathBatch.h"
+#include "Bench.h"
+#include <cstring>
+#include <vector>
+
+static const int SAMPLE_COUNT = 1 << 20;
+
+struct ErrorBound {
+    const char* name;
+    float measured;
+    float documented;
+};
+
+static bool Check(const ErrorBound& e)
+{
+    bool pass = e.measured <= e.documented;
+    printf("%-12s max abs error %.2e (documented %.1e) %s\n", e.name, e.measured, e.documented, pass ? "" : "FAIL");
+    return pass;
+}
+
+int main()
+{
+    std::vector<float> a(SAMPLE_COUNT), b(SAMPLE_COUNT), out0(SAMPLE_COUNT), out1(SAMPLE_COUNT);
+    bool ok = true;
+
+    // Accuracy, measured against double precision libm
+    float sinError = 0.0f, cosError = 0.0f, atanError = 0.0f, acosError = 0.0f;
+    for (int i = 0; i < SAMPLE_COUNT; i++)
+    {
+        float x = -8192.0f + 16384.0f * (float)i / (float)(SAMPLE_COUNT - 1);
+        float s, c;
+        FastSinCos(x, &s, &c);
+        sinError = fmaxf(sinError, (float)fabs(s - sin((double)x)));
+        cosError = fmaxf(cosError, (float)fabs(c - cos((double)x)));
+
+        float angle = -PI + 2.0f * PI * (float)i / (float)(SAMPLE_COUNT - 1);
+        float radius = 0.001f + (float)(i % 97);
+        float ax = radius * (float)cos((double)angle), ay = radius * (float)sin((double)angle);
+        atanError = fmaxf(atanError, (float)fabs(FastAtan2(ay, ax) - atan2((double)ay, (double)ax)));
+
+        float v = -1.0f + 2.0f * (float)i / (float)(SAMPLE_COUNT - 1);
+        acosError = fmaxf(acosError, (float)fabs(FastAcos(v) - acos((double)v)));
+    }
+
+    printf("FastMath accuracy, %d samples\n\n", SAMPLE_COUNT);
+    ok &= Check({ "FastSin", sinError, 1.2e-7f });
+    ok &= Check({ "FastCos", cosError, 1.2e-7f });
+    ok &= Check({ "FastAtan2", atanError, 3.0e-7f });
+    ok &= Check({ "FastAcos", acosError, 4.8e-7f });
+
+    // SIMD paths must agree with the scalar approximation
+    SeedRandom(1005);
+    for (int i = 0; i < SAMPLE_COUNT; i++) { a[i] = Random(-100.0f, 100.0f); b[i] = Random(-100.0f, 100.0f); }
+
+    float simdError = 0.0f;
+    SimdLevel supported = DetectSimdLevel();
+    for (int level = SIMD_LEVEL_SSE; level <= supported; level++)
+    {
+        SetSimdLevel((SimdLevel)level);
+        SinCosBatch(a.data(), out0.data(), out1.data(), SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; i++) simdError = fmaxf(simdError, fabsf(out0[i] - FastSin(a[i])));
+        Atan2Batch(a.data(), b.data(), out0.data(), SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; i++) simdError = fmaxf(simdError, fabsf(out0[i] - FastAtan2(a[i], b[i])));
+    }
+    SetSimdLevel(supported);
+    ok &= Check({ "SIMD/scalar", simdError, 1e-7f });
+
+    // Throughput
+    printf("\nThroughput, %d values (detected %s)\n\n", SAMPLE_COUNT, SimdLevelName(supported));
+    double toNs = 1e9 / SAMPLE_COUNT;
+
+    double libmSinCos = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) { out0[i] = sinf(a[i]); out1[i] = cosf(a[i]); }
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+    double fastSinCos = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) FastSinCos(a[i], &out0[i], &out1[i]);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+    double batchSinCos = BenchBest([&]() {
+        SinCosBatch(a.data(), out0.data(), out1.data(), SAMPLE_COUNT);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+
+    double libmAtan2 = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) out0[i] = atan2f(a[i], b[i]);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+    double fastAtan2 = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) out0[i] = FastAtan2(a[i], b[i]);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+    double batchAtan2 = BenchBest([&]() {
+        Atan2Batch(a.data(), b.data(), out0.data(), SAMPLE_COUNT);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+
+    for (int i = 0; i < SAMPLE_COUNT; i++) b[i] = a[i] / 100.0f;
+    double libmAcos = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) out0[i] = acosf(b[i]);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+    double fastAcos = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) out0[i] = FastAcos(b[i]);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+    double batchAcos = BenchBest([&]() {
+        AcosBatch(b.data(), out0.data(), SAMPLE_COUNT);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+
+    printf("%-10s %10s %10s %10s\n", "ns/value", "libm", "fast", "batch");
+    printf("%-10s %10.2f %10.2f %10.2f\n", "sincos", libmSinCos * toNs, fastSinCos * toNs, batchSinCos * toNs);
+    printf("%-10s %10.2f %10.2f %10.2f\n", "atan2", libmAtan2 * toNs, fastAtan2 * toNs, batchAtan2 * toNs);
+    printf("%-10s %10.2f %10.2f %10.2f\n", "acos", libmAcos * toNs, fastAcos * toNs, batchAcos * toNs);
+
+    // Steering update: RotateTowards per agent (libm) against the batch form
+    std::vector<float> fx(SAMPLE_COUNT), fy(SAMPLE_COUNT), tx(SAMPLE_COUNT), ty(SAMPLE_COUNT);
+    for (int i = 0; i < SAMPLE_COUNT; i++)
+    {
+        Vector2 from = Direction(Random(-PI, PI));
+        Vector2 to = Direction(Random(-PI, PI));
+        fx[i] = from.x; fy[i] = from.y; tx[i] = to.x; ty[i] = to.y;
+    }
+
+    std::vector<Vector2> reference(SAMPLE_COUNT);
+    double steerCall = BenchBest([&]() {
+        for (int i = 0; i < SAMPLE_COUNT; i++) reference[i] = RotateTowards(Vector2{ fx[i], fy[i] }, Vector2{ tx[i], ty[i] }, 0.1f);
+        DoNotOptimize(reference[SAMPLE_COUNT - 1]);
+    });
+    double steerBatch = BenchBest([&]() {
+        RotateTowardsBatch(fx.data(), fy.data(), tx.data(), ty.data(), 0.1f, out0.data(), out1.data(), SAMPLE_COUNT);
+        DoNotOptimize(out0[SAMPLE_COUNT - 1]);
+    });
+
+    float steerError = 0.0f;
+    for (int i = 0; i < SAMPLE_COUNT; i++) steerError = fmaxf(steerError, Distance(Vector2{ out0[i], out1[i] }, reference[i]));
+
+    printf("\n%-22s %8.2f ns/agent\n", "RotateTowards", steerCall * toNs);
+    printf("%-22s %8.2f ns/agent   max error %.2e\n", "RotateTowardsBatch", steerBatch * toNs, steerError);
+
+    // Near-parallel directions amplify acos error (derivative is unbounded at 1), allow 1e-3
+    ok &= steerError <= 1e-3f;
+
+    // In place: the signed angles overwrite the 'from' x array they are computed from
+    std::vector<float> inPlace = fx;
+    SignedAngleBatch(fx.data(), fy.data(), tx.data(), ty.data(), out0.data(), SAMPLE_COUNT);
+    SignedAngleBatch(inPlace.data(), fy.data(), tx.data(), ty.data(), inPlace.data(), SAMPLE_COUNT);
+    bool sameInPlace = memcmp(inPlace.data(), out0.data(), sizeof(float) * SAMPLE_COUNT) == 0;
+    printf("%-22s %s\n", "SignedAngleBatch in place", sameInPlace ? "ok" : "FAIL");
+    ok &= sameInPlace;
+
+    printf("\n%s\n", ok ? "Fast trigonometry within documented bounds" : "Fast trigonometry out of bounds");
+
+    return ok ? 0 : 1;
+}
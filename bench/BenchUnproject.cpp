@@ -0,0 +1,103 @@
+// Benchmark and validation of the cached Unprojector against per-call Unproject (src/Unprojector.h)
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc /Iinclude bench\BenchUnproject.cpp
+#include "Unprojector.h"
+#include "Bench.h"
+#include <vector>
+
+static const int MARKER_COUNT = 100000;
+
+int main()
+{
+    Camera3D camera = { 0 };
+    camera.position = Vector3{ 10.0f, 12.0f, 10.0f };
+    camera.target = Vector3{ 0.0f, 0.0f, 0.0f };
+    camera.up = Vector3{ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    const int width = 1280, height = 720;
+    Matrix projection, view;
+    GetCameraMatrices(camera, width, height, &projection, &view);
+
+    std::vector<Vector3> sources(MARKER_COUNT), reference(MARKER_COUNT), out(MARKER_COUNT);
+    SeedRandom(1005);
+    for (int i = 0; i < MARKER_COUNT; i++) sources[i] = Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(0.0f, 0.99f) };
+
+    double perCall = BenchBest([&]() {
+        for (int i = 0; i < MARKER_COUNT; i++) reference[i] = Unproject(sources[i], projection, view);
+        DoNotOptimize(reference[MARKER_COUNT - 1]);
+    });
+
+    Unprojector unprojector = CreateUnprojector(camera, width, height);
+    double cached = BenchBest([&]() {
+        for (int i = 0; i < MARKER_COUNT; i++) out[i] = Unproject(unprojector, sources[i]);
+        DoNotOptimize(out[MARKER_COUNT - 1]);
+    });
+
+    float cachedError = 0.0f;
+    for (int i = 0; i < MARKER_COUNT; i++) cachedError = fmaxf(cachedError, Distance(out[i], reference[i]) / fmaxf(1.0f, Length(reference[i])));
+
+    double batch = BenchBest([&]() {
+        UnprojectBatch(unprojector, sources.data(), out.data(), MARKER_COUNT);
+        DoNotOptimize(out[MARKER_COUNT - 1]);
+    });
+
+    float batchError = 0.0f;
+    for (int i = 0; i < MARKER_COUNT; i++) batchError = fmaxf(batchError, Distance(out[i], reference[i]) / fmaxf(1.0f, Length(reference[i])));
+
+    // Rays: compare with the GetMouseRay formulation built on per-call Unproject
+    std::vector<Vector2> mouse(MARKER_COUNT);
+    std::vector<Ray> rays(MARKER_COUNT);
+    for (int i = 0; i < MARKER_COUNT; i++) mouse[i] = Vector2{ Random(0.0f, (float)width), Random(0.0f, (float)height) };
+
+    double rayTime = BenchBest([&]() {
+        GetUnprojectorRays(unprojector, mouse.data(), rays.data(), MARKER_COUNT);
+        DoNotOptimize(rays[MARKER_COUNT - 1]);
+    });
+
+    float rayError = 0.0f;
+    for (int i = 0; i < MARKER_COUNT; i++)
+    {
+        float x = (2.0f * mouse[i].x) / (float)width - 1.0f;
+        float y = 1.0f - (2.0f * mouse[i].y) / (float)height;
+        Vector3 nearPoint = Unproject(Vector3{ x, y, 0.0f }, projection, view);
+        Vector3 farPoint = Unproject(Vector3{ x, y, 1.0f }, projection, view);
+        Vector3 direction = Normalize(Subtract(farPoint, nearPoint));
+        rayError = fmaxf(rayError, Distance(direction, rays[i].direction));
+    }
+
+    // Unchanged camera must not rebuild the inverse
+    bool rebuilt = UpdateUnprojector(&unprojector, camera, width, height);
+
+    // Orthographic rays start on the camera plane, also when built from the matrices alone
+    float orthoError = 0.0f;
+    {
+        Camera3D ortho = camera;
+        ortho.projection = CAMERA_ORTHOGRAPHIC;
+        ortho.fovy = 20.0f;
+        Matrix orthoProjection, orthoView;
+        GetCameraMatrices(ortho, width, height, &orthoProjection, &orthoView);
+        Unprojector fromCamera = CreateUnprojector(ortho, width, height);
+        Unprojector fromMatrices = CreateUnprojector(orthoProjection, orthoView, width, height);
+        for (int i = 0; i < 1000; i++)
+        {
+            Ray a = GetUnprojectorRay(fromCamera, mouse[i]);
+            Ray b = GetUnprojectorRay(fromMatrices, mouse[i]);
+            orthoError = fmaxf(orthoError, fmaxf(Distance(a.position, b.position), Distance(a.direction, b.direction)));
+        }
+        if (fromMatrices.camera.projection != CAMERA_ORTHOGRAPHIC) orthoError = 1.0f;
+    }
+
+    double toNs = 1e9 / MARKER_COUNT;
+    printf("Unproject, %d points\n\n", MARKER_COUNT);
+    printf("%-26s %8.2f ns/point\n", "Unproject (per call)", perCall * toNs);
+    printf("%-26s %8.2f ns/point   max error %.2e\n", "Unproject (cached)", cached * toNs, cachedError);
+    printf("%-26s %8.2f ns/point   max error %.2e\n", "UnprojectBatch", batch * toNs, batchError);
+    printf("%-26s %8.2f ns/ray     max error %.2e\n", "GetUnprojectorRays", rayTime * toNs, rayError);
+    printf("%-26s %8s           max error %.2e\n", "Orthographic from matrices", "", orthoError);
+
+    bool ok = (cachedError <= 1e-4f) && (batchError <= 1e-4f) && (rayError <= 1e-4f) && (orthoError <= 1e-4f) && !rebuilt;
+    printf("\n%s\n", ok ? "Cached unprojection matches Unproject" : "Mismatch against Unproject");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+// Benchmark and validation of the register resident Vector4Simd/QuaternionSimd (src/Vector4Simd.h)
+// against the by-value Math.h Quaternion functions
+// Build (MSVC): cl /O2 /EHsc /std:c++17 /Isrc bench\BenchVector4Simd.cpp
+#include "Vector4Simd.h"
+#include "Bench.h"
+#include <vector>
+
+static const int QUATERNION_COUNT = 1 << 16;
+
+// Sums add in a different order than Math.h, Nlerp of nearly opposite quaternions amplifies the difference
+static const float SIMD_TOLERANCE = 4e-6f;
+
+static float QuaternionError(Quaternion a, Quaternion b)
+{
+    return fmaxf(fmaxf(fabsf(a.x - b.x), fabsf(a.y - b.y)), fmaxf(fabsf(a.z - b.z), fabsf(a.w - b.w)));
+}
+
+static void Report(const char* name, double mathSeconds, double simdSeconds, float error, bool& ok)
+{
+    bool pass = error <= SIMD_TOLERANCE;
+    ok = ok && pass;
+    double toNs = 1e9 / QUATERNION_COUNT;
+    printf("%-34s %10.2f %10.2f %7.2fx   max error %.2e %s\n", name, mathSeconds * toNs, simdSeconds * toNs, mathSeconds / simdSeconds, error, pass ? "" : "FAIL");
+}
+
+int main()
+{
+    std::vector<Quaternion> a(QUATERNION_COUNT), b(QUATERNION_COUNT), c(QUATERNION_COUNT);
+    std::vector<Quaternion> outMath(QUATERNION_COUNT), outSimd(QUATERNION_COUNT);
+    std::vector<Vector3> points(QUATERNION_COUNT), outPointsMath(QUATERNION_COUNT), outPointsSimd(QUATERNION_COUNT);
+    std::vector<float> amounts(QUATERNION_COUNT);
+
+    SeedRandom(1005);
+    for (int i = 0; i < QUATERNION_COUNT; i++)
+    {
+        Vector3 axis = Normalize(Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) + 0.001f });
+        a[i] = FromAxisAngle(axis, Random(-PI, PI));
+        b[i] = FromAxisAngle(Vector3{ axis.y, axis.z, axis.x }, Random(-PI, PI));
+        c[i] = FromAxisAngle(Vector3{ axis.z, axis.x, axis.y }, Random(-PI, PI));
+        points[i] = Vector3{ Random(-10.0f, 10.0f), Random(-10.0f, 10.0f), Random(-10.0f, 10.0f) };
+        amounts[i] = Random(0.0f, 1.0f);
+    }
+
+    printf("Quaternion chains, %d quaternions, %s, sizeof(Vector4Simd) %d, alignof %d\n\n", QUATERNION_COUNT,
+        MATH_SIMD_SSE ? "SSE" : "scalar fallback", (int)sizeof(Vector4Simd), (int)alignof(Vector4Simd));
+    printf("%-34s %10s %10s %8s\n", "", "Math.h ns", "Simd ns", "speedup");
+
+    bool ok = true;
+    auto maxError = [&]() {
+        float error = 0.0f;
+        for (int i = 0; i < QUATERNION_COUNT; i++) error = fmaxf(error, QuaternionError(outMath[i], outSimd[i]));
+        return error;
+    };
+
+    // Normalize(Multiply(q1, q2))
+    double math = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++) outMath[i] = Normalize(Multiply(a[i], b[i]));
+        DoNotOptimize(outMath[QUATERNION_COUNT - 1]);
+    });
+    double simd = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++) outSimd[i] = ToQuaternion(Normalize(Multiply(ToSimd(a[i]), ToSimd(b[i]))));
+        DoNotOptimize(outSimd[QUATERNION_COUNT - 1]);
+    });
+    Report("Normalize(Multiply(q1, q2))", math, simd, maxError(), ok);
+
+    // Three level chain with an interpolation, every intermediate stays in a register
+    math = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++) outMath[i] = Nlerp(Multiply(Multiply(a[i], b[i]), c[i]), Invert(c[i]), amounts[i]);
+        DoNotOptimize(outMath[QUATERNION_COUNT - 1]);
+    });
+    simd = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++)
+        {
+            QuaternionSimd qc = ToSimd(c[i]);
+            outSimd[i] = ToQuaternion(Nlerp(Multiply(Multiply(ToSimd(a[i]), ToSimd(b[i])), qc), Invert(qc), amounts[i]));
+        }
+        DoNotOptimize(outSimd[QUATERNION_COUNT - 1]);
+    });
+    Report("Nlerp(Multiply(Multiply()), Invert)", math, simd, maxError(), ok);
+
+    // Dependent chain, as in a skeleton walk accumulating rotations
+    Quaternion accumMath = QuaternionIdentity();
+    Quaternion accumSimd = QuaternionIdentity();
+    math = BenchBest([&]() {
+        Quaternion world = QuaternionIdentity();
+        for (int i = 0; i < QUATERNION_COUNT; i++) world = Normalize(Multiply(world, a[i]));
+        accumMath = world;
+        DoNotOptimize(world);
+    });
+    simd = BenchBest([&]() {
+        QuaternionSimd world = QuaternionSimdIdentity();
+        for (int i = 0; i < QUATERNION_COUNT; i++) world = Normalize(Multiply(world, ToSimd(a[i])));
+        accumSimd = ToQuaternion(world);
+        DoNotOptimize(world);
+    });
+    printf("%-34s %10.2f %10.2f %7.2fx   final error %.2e\n", "Accumulated Normalize(Multiply)", math * 1e9 / QUATERNION_COUNT, simd * 1e9 / QUATERNION_COUNT, math / simd, QuaternionError(accumMath, accumSimd));
+
+    // Rotate points
+    math = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++) outPointsMath[i] = Rotate(points[i], a[i]);
+        DoNotOptimize(outPointsMath[QUATERNION_COUNT - 1]);
+    });
+    simd = BenchBest([&]() {
+        for (int i = 0; i < QUATERNION_COUNT; i++) outPointsSimd[i] = Rotate(points[i], ToSimd(a[i]));
+        DoNotOptimize(outPointsSimd[QUATERNION_COUNT - 1]);
+    });
+    float rotateError = 0.0f;
+    for (int i = 0; i < QUATERNION_COUNT; i++) rotateError = fmaxf(rotateError, Distance(outPointsMath[i], outPointsSimd[i]) / fmaxf(1.0f, Length(points[i])));
+    Report("Rotate(Vector3, q)", math, simd, rotateError, ok);
+
+    printf("\n%s\n", ok ? "Vector4Simd matches Math.h" : "Mismatch against Math.h");
+
+    return ok ? 0 : 1;
+}
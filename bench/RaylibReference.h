@@ -0,0 +1,431 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include <cfloat>
+
+//----------------------------------------------------------------------------------
+// Reference copies of the raylib collision functions (rshapes.c, rmodels.c, zlib license)
+//
+// The bundled raylib.lib only links with MSVC, so benches compare against these ports to
+// measure raylib's code on any platform. They live in namespace ref because raylib.h
+// already declares the same names
+//----------------------------------------------------------------------------------
+namespace ref {
+
+// Check collision between two rectangles
+inline bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2)
+{
+    bool collision = false;
+
+    if ((rec1.x < (rec2.x + rec2.width) && (rec1.x + rec1.width) > rec2.x) &&
+        (rec1.y < (rec2.y + rec2.height) && (rec1.y + rec1.height) > rec2.y)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two circles
+inline bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    bool collision = false;
+
+    float dx = center2.x - center1.x;
+    float dy = center2.y - center1.y;
+
+    float distanceSquared = dx*dx + dy*dy;
+    float radiusSum = radius1 + radius2;
+
+    collision = (distanceSquared <= (radiusSum*radiusSum));
+
+    return collision;
+}
+
+// Check collision between circle and rectangle
+inline bool CheckCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
+{
+    bool collision = false;
+
+    float recCenterX = rec.x + rec.width/2.0f;
+    float recCenterY = rec.y + rec.height/2.0f;
+
+    float dx = fabsf(center.x - recCenterX);
+    float dy = fabsf(center.y - recCenterY);
+
+    if (dx > (rec.width/2.0f + radius)) { return false; }
+    if (dy > (rec.height/2.0f + radius)) { return false; }
+
+    if (dx <= (rec.width/2.0f)) { return true; }
+    if (dy <= (rec.height/2.0f)) { return true; }
+
+    float cornerDistanceSq = (dx - rec.width/2.0f)*(dx - rec.width/2.0f) +
+                             (dy - rec.height/2.0f)*(dy - rec.height/2.0f);
+
+    collision = (cornerDistanceSq <= (radius*radius));
+
+    return collision;
+}
+
+// Check if point is inside rectangle
+inline bool CheckCollisionPointRec(Vector2 point, Rectangle rec)
+{
+    bool collision = false;
+
+    if ((point.x >= rec.x) && (point.x < (rec.x + rec.width)) && (point.y >= rec.y) && (point.y < (rec.y + rec.height))) collision = true;
+
+    return collision;
+}
+
+// Check if point is inside circle
+inline bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius)
+{
+    return ref::CheckCollisionCircles(point, 0, center, radius);
+}
+
+// Check if point is inside a triangle defined by three points (p1, p2, p3)
+inline bool CheckCollisionPointTriangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3)
+{
+    bool collision = false;
+
+    float alpha = ((p2.y - p3.y)*(point.x - p3.x) + (p3.x - p2.x)*(point.y - p3.y)) /
+                  ((p2.y - p3.y)*(p1.x - p3.x) + (p3.x - p2.x)*(p1.y - p3.y));
+
+    float beta = ((p3.y - p1.y)*(point.x - p3.x) + (p1.x - p3.x)*(point.y - p3.y)) /
+                 ((p2.y - p3.y)*(p1.x - p3.x) + (p3.x - p2.x)*(p1.y - p3.y));
+
+    float gamma = 1.0f - alpha - beta;
+
+    if ((alpha > 0) && (beta > 0) && (gamma > 0)) collision = true;
+
+    return collision;
+}
+
+// Check if point is within a polygon described by array of vertices
+inline bool CheckCollisionPointPoly(Vector2 point, const Vector2* points, int pointCount)
+{
+    bool inside = false;
+
+    if (pointCount > 2)
+    {
+        for (int i = 0, j = pointCount - 1; i < pointCount; j = i++)
+        {
+            if ((points[i].y > point.y) != (points[j].y > point.y) &&
+                (point.x < (points[j].x - points[i].x)*(point.y - points[i].y)/(points[j].y - points[i].y) + points[i].x))
+            {
+                inside = !inside;
+            }
+        }
+    }
+
+    return inside;
+}
+
+// Check the collision between two lines defined by two points each, returns collision point by reference
+inline bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2* collisionPoint)
+{
+    bool collision = false;
+
+    float div = (endPos2.y - startPos2.y)*(endPos1.x - startPos1.x) - (endPos2.x - startPos2.x)*(endPos1.y - startPos1.y);
+
+    if (fabsf(div) >= FLT_EPSILON)
+    {
+        collision = true;
+
+        float xi = ((startPos2.x - endPos2.x)*(startPos1.x*endPos1.y - startPos1.y*endPos1.x) - (startPos1.x - endPos1.x)*(startPos2.x*endPos2.y - startPos2.y*endPos2.x))/div;
+        float yi = ((startPos2.y - endPos2.y)*(startPos1.x*endPos1.y - startPos1.y*endPos1.x) - (startPos1.y - endPos1.y)*(startPos2.x*endPos2.y - startPos2.y*endPos2.x))/div;
+
+        if (((fabsf(startPos1.x - endPos1.x) > FLT_EPSILON) && (xi < fminf(startPos1.x, endPos1.x) || (xi > fmaxf(startPos1.x, endPos1.x)))) ||
+            ((fabsf(startPos2.x - endPos2.x) > FLT_EPSILON) && (xi < fminf(startPos2.x, endPos2.x) || (xi > fmaxf(startPos2.x, endPos2.x)))) ||
+            ((fabsf(startPos1.y - endPos1.y) > FLT_EPSILON) && (yi < fminf(startPos1.y, endPos1.y) || (yi > fmaxf(startPos1.y, endPos1.y)))) ||
+            ((fabsf(startPos2.y - endPos2.y) > FLT_EPSILON) && (yi < fminf(startPos2.y, endPos2.y) || (yi > fmaxf(startPos2.y, endPos2.y))))) collision = false;
+
+        if (collision && (collisionPoint != 0))
+        {
+            collisionPoint->x = xi;
+            collisionPoint->y = yi;
+        }
+    }
+
+    return collision;
+}
+
+// Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
+inline bool CheckCollisionPointLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold)
+{
+    bool collision = false;
+
+    float dxc = point.x - p1.x;
+    float dyc = point.y - p1.y;
+    float dxl = p2.x - p1.x;
+    float dyl = p2.y - p1.y;
+    float cross = dxc*dyl - dyc*dxl;
+
+    if (fabsf(cross) < (threshold*fmaxf(fabsf(dxl), fabsf(dyl))))
+    {
+        if (fabsf(dxl) >= fabsf(dyl)) collision = (dxl > 0)? ((p1.x <= point.x) && (point.x <= p2.x)) : ((p2.x <= point.x) && (point.x <= p1.x));
+        else collision = (dyl > 0)? ((p1.y <= point.y) && (point.y <= p2.y)) : ((p2.y <= point.y) && (point.y <= p1.y));
+    }
+
+    return collision;
+}
+
+// Check collision between two spheres
+inline bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+{
+    bool collision = false;
+
+    // Check for distances squared to avoid sqrtf()
+    if (Dot(Subtract(center2, center1), Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two boxes
+inline bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    {
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Check collision between box and sphere
+inline bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
+{
+    bool collision = false;
+
+    float dmin = 0;
+
+    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
+    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+
+    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
+    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+
+    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
+    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+
+    if (dmin <= (radius*radius)) collision = true;
+
+    return collision;
+}
+
+// Get collision info between ray and sphere
+inline RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
+{
+    RayCollision collision = { 0 };
+
+    Vector3 raySpherePos = Subtract(center, ray.position);
+    float vector = Dot(raySpherePos, ray.direction);
+    float distance = Length(raySpherePos);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    collision.hit = d >= 0.0f;
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    if (distance < radius)
+    {
+        collision.distance = vector + sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Add(ray.position, Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing outwards)
+        collision.normal = Negate(Normalize(Subtract(collision.point, center)));
+    }
+    else
+    {
+        collision.distance = vector - sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Add(ray.position, Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing inwards)
+        collision.normal = Normalize(Subtract(collision.point, center));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and box
+inline RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+{
+    RayCollision collision = { 0 };
+
+    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
+    // Reversing ray.direction will give use the correct result
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+
+    if (insideBox) ray.direction = Negate(ray.direction);
+
+    float t[11] = { 0 };
+
+    t[8] = 1.0f/ray.direction.x;
+    t[9] = 1.0f/ray.direction.y;
+    t[10] = 1.0f/ray.direction.z;
+
+    t[0] = (box.min.x - ray.position.x)*t[8];
+    t[1] = (box.max.x - ray.position.x)*t[8];
+    t[2] = (box.min.y - ray.position.y)*t[9];
+    t[3] = (box.max.y - ray.position.y)*t[9];
+    t[4] = (box.min.z - ray.position.z)*t[10];
+    t[5] = (box.max.z - ray.position.z)*t[10];
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
+    collision.distance = t[6];
+    collision.point = Add(ray.position, Scale(ray.direction, collision.distance));
+
+    // Get box center point
+    collision.normal = Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    collision.normal = Subtract(collision.point, collision.normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    collision.normal = Scale(collision.normal, 2.01f);
+    collision.normal = Divide(collision.normal, Subtract(box.max, box.min));
+    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+
+    collision.normal = Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        // Reset ray.direction
+        ray.direction = Negate(ray.direction);
+        // Fix result
+        collision.distance *= -1.0f;
+        collision.normal = Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+inline RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    RayCollision collision = { 0 };
+    Vector3 edge1 = { 0 };
+    Vector3 edge2 = { 0 };
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Subtract(p2, p1);
+    edge2 = Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Cross(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Dot(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Dot(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Cross(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Dot(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Dot(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Normalize(Cross(edge1, edge2));
+        collision.point = Add(ray.position, Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+inline RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+{
+    RayCollision collision = { 0 };
+
+    collision = ref::GetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = ref::GetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+// Get collision info between ray and mesh
+inline RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh.vertices != NULL)
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a, b, c;
+            Vector3* vertdata = (Vector3*)mesh.vertices;
+
+            if (mesh.indices)
+            {
+                a = vertdata[mesh.indices[i*3 + 0]];
+                b = vertdata[mesh.indices[i*3 + 1]];
+                c = vertdata[mesh.indices[i*3 + 2]];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            a = Multiply(a, transform);
+            b = Multiply(b, transform);
+            c = Multiply(c, transform);
+
+            RayCollision triHitInfo = ref::GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+    }
+
+    return collision;
+}
+
+} // namespace ref
@@ -0,0 +1,629 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include <cmath>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Dynamic AABB tree (2D broadphase for objects of any size)
+//
+// A binary tree of bounding boxes, every leaf is one object (a proxy), every inner node
+// bounds its two children. Unlike a uniform grid it does not care how object sizes compare:
+// a 2000 px wall is one leaf, next to bullets of 2 px
+//
+// Leaves store a fat box: the object's box grown by 'margin' and stretched along its
+// displacement. MoveAabbProxy() does nothing while the object stays inside its fat box, an
+// object that leaves it is removed and inserted again. Inserts walk down to the sibling that
+// grows the tree's total perimeter the least, and every node on the way back up is rebalanced
+// with a rotation when one child is more than one level taller than the other, so the
+// height stays logarithmic even when objects are inserted in sorted order
+//
+// Proxy ids are node indices: stable from CreateAabbProxy() to DestroyAabbProxy(), reused
+// afterwards
+//
+// Pairs come from one walk over pairs of subtrees whose boxes overlap, not from a query per
+// proxy. Static and dynamic objects can share the tree: a static proxy is never moved, so
+// FindAabbTreeMovedPairs() skips every subtree without a proxy that moved out of its fat box
+// since the last call, and the level geometry is never tested against itself. Level
+// geometry can also live in a tree of its own, FindAabbTreePairs(&movers, &level, &pairs)
+// pairs the two trees
+//
+// Usage:
+//   AabbTree tree = CreateAabbTree(2.0f);
+//   int wall = CreateAabbProxy(&tree, AabbBoxFromRec(wallRec), WALL);
+//   int bullet = CreateAabbProxy(&tree, AabbBoxFromRec(bulletRec), 7);
+//   MoveAabbProxy(&tree, bullet, AabbBoxFromRec(bulletRec), velocity*dt);    // every tick
+//   FindAabbTreeMovedPairs(&tree, &pairs);       // new candidate pairs, narrowphase decides
+//   QueryAabbTreePoint(&tree, GetMousePosition(), &found);
+//   RaycastAabbTree(&tree, muzzle, target, [&](int proxy, float maxFraction) { ... });
+//
+// NOTE: Pairs and queries test the fat boxes, the narrowphase tests the objects
+// NOTE: Node storage grows as a vector, references to nodes are invalidated by
+// CreateAabbProxy() and MoveAabbProxy(), keep proxy ids
+//----------------------------------------------------------------------------------
+
+#ifndef TREEAPI
+#define TREEAPI inline
+#endif
+
+#define AABB_NULL -1
+
+// A moving proxy's fat box reaches this many displacements ahead
+#ifndef AABB_TREE_PREDICTION
+#define AABB_TREE_PREDICTION 4.0f
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct AabbBox {
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+};
+
+struct AabbPair {
+    int a;                          // Smaller proxy id
+    int b;
+};
+
+struct AabbNode {
+    AabbBox box;                    // Fat box for leaves, union of the children otherwise
+    int parent;                     // Next free node while the node is free
+    int child1;                     // AABB_NULL for leaves
+    int child2;
+    int height;                     // 0 for leaves, -1 for free nodes
+    int data;                       // User data of a leaf
+    bool moved;                     // Leaf inserted since the last FindAabbTreeMovedPairs(), inner
+                                    // node above such a leaf (during FindAabbTreeMovedPairs() only)
+};
+
+struct AabbTree {
+    std::vector<AabbNode> nodes;
+    int root;
+    int freeList;
+    int proxyCount;
+    float margin;                   // Fat box growth on every side
+    std::vector<int> moved;         // Proxies with 'moved' set
+    std::vector<int> stack;         // Traversal scratch
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Boxes
+//----------------------------------------------------------------------------------
+
+TREEAPI AabbBox AabbBoxFromRec(Rectangle rec)
+{
+    return AabbBox{ rec.x, rec.y, rec.x + rec.width, rec.y + rec.height };
+}
+
+TREEAPI AabbBox AabbBoxFromCircle(Vector2 center, float radius)
+{
+    return AabbBox{ center.x - radius, center.y - radius, center.x + radius, center.y + radius };
+}
+
+// Closed intervals, boxes that touch overlap
+TREEAPI bool AabbBoxesOverlap(const AabbBox& a, const AabbBox& b)
+{
+    return (a.minX <= b.maxX) && (b.minX <= a.maxX) && (a.minY <= b.maxY) && (b.minY <= a.maxY);
+}
+
+TREEAPI bool AabbBoxContains(const AabbBox& outer, const AabbBox& inner)
+{
+    return (outer.minX <= inner.minX) && (outer.minY <= inner.minY) && (inner.maxX <= outer.maxX) && (inner.maxY <= outer.maxY);
+}
+
+TREEAPI AabbBox AabbBoxUnion(const AabbBox& a, const AabbBox& b)
+{
+    return AabbBox{ fminf(a.minX, b.minX), fminf(a.minY, b.minY), fmaxf(a.maxX, b.maxX), fmaxf(a.maxY, b.maxY) };
+}
+
+// Insertion cost: the perimeter is the 2D surface area heuristic
+TREEAPI float AabbBoxPerimeter(const AabbBox& box)
+{
+    return 2.0f*((box.maxX - box.minX) + (box.maxY - box.minY));
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Tree structure
+//----------------------------------------------------------------------------------
+
+// Empty tree, 'margin' grows every fat box (a few pixels for moving objects)
+TREEAPI AabbTree CreateAabbTree(float margin)
+{
+    AabbTree tree = {};
+    tree.root = AABB_NULL;
+    tree.freeList = AABB_NULL;
+    tree.margin = margin;
+
+    return tree;
+}
+
+TREEAPI void DestroyAabbTree(AabbTree* tree)
+{
+    *tree = CreateAabbTree(tree->margin);
+}
+
+TREEAPI int AllocateAabbNode(AabbTree* tree)
+{
+    int index = tree->freeList;
+    if (index == AABB_NULL)
+    {
+        index = (int)tree->nodes.size();
+        tree->nodes.push_back(AabbNode{});
+    }
+    else tree->freeList = tree->nodes[index].parent;
+
+    AabbNode& node = tree->nodes[index];
+    node.parent = AABB_NULL;
+    node.child1 = AABB_NULL;
+    node.child2 = AABB_NULL;
+    node.height = 0;
+    node.data = 0;
+    node.moved = false;
+
+    return index;
+}
+
+TREEAPI void FreeAabbNode(AabbTree* tree, int index)
+{
+    tree->nodes[index].parent = tree->freeList;
+    tree->nodes[index].height = -1;
+    tree->freeList = index;
+}
+
+// Refit an inner node from its children
+TREEAPI void RefitAabbNode(AabbTree* tree, int index)
+{
+    AabbNode& node = tree->nodes[index];
+    const AabbNode& child1 = tree->nodes[node.child1];
+    const AabbNode& child2 = tree->nodes[node.child2];
+    node.box = AabbBoxUnion(child1.box, child2.box);
+    node.height = 1 + ((child1.height > child2.height) ? child1.height : child2.height);
+}
+
+// Rotate the taller grandchild of node A up when A's children differ in height by more than
+// one, returns the node now in A's place
+TREEAPI int BalanceAabbNode(AabbTree* tree, int iA)
+{
+    std::vector<AabbNode>& nodes = tree->nodes;
+    if (nodes[iA].child1 == AABB_NULL) return iA;
+
+    int iB = nodes[iA].child1;
+    int iC = nodes[iA].child2;
+    int balance = nodes[iC].height - nodes[iB].height;
+    if ((balance >= -1) && (balance <= 1)) return iA;
+
+    // Child U (the taller one) goes up, A takes U's shorter child in place of U
+    int iU = (balance > 1) ? iC : iB;
+    int iX = nodes[iU].child1;
+    int iY = nodes[iU].child2;
+    int iKeep = (nodes[iX].height > nodes[iY].height) ? iX : iY;
+    int iMove = (iKeep == iX) ? iY : iX;
+
+    nodes[iU].child1 = iA;
+    nodes[iU].child2 = iKeep;
+    nodes[iU].parent = nodes[iA].parent;
+    nodes[iA].parent = iU;
+
+    int parent = nodes[iU].parent;
+    if (parent == AABB_NULL) tree->root = iU;
+    else if (nodes[parent].child1 == iA) nodes[parent].child1 = iU;
+    else nodes[parent].child2 = iU;
+
+    if (iU == iC) nodes[iA].child2 = iMove;
+    else nodes[iA].child1 = iMove;
+    nodes[iMove].parent = iA;
+
+    RefitAabbNode(tree, iA);
+    RefitAabbNode(tree, iU);
+
+    return iU;
+}
+
+// Refit and rebalance from 'index' up to the root
+TREEAPI void RefitAabbAncestors(AabbTree* tree, int index)
+{
+    while (index != AABB_NULL)
+    {
+        index = BalanceAabbNode(tree, index);
+        RefitAabbNode(tree, index);
+        index = tree->nodes[index].parent;
+    }
+}
+
+TREEAPI void InsertAabbLeaf(AabbTree* tree, int leaf)
+{
+    if (tree->root == AABB_NULL)
+    {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = AABB_NULL;
+        return;
+    }
+
+    // Walk down to the sibling that costs the least: the new parent's perimeter plus the
+    // growth of every ancestor on the way
+    const AabbBox leafBox = tree->nodes[leaf].box;
+    int index = tree->root;
+    while (tree->nodes[index].child1 != AABB_NULL)
+    {
+        const AabbNode& node = tree->nodes[index];
+        float perimeter = AabbBoxPerimeter(node.box);
+        float combined = AabbBoxPerimeter(AabbBoxUnion(node.box, leafBox));
+        float cost = 2.0f*combined;                     // Sibling of this whole subtree
+        float inheritance = 2.0f*(combined - perimeter);  // Growth of this node if we descend
+
+        float childCost[2];
+        const int children[2] = { node.child1, node.child2 };
+        for (int c = 0; c < 2; c++)
+        {
+            const AabbNode& child = tree->nodes[children[c]];
+            float grown = AabbBoxPerimeter(AabbBoxUnion(leafBox, child.box));
+            childCost[c] = inheritance + ((child.child1 == AABB_NULL) ? grown : grown - AabbBoxPerimeter(child.box));
+        }
+
+        if ((cost < childCost[0]) && (cost < childCost[1])) break;
+        index = (childCost[0] < childCost[1]) ? children[0] : children[1];
+    }
+
+    int sibling = index;
+    int oldParent = tree->nodes[sibling].parent;
+    int newParent = AllocateAabbNode(tree);
+    tree->nodes[newParent].parent = oldParent;
+    tree->nodes[newParent].child1 = sibling;
+    tree->nodes[newParent].child2 = leaf;
+    tree->nodes[sibling].parent = newParent;
+    tree->nodes[leaf].parent = newParent;
+
+    if (oldParent == AABB_NULL) tree->root = newParent;
+    else if (tree->nodes[oldParent].child1 == sibling) tree->nodes[oldParent].child1 = newParent;
+    else tree->nodes[oldParent].child2 = newParent;
+
+    RefitAabbAncestors(tree, newParent);
+}
+
+TREEAPI void RemoveAabbLeaf(AabbTree* tree, int leaf)
+{
+    if (leaf == tree->root)
+    {
+        tree->root = AABB_NULL;
+        return;
+    }
+
+    // The sibling takes the parent's place
+    int parent = tree->nodes[leaf].parent;
+    int grandParent = tree->nodes[parent].parent;
+    int sibling = (tree->nodes[parent].child1 == leaf) ? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+    FreeAabbNode(tree, parent);
+    tree->nodes[sibling].parent = grandParent;
+
+    if (grandParent == AABB_NULL)
+    {
+        tree->root = sibling;
+        return;
+    }
+
+    if (tree->nodes[grandParent].child1 == parent) tree->nodes[grandParent].child1 = sibling;
+    else tree->nodes[grandParent].child2 = sibling;
+    RefitAabbAncestors(tree, grandParent);
+}
+
+TREEAPI void MarkAabbProxyMoved(AabbTree* tree, int proxy)
+{
+    if (tree->nodes[proxy].moved) return;
+
+    tree->nodes[proxy].moved = true;
+    tree->moved.push_back(proxy);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Proxies
+//----------------------------------------------------------------------------------
+
+// Add an object with bounding box 'box', returns its proxy id
+TREEAPI int CreateAabbProxy(AabbTree* tree, AabbBox box, int data)
+{
+    int proxy = AllocateAabbNode(tree);
+    AabbNode& node = tree->nodes[proxy];
+    node.box = AabbBox{ box.minX - tree->margin, box.minY - tree->margin, box.maxX + tree->margin, box.maxY + tree->margin };
+    node.data = data;
+
+    InsertAabbLeaf(tree, proxy);
+    MarkAabbProxyMoved(tree, proxy);
+    tree->proxyCount++;
+
+    return proxy;
+}
+
+TREEAPI void DestroyAabbProxy(AabbTree* tree, int proxy)
+{
+    // A pending move would report pairs of a dead proxy
+    if (tree->nodes[proxy].moved)
+    {
+        for (size_t i = 0; i < tree->moved.size(); i++)
+        {
+            if (tree->moved[i] == proxy) { tree->moved[i] = tree->moved.back(); tree->moved.pop_back(); break; }
+        }
+    }
+
+    RemoveAabbLeaf(tree, proxy);
+    FreeAabbNode(tree, proxy);
+    tree->proxyCount--;
+}
+
+// Update a proxy to its object's new 'box', moved by 'displacement' since the last update.
+// Returns true when the proxy left its fat box and was inserted again
+TREEAPI bool MoveAabbProxy(AabbTree* tree, int proxy, AabbBox box, Vector2 displacement)
+{
+    float margin = tree->margin;
+    AabbBox fat = { box.minX - margin, box.minY - margin, box.maxX + margin, box.maxY + margin };
+
+    // Stretch along the displacement, where the object is going next
+    Vector2 ahead = displacement*AABB_TREE_PREDICTION;
+    if (ahead.x < 0.0f) fat.minX += ahead.x;
+    else fat.maxX += ahead.x;
+    if (ahead.y < 0.0f) fat.minY += ahead.y;
+    else fat.maxY += ahead.y;
+
+    // Still inside, and the fat box is not far larger than a new one would be (a fast object
+    // that stopped)
+    const AabbBox current = tree->nodes[proxy].box;
+    if (AabbBoxContains(current, box))
+    {
+        AabbBox huge = { fat.minX - 4.0f*margin, fat.minY - 4.0f*margin, fat.maxX + 4.0f*margin, fat.maxY + 4.0f*margin };
+        if (AabbBoxContains(huge, current)) return false;
+    }
+
+    RemoveAabbLeaf(tree, proxy);
+    tree->nodes[proxy].box = fat;
+    InsertAabbLeaf(tree, proxy);
+    MarkAabbProxyMoved(tree, proxy);
+
+    return true;
+}
+
+TREEAPI int GetAabbProxyData(const AabbTree* tree, int proxy)
+{
+    return tree->nodes[proxy].data;
+}
+
+TREEAPI AabbBox GetAabbProxyBox(const AabbTree* tree, int proxy)
+{
+    return tree->nodes[proxy].box;
+}
+
+TREEAPI int GetAabbTreeHeight(const AabbTree* tree)
+{
+    return (tree->root == AABB_NULL) ? 0 : tree->nodes[tree->root].height;
+}
+
+// Check every link, box and height of the tree, for tests
+TREEAPI bool ValidateAabbTree(const AabbTree* tree)
+{
+    if (tree->root == AABB_NULL) return tree->proxyCount == 0;
+    if (tree->nodes[tree->root].parent != AABB_NULL) return false;
+
+    int leaves = 0;
+    std::vector<int> pending = { tree->root };
+    while (!pending.empty())
+    {
+        int index = pending.back();
+        pending.pop_back();
+        const AabbNode& node = tree->nodes[index];
+        if (node.child1 == AABB_NULL)
+        {
+            if ((node.child2 != AABB_NULL) || (node.height != 0)) return false;
+            leaves++;
+            continue;
+        }
+
+        const AabbNode& child1 = tree->nodes[node.child1];
+        const AabbNode& child2 = tree->nodes[node.child2];
+        if ((child1.parent != index) || (child2.parent != index)) return false;
+        if (node.height != 1 + ((child1.height > child2.height) ? child1.height : child2.height)) return false;
+        if (!AabbBoxContains(node.box, child1.box) || !AabbBoxContains(node.box, child2.box)) return false;
+
+        pending.push_back(node.child1);
+        pending.push_back(node.child2);
+    }
+
+    return leaves == tree->proxyCount;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Queries
+//----------------------------------------------------------------------------------
+
+// Call fn(proxy) for every proxy whose fat box overlaps 'box', fn returns false to stop
+template <typename Fn>
+TREEAPI void QueryAabbTree(AabbTree* tree, AabbBox box, Fn&& fn)
+{
+    if (tree->root == AABB_NULL) return;
+
+    std::vector<int>& stack = tree->stack;
+    stack.clear();
+    stack.push_back(tree->root);
+    while (!stack.empty())
+    {
+        int index = stack.back();
+        stack.pop_back();
+        const AabbNode& node = tree->nodes[index];
+        if (!AabbBoxesOverlap(node.box, box)) continue;
+
+        if (node.child1 == AABB_NULL)
+        {
+            if (!fn(index)) return;
+        }
+        else
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+}
+
+// Append the proxies overlapping 'rec' to 'results', returns how many were added
+TREEAPI int QueryAabbTreeRec(AabbTree* tree, Rectangle rec, std::vector<int>* results)
+{
+    size_t before = results->size();
+    QueryAabbTree(tree, AabbBoxFromRec(rec), [results](int proxy) { results->push_back(proxy); return true; });
+
+    return (int)(results->size() - before);
+}
+
+TREEAPI int QueryAabbTreePoint(AabbTree* tree, Vector2 point, std::vector<int>* results)
+{
+    size_t before = results->size();
+    QueryAabbTree(tree, AabbBox{ point.x, point.y, point.x, point.y }, [results](int proxy) { results->push_back(proxy); return true; });
+
+    return (int)(results->size() - before);
+}
+
+// Cast the segment start-end through the tree. fn(proxy, maxFraction) is called for every
+// proxy whose fat box the segment crosses before maxFraction, and returns:
+//   - the fraction (0..1) where the segment hits the object: clips the segment there
+//   - maxFraction to ignore the proxy and go on
+//   - 0 to stop
+// The closest hit is found by clipping at every hit, any hit by returning 0 at the first one
+template <typename Fn>
+TREEAPI void RaycastAabbTree(AabbTree* tree, Vector2 start, Vector2 end, Fn&& fn)
+{
+    if (tree->root == AABB_NULL) return;
+
+    Vector2 delta = end - start;
+    float length = Length(delta);
+    if (length <= 0.0f) return;
+
+    // Separating axis: the segment's normal
+    Vector2 normal = { -delta.y/length, delta.x/length };
+    Vector2 absNormal = { fabsf(normal.x), fabsf(normal.y) };
+
+    float maxFraction = 1.0f;
+    Vector2 clipped = end;
+    AabbBox segment = { fminf(start.x, clipped.x), fminf(start.y, clipped.y), fmaxf(start.x, clipped.x), fmaxf(start.y, clipped.y) };
+
+    std::vector<int>& stack = tree->stack;
+    stack.clear();
+    stack.push_back(tree->root);
+    while (!stack.empty())
+    {
+        int index = stack.back();
+        stack.pop_back();
+        const AabbNode& node = tree->nodes[index];
+        if (!AabbBoxesOverlap(node.box, segment)) continue;
+
+        // The box is on one side of the segment's line
+        Vector2 center = { 0.5f*(node.box.minX + node.box.maxX), 0.5f*(node.box.minY + node.box.maxY) };
+        Vector2 extents = { 0.5f*(node.box.maxX - node.box.minX), 0.5f*(node.box.maxY - node.box.minY) };
+        if (fabsf(Dot(normal, start - center)) - Dot(absNormal, extents) > 0.0f) continue;
+
+        if (node.child1 != AABB_NULL)
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+            continue;
+        }
+
+        float value = fn(index, maxFraction);
+        if (value == 0.0f) return;
+        if ((value > 0.0f) && (value < maxFraction))
+        {
+            maxFraction = value;
+            clipped = start + delta*maxFraction;
+            segment = AabbBox{ fminf(start.x, clipped.x), fminf(start.y, clipped.y), fmaxf(start.x, clipped.x), fmaxf(start.y, clipped.y) };
+        }
+    }
+}
+
+// Pairs of overlapping leaves between the subtrees of 'treeA' and 'treeB'. With the same tree
+// on both sides, the pairs within it, each once
+TREEAPI void CollectAabbTreePairs(const AabbTree* treeA, const AabbTree* treeB, bool movedOnly, std::vector<int>* stack, std::vector<AabbPair>* pairs)
+{
+    // Node pairs to test, two stack entries each: (a, b) for the pairs between subtrees a and
+    // b, and within one tree (n, n) for the pairs inside subtree n
+    bool self = (treeA == treeB);
+    stack->clear();
+    stack->push_back(treeA->root);
+    stack->push_back(treeB->root);
+    while (!stack->empty())
+    {
+        int b = stack->back();
+        stack->pop_back();
+        int a = stack->back();
+        stack->pop_back();
+        const AabbNode& nodeA = treeA->nodes[a];
+        const AabbNode& nodeB = treeB->nodes[b];
+
+        // Moved only: subtrees without a moved leaf are skipped
+        if (movedOnly && !nodeA.moved && !nodeB.moved) continue;
+        if (self && (a == b))
+        {
+            if (nodeA.child1 == AABB_NULL) continue;
+
+            int pending[6] = { nodeA.child1, nodeA.child1, nodeA.child2, nodeA.child2, nodeA.child1, nodeA.child2 };
+            stack->insert(stack->end(), pending, pending + 6);
+            continue;
+        }
+
+        if (!AabbBoxesOverlap(nodeA.box, nodeB.box)) continue;
+
+        bool leafA = (nodeA.child1 == AABB_NULL), leafB = (nodeB.child1 == AABB_NULL);
+        if (leafA && leafB) pairs->push_back((self && (b < a)) ? AabbPair{ b, a } : AabbPair{ a, b });
+        else if (leafB || (!leafA && (AabbBoxPerimeter(nodeA.box) >= AabbBoxPerimeter(nodeB.box))))
+        {
+            // Descend into the larger node
+            int pending[4] = { nodeA.child1, b, nodeA.child2, b };
+            stack->insert(stack->end(), pending, pending + 4);
+        }
+        else
+        {
+            int pending[4] = { a, nodeB.child1, a, nodeB.child2 };
+            stack->insert(stack->end(), pending, pending + 4);
+        }
+    }
+}
+
+// Replace 'pairs' with every pair of proxies whose fat boxes overlap, each pair once
+TREEAPI int FindAabbTreePairs(AabbTree* tree, std::vector<AabbPair>* pairs)
+{
+    pairs->clear();
+    if (tree->root != AABB_NULL) CollectAabbTreePairs(tree, tree, false, &tree->stack, pairs);
+
+    return (int)pairs->size();
+}
+
+// Replace 'pairs' with every overlapping pair of a proxy of 'tree' (pair.a) and a proxy of
+// 'other' (pair.b): moving objects against a tree of level geometry
+TREEAPI int FindAabbTreePairs(AabbTree* tree, const AabbTree* other, std::vector<AabbPair>* pairs)
+{
+    pairs->clear();
+    if ((tree->root != AABB_NULL) && (other->root != AABB_NULL)) CollectAabbTreePairs(tree, other, false, &tree->stack, pairs);
+
+    return (int)pairs->size();
+}
+
+// Replace 'pairs' with the pairs of overlapping fat boxes where at least one proxy moved
+// (was created or left its fat box) since the last call: the pairs that can have started
+// touching. Clears the moved proxies
+TREEAPI int FindAabbTreeMovedPairs(AabbTree* tree, std::vector<AabbPair>* pairs)
+{
+    pairs->clear();
+    if (tree->root == AABB_NULL) return 0;
+
+    // Flag the ancestors of the moved leaves, the walk through the tree skips the rest
+    for (int proxy : tree->moved)
+    {
+        for (int index = tree->nodes[proxy].parent; (index != AABB_NULL) && !tree->nodes[index].moved; index = tree->nodes[index].parent) tree->nodes[index].moved = true;
+    }
+
+    CollectAabbTreePairs(tree, tree, true, &tree->stack, pairs);
+
+    for (int proxy : tree->moved)
+    {
+        for (int index = proxy; (index != AABB_NULL) && tree->nodes[index].moved; index = tree->nodes[index].parent) tree->nodes[index].moved = false;
+    }
+    tree->moved.clear();
+
+    return (int)pairs->size();
+}
@@ -0,0 +1,335 @@
+#pragma once
+#include "Math.h"
+
+//----------------------------------------------------------------------------------
+// Compact affine transforms
+//
+// Scene transforms never use the projective row of a Matrix. Transform2D (3x2, 24 bytes)
+// and Affine3 (3x4, 48 bytes) store only the rows that change, named after the Matrix
+// fields they replace, and skip the fourth row in every multiply
+//
+// Same conventions as Matrix: points are column vectors, Multiply(left, right) applies
+// left first, then right
+//
+// Usage:
+//   Affine3 world = Multiply(local, parentWorld);
+//   Vector3 p = Multiply(point, world);
+//   rlMultMatrixf(MatrixToFloat(ToMatrix(world)));
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// 2D affine transform: x' = m0*x + m4*y + m12, y' = m1*x + m5*y + m13
+typedef struct Transform2D {
+    float m0, m4, m12;          // First row (x axis column, y axis column, translation)
+    float m1, m5, m13;          // Second row
+} Transform2D;
+
+// 3D affine transform, a Matrix without the (0, 0, 0, 1) fourth row
+typedef struct Affine3 {
+    float m0, m4, m8, m12;      // First row (3 linear components + translation)
+    float m1, m5, m9, m13;      // Second row
+    float m2, m6, m10, m14;     // Third row
+} Affine3;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Transform2D
+//----------------------------------------------------------------------------------
+
+// Get identity transform
+RMAPI constexpr Transform2D Transform2DIdentity(void)
+{
+    Transform2D result = { 1.0f, 0.0f, 0.0f,
+                           0.0f, 1.0f, 0.0f };
+
+    return result;
+}
+
+// Get translation transform
+RMAPI constexpr Transform2D Transform2DTranslate(float x, float y)
+{
+    Transform2D result = { 1.0f, 0.0f, x,
+                           0.0f, 1.0f, y };
+
+    return result;
+}
+
+// Get rotation transform, same direction as RotateZ()
+// NOTE: Angle must be provided in radians
+RMAPI Transform2D Transform2DRotate(float angle)
+{
+    float sinres, cosres;
+    TrigSinCos(angle, &sinres, &cosres);
+
+    Transform2D result = { cosres, -sinres, 0.0f,
+                           sinres, cosres, 0.0f };
+
+    return result;
+}
+
+// Get scaling transform
+RMAPI constexpr Transform2D Transform2DScale(float x, float y)
+{
+    Transform2D result = { x, 0.0f, 0.0f,
+                           0.0f, y, 0.0f };
+
+    return result;
+}
+
+// Get transform that scales, then rotates, then translates
+RMAPI Transform2D Transform2DFromTRS(Vector2 translation, float rotation, Vector2 scale)
+{
+    float sinres, cosres;
+    TrigSinCos(rotation, &sinres, &cosres);
+
+    Transform2D result = { cosres * scale.x, -sinres * scale.y, translation.x,
+                           sinres * scale.x, cosres * scale.y, translation.y };
+
+    return result;
+}
+
+// Get transform from a Matrix, ignores z and the projective row
+RMAPI constexpr Transform2D ToTransform2D(Matrix mat)
+{
+    Transform2D result = { mat.m0, mat.m4, mat.m12,
+                           mat.m1, mat.m5, mat.m13 };
+
+    return result;
+}
+
+// Get Matrix from a transform
+RMAPI constexpr Matrix ToMatrix(Transform2D t)
+{
+    Matrix result = { t.m0, t.m4, 0.0f, t.m12,
+                      t.m1, t.m5, 0.0f, t.m13,
+                      0.0f, 0.0f, 1.0f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+
+    return result;
+}
+
+// Compose two transforms, the result applies left first, then right
+RMAPI constexpr Transform2D Multiply(Transform2D left, Transform2D right)
+{
+    Transform2D result = { 0 };
+
+    result.m0 = right.m0 * left.m0 + right.m4 * left.m1;
+    result.m4 = right.m0 * left.m4 + right.m4 * left.m5;
+    result.m12 = right.m0 * left.m12 + right.m4 * left.m13 + right.m12;
+    result.m1 = right.m1 * left.m0 + right.m5 * left.m1;
+    result.m5 = right.m1 * left.m4 + right.m5 * left.m5;
+    result.m13 = right.m1 * left.m12 + right.m5 * left.m13 + right.m13;
+
+    return result;
+}
+
+// Invert provided transform
+// NOTE: Singular transforms (zero scale) produce non-finite values, like Invert(Matrix)
+RMAPI constexpr Transform2D Invert(Transform2D t)
+{
+    Transform2D result = { 0 };
+
+    float invDet = 1.0f / (t.m0 * t.m5 - t.m4 * t.m1);
+
+    result.m0 = t.m5 * invDet;
+    result.m4 = -t.m4 * invDet;
+    result.m1 = -t.m1 * invDet;
+    result.m5 = t.m0 * invDet;
+    result.m12 = -(result.m0 * t.m12 + result.m4 * t.m13);
+    result.m13 = -(result.m1 * t.m12 + result.m5 * t.m13);
+
+    return result;
+}
+
+// Transform a point (applies translation)
+RMAPI constexpr Vector2 Multiply(Vector2 v, Transform2D t)
+{
+    Vector2 result = { t.m0 * v.x + t.m4 * v.y + t.m12,
+                       t.m1 * v.x + t.m5 * v.y + t.m13 };
+
+    return result;
+}
+
+// Transform a direction (ignores translation)
+RMAPI constexpr Vector2 TransformDirection(Vector2 v, Transform2D t)
+{
+    Vector2 result = { t.m0 * v.x + t.m4 * v.y,
+                       t.m1 * v.x + t.m5 * v.y };
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Affine3
+//----------------------------------------------------------------------------------
+
+// Get identity transform
+RMAPI constexpr Affine3 Affine3Identity(void)
+{
+    Affine3 result = { 1.0f, 0.0f, 0.0f, 0.0f,
+                       0.0f, 1.0f, 0.0f, 0.0f,
+                       0.0f, 0.0f, 1.0f, 0.0f };
+
+    return result;
+}
+
+// Get transform that scales, then rotates, then translates
+RMAPI constexpr Affine3 Affine3FromTRS(Vector3 translation, Quaternion rotation, Vector3 scale)
+{
+    Affine3 result = { 0 };
+
+    // Rotation part of ToMatrix(Quaternion), columns scaled
+    float a2 = rotation.x * rotation.x;
+    float b2 = rotation.y * rotation.y;
+    float c2 = rotation.z * rotation.z;
+    float ac = rotation.x * rotation.z;
+    float ab = rotation.x * rotation.y;
+    float bc = rotation.y * rotation.z;
+    float ad = rotation.w * rotation.x;
+    float bd = rotation.w * rotation.y;
+    float cd = rotation.w * rotation.z;
+
+    result.m0 = (1 - 2 * (b2 + c2)) * scale.x;
+    result.m1 = (2 * (ab + cd)) * scale.x;
+    result.m2 = (2 * (ac - bd)) * scale.x;
+
+    result.m4 = (2 * (ab - cd)) * scale.y;
+    result.m5 = (1 - 2 * (a2 + c2)) * scale.y;
+    result.m6 = (2 * (bc + ad)) * scale.y;
+
+    result.m8 = (2 * (ac + bd)) * scale.z;
+    result.m9 = (2 * (bc - ad)) * scale.z;
+    result.m10 = (1 - 2 * (a2 + b2)) * scale.z;
+
+    result.m12 = translation.x;
+    result.m13 = translation.y;
+    result.m14 = translation.z;
+
+    return result;
+}
+
+// Get transform from a Matrix, drops the projective row
+// NOTE: Only exact for affine matrices (fourth row 0, 0, 0, 1), not for projections
+RMAPI constexpr Affine3 ToAffine3(Matrix mat)
+{
+    Affine3 result = { mat.m0, mat.m4, mat.m8, mat.m12,
+                       mat.m1, mat.m5, mat.m9, mat.m13,
+                       mat.m2, mat.m6, mat.m10, mat.m14 };
+
+    return result;
+}
+
+// Get Matrix from a transform
+RMAPI constexpr Matrix ToMatrix(Affine3 a)
+{
+    Matrix result = { a.m0, a.m4, a.m8, a.m12,
+                      a.m1, a.m5, a.m9, a.m13,
+                      a.m2, a.m6, a.m10, a.m14,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+
+    return result;
+}
+
+// Compose two transforms, the result applies left first, then right
+RMAPI_SIMD Affine3 Multiply(Affine3 left, Affine3 right)
+{
+    Affine3 result = { 0 };
+
+#if MATH_SIMD_SSE
+    if (!MATH_IS_CONSTANT_EVALUATED())
+    {
+        // Same row broadcast as Multiply(Matrix, Matrix), the implicit fourth row of left only passes the translation through
+        const float* l = &left.m0;
+        const float* r = &right.m0;
+        __m128 l0 = _mm_loadu_ps(l);
+        __m128 l1 = _mm_loadu_ps(l + 4);
+        __m128 l2 = _mm_loadu_ps(l + 8);
+        __m128 translation = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+        float* out = &result.m0;
+        for (int i = 0; i < 12; i += 4)
+        {
+            __m128 w = _mm_loadu_ps(r + i);
+            __m128 row = _mm_mul_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 0, 0, 0)), l0);
+            row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 1, 1, 1)), l1));
+            row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 2, 2)), l2));
+            row = _mm_add_ps(row, _mm_and_ps(w, translation));
+            _mm_storeu_ps(out + i, row);
+        }
+
+        return result;
+    }
+#endif
+
+    result.m0 = right.m0 * left.m0 + right.m4 * left.m1 + right.m8 * left.m2;
+    result.m4 = right.m0 * left.m4 + right.m4 * left.m5 + right.m8 * left.m6;
+    result.m8 = right.m0 * left.m8 + right.m4 * left.m9 + right.m8 * left.m10;
+    result.m12 = right.m0 * left.m12 + right.m4 * left.m13 + right.m8 * left.m14 + right.m12;
+
+    result.m1 = right.m1 * left.m0 + right.m5 * left.m1 + right.m9 * left.m2;
+    result.m5 = right.m1 * left.m4 + right.m5 * left.m5 + right.m9 * left.m6;
+    result.m9 = right.m1 * left.m8 + right.m5 * left.m9 + right.m9 * left.m10;
+    result.m13 = right.m1 * left.m12 + right.m5 * left.m13 + right.m9 * left.m14 + right.m13;
+
+    result.m2 = right.m2 * left.m0 + right.m6 * left.m1 + right.m10 * left.m2;
+    result.m6 = right.m2 * left.m4 + right.m6 * left.m5 + right.m10 * left.m6;
+    result.m10 = right.m2 * left.m8 + right.m6 * left.m9 + right.m10 * left.m10;
+    result.m14 = right.m2 * left.m12 + right.m6 * left.m13 + right.m10 * left.m14 + right.m14;
+
+    return result;
+}
+
+// Invert provided transform, 3x3 inverse by cofactors and the translation taken back through it
+// NOTE: Singular transforms (zero scale) produce non-finite values, like Invert(Matrix)
+RMAPI constexpr Affine3 Invert(Affine3 a)
+{
+    Affine3 result = { 0 };
+
+    float a00 = a.m0, a01 = a.m4, a02 = a.m8;
+    float a10 = a.m1, a11 = a.m5, a12 = a.m9;
+    float a20 = a.m2, a21 = a.m6, a22 = a.m10;
+
+    float c00 = a11 * a22 - a12 * a21;
+    float c10 = a12 * a20 - a10 * a22;
+    float c20 = a10 * a21 - a11 * a20;
+
+    float invDet = 1.0f / (a00 * c00 + a01 * c10 + a02 * c20);
+
+    result.m0 = c00 * invDet;
+    result.m4 = (a02 * a21 - a01 * a22) * invDet;
+    result.m8 = (a01 * a12 - a02 * a11) * invDet;
+    result.m1 = c10 * invDet;
+    result.m5 = (a00 * a22 - a02 * a20) * invDet;
+    result.m9 = (a02 * a10 - a00 * a12) * invDet;
+    result.m2 = c20 * invDet;
+    result.m6 = (a01 * a20 - a00 * a21) * invDet;
+    result.m10 = (a00 * a11 - a01 * a10) * invDet;
+
+    result.m12 = -(result.m0 * a.m12 + result.m4 * a.m13 + result.m8 * a.m14);
+    result.m13 = -(result.m1 * a.m12 + result.m5 * a.m13 + result.m9 * a.m14);
+    result.m14 = -(result.m2 * a.m12 + result.m6 * a.m13 + result.m10 * a.m14);
+
+    return result;
+}
+
+// Transform a point (applies translation)
+RMAPI constexpr Vector3 Multiply(Vector3 v, Affine3 a)
+{
+    Vector3 result = { a.m0 * v.x + a.m4 * v.y + a.m8 * v.z + a.m12,
+                       a.m1 * v.x + a.m5 * v.y + a.m9 * v.z + a.m13,
+                       a.m2 * v.x + a.m6 * v.y + a.m10 * v.z + a.m14 };
+
+    return result;
+}
+
+// Transform a direction (ignores translation)
+RMAPI constexpr Vector3 TransformDirection(Vector3 v, Affine3 a)
+{
+    Vector3 result = { a.m0 * v.x + a.m4 * v.y + a.m8 * v.z,
+                       a.m1 * v.x + a.m5 * v.y + a.m9 * v.z,
+                       a.m2 * v.x + a.m6 * v.y + a.m10 * v.z };
+
+    return result;
+}
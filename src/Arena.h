@@ -0,0 +1,359 @@
+#pragma once
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Arena and pool allocators
+//
+// Arena: bump allocator over a chain of blocks, everything is freed at once by ResetArena().
+// Reset keeps the blocks, so once a frame has reached its high water mark, later frames
+// allocate nothing from the heap
+//
+// FrameArena: the per-frame scratch memory (collision pairs, visible lists, HUD strings).
+// EndFrameArena() goes right after EndDrawing():
+//   - FrameAlloc()          valid until the end of the current frame
+//   - FrameAllocBuffered()  valid until the end of the next frame (double-buffered), for data
+//                           a frame hands to the next one
+//
+// Pool: fixed number of fixed size objects with a free list, O(1) allocation and free
+//
+// ArenaAllocator<T>: STL allocator over an Arena, deallocate() does nothing:
+//   ArenaVector<Vector2> pairs(ArenaAllocator<Vector2>(&frame.frame));
+//
+// Usage:
+//   FrameArena frame = CreateFrameArena(0);
+//   while (!WindowShouldClose())
+//   {
+//       int* visible = FrameAllocArray<int>(&frame, count);
+//       DrawText(FrameFormat(&frame, "score %d", score), 10, 10, 20, GRAY);
+//       EndDrawing();
+//       EndFrameArena(&frame);
+//   }
+//
+// NOTE: Arena memory is never constructed or destroyed, use it for trivially destructible data
+// NOTE: A vector in an arena leaves its old buffers behind when it grows, reserve() when the
+// size is known
+//----------------------------------------------------------------------------------
+
+#ifndef ARENAAPI
+#define ARENAAPI inline
+#endif
+
+// Default bytes per arena block, larger requests get a block of their own size
+#ifndef ARENA_BLOCK_SIZE
+#define ARENA_BLOCK_SIZE (256*1024)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct alignas(16) ArenaBlock {
+    ArenaBlock* next;
+    size_t capacity;                // Bytes of data following the header
+};
+
+struct Arena {
+    ArenaBlock* first;
+    ArenaBlock* current;            // Block being filled, the ones after it are free
+    size_t offset;                  // Bytes used in the current block
+    size_t used;                    // Bytes handed out since the last reset
+    size_t peak;                    // Highest 'used' so far
+    size_t blockSize;
+};
+
+struct FrameArena {
+    Arena frame;                    // Reset by every EndFrameArena()
+    Arena buffered[2];              // Reset every second EndFrameArena(), alternating
+    int current;                    // Buffered arena of the current frame
+    long long frameCount;           // EndFrameArena() calls so far
+};
+
+struct Pool {
+    unsigned char* memory;
+    size_t stride;                  // Object size rounded up to the alignment
+    size_t alignment;
+    int capacity;
+    int count;                      // Objects allocated
+    void* freeList;                 // Free objects, each starts with a pointer to the next one
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Arena
+//----------------------------------------------------------------------------------
+
+ARENAAPI Arena CreateArena(size_t blockSize)
+{
+    Arena arena = { 0 };
+    arena.blockSize = (blockSize > 0) ? blockSize : ARENA_BLOCK_SIZE;
+
+    return arena;
+}
+
+ARENAAPI void DestroyArena(Arena* arena)
+{
+    ArenaBlock* block = arena->first;
+    while (block)
+    {
+        ArenaBlock* next = block->next;
+        ::operator delete(block);
+        block = next;
+    }
+    *arena = CreateArena(arena->blockSize);
+}
+
+// Free everything allocated from the arena, the blocks are kept for the next allocations
+ARENAAPI void ResetArena(Arena* arena)
+{
+    arena->current = arena->first;
+    arena->offset = 0;
+    arena->used = 0;
+}
+
+// Allocate 'size' bytes aligned to 'alignment' (a power of two), never null
+ARENAAPI void* ArenaAlloc(Arena* arena, size_t size, size_t alignment = 16)
+{
+    for (;;)
+    {
+        ArenaBlock* block = arena->current;
+        if (block)
+        {
+            unsigned char* data = (unsigned char*)(block + 1);
+            uintptr_t address = ((uintptr_t)(data + arena->offset) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+            size_t start = address - (uintptr_t)data;
+            if (start + size <= block->capacity)
+            {
+                arena->offset = start + size;
+                arena->used += size;
+                if (arena->used > arena->peak) arena->peak = arena->used;
+
+                return data + start;
+            }
+
+            // Blocks kept by a reset are reused in order
+            if (block->next)
+            {
+                arena->current = block->next;
+                arena->offset = 0;
+                continue;
+            }
+        }
+
+        // Out of blocks: append one
+        size_t blockSize = (arena->blockSize > 0) ? arena->blockSize : ARENA_BLOCK_SIZE;
+        size_t capacity = (size + alignment > blockSize) ? size + alignment : blockSize;
+        ArenaBlock* fresh = (ArenaBlock*)::operator new(sizeof(ArenaBlock) + capacity);
+        fresh->next = nullptr;
+        fresh->capacity = capacity;
+        if (block) block->next = fresh;
+        else arena->first = fresh;
+        arena->current = fresh;
+        arena->offset = 0;
+    }
+}
+
+template <typename T>
+ARENAAPI T* ArenaAllocArray(Arena* arena, int count)
+{
+    return (T*)ArenaAlloc(arena, sizeof(T)*count, alignof(T));
+}
+
+// printf() into the arena, the result lives as long as the arena's other allocations
+ARENAAPI const char* ArenaFormatV(Arena* arena, const char* format, va_list args)
+{
+    // Format straight into the rest of the current block, measure first only when it does not fit
+    va_list copy;
+    va_copy(copy, args);
+    int length = -1;
+    if (arena->current)
+    {
+        char* tail = (char*)(arena->current + 1) + arena->offset;
+        size_t available = arena->current->capacity - arena->offset;
+        length = vsnprintf(tail, available, format, copy);
+        if ((length >= 0) && ((size_t)length < available))
+        {
+            va_end(copy);
+            return (const char*)ArenaAlloc(arena, length + 1, 1);
+        }
+    }
+    else length = vsnprintf(nullptr, 0, format, copy);
+    va_end(copy);
+    if (length < 0) length = 0;
+
+    char* text = (char*)ArenaAlloc(arena, length + 1, 1);
+    vsnprintf(text, length + 1, format, args);
+
+    return text;
+}
+
+ARENAAPI const char* ArenaFormat(Arena* arena, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const char* text = ArenaFormatV(arena, format, args);
+    va_end(args);
+
+    return text;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Frame arena
+//----------------------------------------------------------------------------------
+
+ARENAAPI FrameArena CreateFrameArena(size_t blockSize)
+{
+    FrameArena arena = {};
+    arena.frame = CreateArena(blockSize);
+    arena.buffered[0] = CreateArena(blockSize);
+    arena.buffered[1] = CreateArena(blockSize);
+
+    return arena;
+}
+
+ARENAAPI void DestroyFrameArena(FrameArena* arena)
+{
+    DestroyArena(&arena->frame);
+    DestroyArena(&arena->buffered[0]);
+    DestroyArena(&arena->buffered[1]);
+}
+
+// Valid until the end of the current frame
+ARENAAPI void* FrameAlloc(FrameArena* arena, size_t size, size_t alignment = 16)
+{
+    return ArenaAlloc(&arena->frame, size, alignment);
+}
+
+// Valid until the end of the next frame
+ARENAAPI void* FrameAllocBuffered(FrameArena* arena, size_t size, size_t alignment = 16)
+{
+    return ArenaAlloc(&arena->buffered[arena->current], size, alignment);
+}
+
+template <typename T>
+ARENAAPI T* FrameAllocArray(FrameArena* arena, int count)
+{
+    return ArenaAllocArray<T>(&arena->frame, count);
+}
+
+// TextFormat() with a result valid until the end of the frame, without TextFormat()'s limit
+// on the number of strings per frame
+ARENAAPI const char* FrameFormat(FrameArena* arena, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const char* text = ArenaFormatV(&arena->frame, format, args);
+    va_end(args);
+
+    return text;
+}
+
+// End the frame, call after EndDrawing(): frees the frame memory and the buffered memory of
+// the frame before
+ARENAAPI void EndFrameArena(FrameArena* arena)
+{
+    ResetArena(&arena->frame);
+    arena->current ^= 1;
+    ResetArena(&arena->buffered[arena->current]);
+    arena->frameCount++;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Pool
+//----------------------------------------------------------------------------------
+
+// Pool of 'capacity' objects of 'size' bytes, allocated once here
+ARENAAPI Pool CreatePool(size_t size, int capacity, size_t alignment = 16)
+{
+    if (alignment < alignof(void*)) alignment = alignof(void*);
+
+    Pool pool = { 0 };
+    pool.stride = (((size > sizeof(void*)) ? size : sizeof(void*)) + alignment - 1) & ~(alignment - 1);
+    pool.alignment = alignment;
+    pool.capacity = capacity;
+    pool.memory = (unsigned char*)::operator new(pool.stride*capacity, std::align_val_t(alignment));
+
+    // Free list in address order
+    for (int i = capacity - 1; i >= 0; i--)
+    {
+        void* object = pool.memory + pool.stride*i;
+        *(void**)object = pool.freeList;
+        pool.freeList = object;
+    }
+
+    return pool;
+}
+
+ARENAAPI void DestroyPool(Pool* pool)
+{
+    ::operator delete(pool->memory, std::align_val_t(pool->alignment));
+    *pool = Pool{};
+}
+
+// Allocate one object, null when the pool is full
+ARENAAPI void* PoolAlloc(Pool* pool)
+{
+    void* object = pool->freeList;
+    if (!object) return nullptr;
+
+    pool->freeList = *(void**)object;
+    pool->count++;
+
+    return object;
+}
+
+ARENAAPI void PoolFree(Pool* pool, void* object)
+{
+    if (!object) return;
+
+    *(void**)object = pool->freeList;
+    pool->freeList = object;
+    pool->count--;
+}
+
+// Construct a T in the pool, null when the pool is full
+template <typename T, typename... Args>
+ARENAAPI T* PoolNew(Pool* pool, Args&&... args)
+{
+    void* memory = PoolAlloc(pool);
+
+    return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+}
+
+template <typename T>
+ARENAAPI void PoolDelete(Pool* pool, T* object)
+{
+    if (!object) return;
+
+    object->~T();
+    PoolFree(pool, object);
+}
+
+//----------------------------------------------------------------------------------
+// STL allocator
+//----------------------------------------------------------------------------------
+
+template <typename T>
+struct ArenaAllocator {
+    typedef T value_type;
+
+    Arena* arena;
+
+    ArenaAllocator(Arena* arena) : arena(arena) {}
+    template <typename U> ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t count) { return (T*)ArenaAlloc(arena, sizeof(T)*count, alignof(T)); }
+    void deallocate(T*, size_t) {}
+};
+
+template <typename T, typename U>
+ARENAAPI bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.arena == b.arena; }
+
+template <typename T, typename U>
+ARENAAPI bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.arena != b.arena; }
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
@@ -0,0 +1,111 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include <cstring>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Recorded draw calls
+//
+// Game code draws into a DrawList instead of calling raylib, so the same code runs with a
+// window (ReplayDrawList() inside BeginDrawing/EndDrawing) and headless, where the list
+// only counts the calls (DRAW_LIST_DISCARD) or keeps them for inspection (DRAW_LIST_RECORD)
+//
+// Usage:
+//   DrawListCircle(&list, position, radius, MAROON);
+//   ...
+//   BeginDrawing();
+//   ReplayDrawList(list);
+//   EndDrawing();
+//   ClearDrawList(&list);
+//
+// NOTE: Only raylib.h types are used here, ReplayDrawList() is left out when GAME_HEADLESS is
+// defined so that headless builds do not link raylib
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum DrawListMode {
+    DRAW_LIST_RECORD = 0,       // Keep the commands (window replay, inspection)
+    DRAW_LIST_DISCARD           // Only count the calls
+} DrawListMode;
+
+typedef enum DrawCommandType {
+    DRAW_COMMAND_CIRCLE = 0,    // DrawCircleV(position, size, color)
+    DRAW_COMMAND_RECTANGLE,     // DrawRectangleV(position, Vector2{ size, height }, color)
+    DRAW_COMMAND_TEXT           // DrawText(text, position.x, position.y, size, color)
+} DrawCommandType;
+
+typedef struct DrawCommand {
+    DrawCommandType type;
+    Vector2 position;
+    float size;                 // Circle radius, rectangle width or font size
+    float height;               // Rectangle height
+    Color color;
+    int text;                   // Offset of the text in DrawList::text, -1 for shapes
+} DrawCommand;
+
+typedef struct DrawList {
+    DrawListMode mode;
+    std::vector<DrawCommand> commands;
+    std::vector<char> text;     // Zero terminated strings of the text commands
+    long long callCount;        // Calls since the last ClearDrawList(), recorded or not
+} DrawList;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+RMAPI void ClearDrawList(DrawList* list)
+{
+    list->commands.clear();
+    list->text.clear();
+    list->callCount = 0;
+}
+
+RMAPI void DrawListCircle(DrawList* list, Vector2 center, float radius, Color color)
+{
+    list->callCount++;
+    if (list->mode == DRAW_LIST_DISCARD) return;
+
+    list->commands.push_back(DrawCommand{ DRAW_COMMAND_CIRCLE, center, radius, 0.0f, color, -1 });
+}
+
+RMAPI void DrawListRectangle(DrawList* list, Vector2 position, Vector2 size, Color color)
+{
+    list->callCount++;
+    if (list->mode == DRAW_LIST_DISCARD) return;
+
+    list->commands.push_back(DrawCommand{ DRAW_COMMAND_RECTANGLE, position, size.x, size.y, color, -1 });
+}
+
+RMAPI void DrawListText(DrawList* list, const char* text, int posX, int posY, int fontSize, Color color)
+{
+    list->callCount++;
+    if (list->mode == DRAW_LIST_DISCARD) return;
+
+    // Grow geometrically (insert() reallocates to the exact size), so that a HUD string gaining
+    // a digit does not reallocate every time
+    int offset = (int)list->text.size();
+    size_t length = strlen(text) + 1;
+    if (offset + length > list->text.capacity()) list->text.reserve(2*(offset + length) + 256);
+    list->text.insert(list->text.end(), text, text + length);
+    list->commands.push_back(DrawCommand{ DRAW_COMMAND_TEXT, Vector2{ (float)posX, (float)posY }, (float)fontSize, 0.0f, color, offset });
+}
+
+#if !defined(GAME_HEADLESS)
+// Issue the recorded commands to raylib, call between BeginDrawing() and EndDrawing()
+RMAPI void ReplayDrawList(const DrawList& list)
+{
+    for (const DrawCommand& command : list.commands)
+    {
+        switch (command.type)
+        {
+        case DRAW_COMMAND_CIRCLE: DrawCircleV(command.position, command.size, command.color); break;
+        case DRAW_COMMAND_RECTANGLE: DrawRectangleV(command.position, Vector2{ command.size, command.height }, command.color); break;
+        case DRAW_COMMAND_TEXT: DrawText(&list.text[command.text], (int)command.position.x, (int)command.position.y, (int)command.size, command.color); break;
+        }
+    }
+}
+#endif
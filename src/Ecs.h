@@ -0,0 +1,520 @@
+#pragma once
+#include "JobSystem.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Archetype entity-component system
+//
+// Entities with the same set of components share an archetype. An archetype stores its
+// entities in fixed size chunks (ECS_CHUNK_SIZE bytes), each chunk holds one contiguous
+// array per component (SoA): a system that reads Position and Velocity streams through
+// two dense arrays and never touches the other components
+//
+// Adding or removing a component moves the entity to the archetype with the new component
+// set: its components are copied to the end of the other archetype and the last entity of
+// the old one fills the hole, so chunks stay packed. The archetype graph caches these moves,
+// after the first one they cost a table lookup and a few memcpy
+//
+// Usage:
+//   struct Position { Vector2 value; };
+//   struct Velocity { Vector2 value; };
+//
+//   EcsWorld* world = CreateEcsWorld();
+//   Entity e = CreateEntity(world, Position{ { 0, 0 } }, Velocity{ { 10, 0 } });
+//   AddComponent(world, e, Health{ 100.0f });
+//
+//   QueryChunks<Position, Velocity>(world, [&](const Entity* entities, int count, Position* p, Velocity* v) {
+//       for (int i = 0; i < count; i++) p[i].value = p[i].value + v[i].value*dt;
+//   });
+//   ParallelQueryEach<Position, Velocity>(world, jobs, [=](Position& p, Velocity& v) { ... });
+//
+// NOTE: Components are plain data (trivially copyable), they are moved with memcpy
+// NOTE: At most ECS_MAX_COMPONENTS component types per program, and an archetype row must fit in
+// a chunk: registering one type more or creating an archetype with a bigger row aborts
+// NOTE: Do not create, destroy, add or remove components while a query runs, collect the
+// entities and apply the changes after the query
+//----------------------------------------------------------------------------------
+
+#ifndef ECSAPI
+#define ECSAPI inline
+#endif
+
+// Bytes of component data per chunk
+#ifndef ECS_CHUNK_SIZE
+#define ECS_CHUNK_SIZE 16384
+#endif
+
+#define ECS_MAX_COMPONENTS 64
+
+// Chunks per job piece of the parallel queries
+#ifndef ECS_PARALLEL_CHUNKS
+#define ECS_PARALLEL_CHUNKS 4
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Entity handle, the generation tells a destroyed entity from the one reusing its index
+struct Entity {
+    uint32_t index;
+    uint32_t generation;            // Never 0 for a created entity
+};
+
+struct EcsComponentInfo {
+    int size;
+    int alignment;
+};
+
+struct alignas(64) EcsChunk {
+    int count;                      // Entities in the chunk
+    alignas(64) unsigned char data[ECS_CHUNK_SIZE];     // Entity array, then one array per component
+};
+
+struct EcsColumn {
+    int component;                  // Component id
+    int offset;                     // Start of the array in EcsChunk::data
+    int size;                       // Bytes per element
+};
+
+struct EcsArchetype {
+    uint64_t mask;                  // Bit i: has component i
+    int capacity;                   // Entities per chunk
+    int entityCount;
+    int columnCount;
+    EcsColumn columns[ECS_MAX_COMPONENTS];
+    int offsets[ECS_MAX_COMPONENTS];    // Column offset by component id, -1 when absent
+    std::vector<EcsChunk*> chunks;      // Every chunk is full except the last one
+    EcsArchetype* addEdge[ECS_MAX_COMPONENTS];      // Archetype with component i added (cached)
+    EcsArchetype* removeEdge[ECS_MAX_COMPONENTS];   // Archetype with component i removed (cached)
+};
+
+// Where an entity lives
+struct EcsRecord {
+    EcsArchetype* archetype;        // Null for a destroyed entity
+    int chunk;
+    int row;
+    uint32_t generation;
+};
+
+struct EcsWorld {
+    std::vector<EcsRecord> records;         // By entity index
+    std::vector<uint32_t> freeIndices;
+    std::vector<EcsArchetype*> archetypes;
+    std::unordered_map<uint64_t, EcsArchetype*> archetypeByMask;
+    std::vector<EcsChunk*> spareChunks;     // Emptied chunks, reused before allocating
+    std::vector<EcsChunk*> queryChunks;     // Scratch list of the parallel queries
+    std::vector<EcsArchetype*> queryArchetypes;
+    EcsArchetype* empty;                    // Archetype without components
+    int entityCount;
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Components
+//----------------------------------------------------------------------------------
+
+ECSAPI EcsComponentInfo* GetEcsComponentTable(void)
+{
+    static EcsComponentInfo table[ECS_MAX_COMPONENTS];
+
+    return table;
+}
+
+// Assign the next component id, ids are shared by every world of the program
+ECSAPI int RegisterEcsComponent(int size, int alignment)
+{
+    static std::atomic<int> count(0);
+    int id = count.fetch_add(1);
+    if (id >= ECS_MAX_COMPONENTS)
+    {
+        fprintf(stderr, "ECS: more than %d component types\n", ECS_MAX_COMPONENTS);
+        abort();
+    }
+    GetEcsComponentTable()[id] = EcsComponentInfo{ size, alignment };
+
+    return id;
+}
+
+// Component id of T, registered on first use
+template <typename T>
+ECSAPI int EcsComponentId(void)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Components must be trivially copyable");
+    static_assert(sizeof(Entity) + sizeof(T) + 2*64 <= ECS_CHUNK_SIZE, "Component does not fit in a chunk, raise ECS_CHUNK_SIZE");
+    static const int id = RegisterEcsComponent((int)sizeof(T), (int)alignof(T));
+
+    return id;
+}
+
+template <typename... Ts>
+ECSAPI uint64_t EcsMask(void)
+{
+    return (0ull | ... | (1ull << EcsComponentId<Ts>()));
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Archetypes
+//----------------------------------------------------------------------------------
+
+// Archetype with exactly the components in 'mask', created on first use
+ECSAPI EcsArchetype* GetEcsArchetype(EcsWorld* world, uint64_t mask)
+{
+    auto found = world->archetypeByMask.find(mask);
+    if (found != world->archetypeByMask.end()) return found->second;
+
+    EcsArchetype* archetype = new EcsArchetype();
+    archetype->mask = mask;
+
+    // Row size decides the capacity, every array starts on a cache line
+    int rowSize = (int)sizeof(Entity);
+    for (int id = 0; id < ECS_MAX_COMPONENTS; id++)
+    {
+        archetype->offsets[id] = -1;
+        archetype->addEdge[id] = nullptr;
+        archetype->removeEdge[id] = nullptr;
+        if (mask & (1ull << id))
+        {
+            archetype->columns[archetype->columnCount++] = EcsColumn{ id, 0, GetEcsComponentTable()[id].size };
+            rowSize += GetEcsComponentTable()[id].size;
+        }
+    }
+    archetype->capacity = (ECS_CHUNK_SIZE - 64*(archetype->columnCount + 1))/rowSize;
+    if (archetype->capacity < 1)
+    {
+        fprintf(stderr, "ECS: archetype rows of %d bytes (%d components) do not fit in a chunk of %d bytes, raise ECS_CHUNK_SIZE\n",
+            rowSize, archetype->columnCount, ECS_CHUNK_SIZE);
+        abort();
+    }
+
+    int offset = archetype->capacity*(int)sizeof(Entity);
+    for (int i = 0; i < archetype->columnCount; i++)
+    {
+        EcsColumn& column = archetype->columns[i];
+        column.offset = (offset + 63) & ~63;
+        archetype->offsets[column.component] = column.offset;
+        offset = column.offset + archetype->capacity*column.size;
+    }
+
+    world->archetypes.push_back(archetype);
+    world->archetypeByMask[mask] = archetype;
+
+    return archetype;
+}
+
+// Append a row for 'entity' at the end of an archetype, its components are not initialized
+ECSAPI void AllocateEcsRow(EcsWorld* world, EcsArchetype* archetype, Entity entity, int* chunk, int* row)
+{
+    *chunk = archetype->entityCount/archetype->capacity;
+    *row = archetype->entityCount%archetype->capacity;
+
+    if (*chunk == (int)archetype->chunks.size())
+    {
+        EcsChunk* fresh = nullptr;
+        if (!world->spareChunks.empty())
+        {
+            fresh = world->spareChunks.back();
+            world->spareChunks.pop_back();
+        }
+        else fresh = new EcsChunk();
+        fresh->count = 0;
+        archetype->chunks.push_back(fresh);
+    }
+
+    EcsChunk* target = archetype->chunks[*chunk];
+    ((Entity*)target->data)[*row] = entity;
+    target->count = *row + 1;
+    archetype->entityCount++;
+}
+
+// Remove a row, the last entity of the archetype moves into the hole
+ECSAPI void FreeEcsRow(EcsWorld* world, EcsArchetype* archetype, int chunk, int row)
+{
+    int last = archetype->entityCount - 1;
+    int lastChunk = last/archetype->capacity;
+    int lastRow = last%archetype->capacity;
+    EcsChunk* hole = archetype->chunks[chunk];
+    EcsChunk* tail = archetype->chunks[lastChunk];
+
+    if ((chunk != lastChunk) || (row != lastRow))
+    {
+        Entity moved = ((Entity*)tail->data)[lastRow];
+        ((Entity*)hole->data)[row] = moved;
+        for (int i = 0; i < archetype->columnCount; i++)
+        {
+            const EcsColumn& column = archetype->columns[i];
+            memcpy(hole->data + column.offset + row*column.size, tail->data + column.offset + lastRow*column.size, column.size);
+        }
+        world->records[moved.index].chunk = chunk;
+        world->records[moved.index].row = row;
+    }
+
+    tail->count = lastRow;
+    archetype->entityCount--;
+    if (lastRow == 0)
+    {
+        world->spareChunks.push_back(tail);
+        archetype->chunks.pop_back();
+    }
+}
+
+// Move an entity to another archetype, keeping the components both have
+ECSAPI void MoveEcsEntity(EcsWorld* world, Entity entity, EcsArchetype* target)
+{
+    EcsRecord& record = world->records[entity.index];
+    EcsArchetype* source = record.archetype;
+
+    int chunk, row;
+    AllocateEcsRow(world, target, entity, &chunk, &row);
+
+    const unsigned char* from = source->chunks[record.chunk]->data;
+    unsigned char* to = target->chunks[chunk]->data;
+    for (int i = 0; i < target->columnCount; i++)
+    {
+        const EcsColumn& column = target->columns[i];
+        int offset = source->offsets[column.component];
+        if (offset >= 0) memcpy(to + column.offset + row*column.size, from + offset + record.row*column.size, column.size);
+    }
+
+    FreeEcsRow(world, source, record.chunk, record.row);
+    record.archetype = target;
+    record.chunk = chunk;
+    record.row = row;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - World and entities
+//----------------------------------------------------------------------------------
+
+ECSAPI EcsWorld* CreateEcsWorld(void)
+{
+    EcsWorld* world = new EcsWorld();
+    world->entityCount = 0;
+    world->empty = GetEcsArchetype(world, 0);
+
+    return world;
+}
+
+ECSAPI void DestroyEcsWorld(EcsWorld* world)
+{
+    for (EcsArchetype* archetype : world->archetypes)
+    {
+        for (EcsChunk* chunk : archetype->chunks) delete chunk;
+        delete archetype;
+    }
+    for (EcsChunk* chunk : world->spareChunks) delete chunk;
+
+    delete world;
+}
+
+ECSAPI int GetEntityCount(const EcsWorld* world)
+{
+    return world->entityCount;
+}
+
+ECSAPI bool IsEntityAlive(const EcsWorld* world, Entity entity)
+{
+    return (entity.index < world->records.size()) && (world->records[entity.index].generation == entity.generation) &&
+        (world->records[entity.index].archetype != nullptr);
+}
+
+// Create an entity with the components in 'mask', left uninitialized
+ECSAPI Entity CreateEcsEntity(EcsWorld* world, uint64_t mask)
+{
+    Entity entity;
+    if (!world->freeIndices.empty())
+    {
+        entity.index = world->freeIndices.back();
+        world->freeIndices.pop_back();
+    }
+    else
+    {
+        entity.index = (uint32_t)world->records.size();
+        world->records.push_back(EcsRecord{ nullptr, 0, 0, 1 });
+    }
+
+    EcsRecord& record = world->records[entity.index];
+    entity.generation = record.generation;
+    record.archetype = GetEcsArchetype(world, mask);
+    AllocateEcsRow(world, record.archetype, entity, &record.chunk, &record.row);
+    world->entityCount++;
+
+    return entity;
+}
+
+// Create an entity without components
+ECSAPI Entity CreateEntity(EcsWorld* world)
+{
+    return CreateEcsEntity(world, 0);
+}
+
+// Destroy an entity, its handle and every copy of it stop being alive
+ECSAPI void DestroyEntity(EcsWorld* world, Entity entity)
+{
+    if (!IsEntityAlive(world, entity)) return;
+
+    EcsRecord& record = world->records[entity.index];
+    FreeEcsRow(world, record.archetype, record.chunk, record.row);
+    record.archetype = nullptr;
+    record.generation = (record.generation + 1 == 0) ? 1 : record.generation + 1;
+    world->freeIndices.push_back(entity.index);
+    world->entityCount--;
+}
+
+// Storage of component 'id' of an entity, null when the entity does not have it
+ECSAPI void* GetEcsComponent(EcsWorld* world, Entity entity, int id)
+{
+    const EcsRecord& record = world->records[entity.index];
+    int offset = record.archetype->offsets[id];
+    if (offset < 0) return nullptr;
+
+    return record.archetype->chunks[record.chunk]->data + offset + record.row*GetEcsComponentTable()[id].size;
+}
+
+// Give an entity component 'id' (uninitialized when new) and return its storage
+ECSAPI void* AddEcsComponent(EcsWorld* world, Entity entity, int id)
+{
+    EcsArchetype* source = world->records[entity.index].archetype;
+    if (source->offsets[id] < 0)
+    {
+        EcsArchetype* target = source->addEdge[id];
+        if (!target)
+        {
+            target = GetEcsArchetype(world, source->mask | (1ull << id));
+            source->addEdge[id] = target;
+            target->removeEdge[id] = source;
+        }
+        MoveEcsEntity(world, entity, target);
+    }
+
+    return GetEcsComponent(world, entity, id);
+}
+
+ECSAPI void RemoveEcsComponent(EcsWorld* world, Entity entity, int id)
+{
+    EcsArchetype* source = world->records[entity.index].archetype;
+    if (source->offsets[id] < 0) return;
+
+    EcsArchetype* target = source->removeEdge[id];
+    if (!target)
+    {
+        target = GetEcsArchetype(world, source->mask & ~(1ull << id));
+        source->removeEdge[id] = target;
+        target->addEdge[id] = source;
+    }
+    MoveEcsEntity(world, entity, target);
+}
+
+// Create an entity with the given components
+template <typename... Ts>
+ECSAPI Entity CreateEntity(EcsWorld* world, const Ts&... components)
+{
+    Entity entity = CreateEcsEntity(world, EcsMask<Ts...>());
+    ((*(Ts*)GetEcsComponent(world, entity, EcsComponentId<Ts>()) = components), ...);
+
+    return entity;
+}
+
+// Add or overwrite a component
+template <typename T>
+ECSAPI T* AddComponent(EcsWorld* world, Entity entity, const T& value)
+{
+    T* component = (T*)AddEcsComponent(world, entity, EcsComponentId<T>());
+    *component = value;
+
+    return component;
+}
+
+template <typename T>
+ECSAPI void RemoveComponent(EcsWorld* world, Entity entity)
+{
+    RemoveEcsComponent(world, entity, EcsComponentId<T>());
+}
+
+// NOTE: The pointer is valid until the next structural change (create, destroy, add, remove)
+template <typename T>
+ECSAPI T* GetComponent(EcsWorld* world, Entity entity)
+{
+    return (T*)GetEcsComponent(world, entity, EcsComponentId<T>());
+}
+
+template <typename T>
+ECSAPI bool HasComponent(const EcsWorld* world, Entity entity)
+{
+    return world->records[entity.index].archetype->offsets[EcsComponentId<T>()] >= 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Queries
+//----------------------------------------------------------------------------------
+
+// Call fn(const Entity* entities, int count, Ts*... components) for every chunk of the
+// archetypes that have all of Ts (and maybe more)
+template <typename... Ts, typename Fn>
+ECSAPI void QueryChunks(EcsWorld* world, Fn&& fn)
+{
+    uint64_t mask = EcsMask<Ts...>();
+
+    for (EcsArchetype* archetype : world->archetypes)
+    {
+        if ((archetype->mask & mask) != mask) continue;
+
+        for (EcsChunk* chunk : archetype->chunks)
+        {
+            fn((const Entity*)chunk->data, chunk->count, (Ts*)(chunk->data + archetype->offsets[EcsComponentId<Ts>()])...);
+        }
+    }
+}
+
+// Call fn(Ts&... components) for every entity that has all of Ts
+template <typename... Ts, typename Fn>
+ECSAPI void QueryEach(EcsWorld* world, Fn&& fn)
+{
+    QueryChunks<Ts...>(world, [&](const Entity*, int count, Ts*... components) {
+        for (int i = 0; i < count; i++) fn(components[i]...);
+    });
+}
+
+// QueryChunks() with the chunks spread over the job system, waits for all of them
+// NOTE: fn runs concurrently on different chunks, a query may not run another parallel query
+template <typename... Ts, typename Fn>
+ECSAPI void ParallelQueryChunks(EcsWorld* world, JobSystem* jobs, const Fn& fn)
+{
+    uint64_t mask = EcsMask<Ts...>();
+
+    world->queryChunks.clear();
+    world->queryArchetypes.clear();
+    for (EcsArchetype* archetype : world->archetypes)
+    {
+        if ((archetype->mask & mask) != mask) continue;
+
+        for (EcsChunk* chunk : archetype->chunks)
+        {
+            world->queryChunks.push_back(chunk);
+            world->queryArchetypes.push_back(archetype);
+        }
+    }
+
+    EcsChunk* const* chunks = world->queryChunks.data();
+    EcsArchetype* const* archetypes = world->queryArchetypes.data();
+    ParallelFor(jobs, (int)world->queryChunks.size(), ECS_PARALLEL_CHUNKS, [&](int begin, int end) {
+        for (int i = begin; i < end; i++)
+        {
+            fn((const Entity*)chunks[i]->data, chunks[i]->count, (Ts*)(chunks[i]->data + archetypes[i]->offsets[EcsComponentId<Ts>()])...);
+        }
+    });
+}
+
+template <typename... Ts, typename Fn>
+ECSAPI void ParallelQueryEach(EcsWorld* world, JobSystem* jobs, const Fn& fn)
+{
+    ParallelQueryChunks<Ts...>(world, jobs, [&](const Entity*, int count, Ts*... components) {
+        for (int i = 0; i < count; i++) fn(components[i]...);
+    });
+}
@@ -0,0 +1,423 @@
+#pragma once
+#include <cmath>
+#include <cstring>
+#include "Simd.h"
+
+//----------------------------------------------------------------------------------
+// Fast trigonometry
+//
+// Branch-free polynomial approximations that vectorize, in scalar, SSE and AVX2 forms
+// Maximum absolute error measured against libm (see bench/BenchTrig.cpp):
+//
+//   FastSin, FastCos, FastSinCos  : 1.2e-7 for |x| <= 8192, degrades beyond (Cody-Waite reduction)
+//   FastAtan2                     : 3.0e-7 rad, FastAtan2(0, 0) returns 0
+//   FastAcos                      : 4.8e-7 rad, input is clamped to [-1, 1]
+//
+// Math.h routes its angle based Vector2 helpers through these when MATH_FAST_TRIG is defined
+//----------------------------------------------------------------------------------
+
+#ifndef FMAPI
+#define FMAPI inline
+#endif
+
+// Cody-Waite split of PI/2, the first part has few enough bits that j*part is exact
+#define FASTMATH_PIO2_1 1.5703125f
+#define FASTMATH_PIO2_2 4.837512969970703125e-4f
+#define FASTMATH_PIO2_3 7.54978995489188216e-8f
+#define FASTMATH_2OPI 0.636619772367581343f
+
+// Minimax coefficients on [-PI/4, PI/4] (Cephes sinf/cosf)
+#define FASTMATH_SIN_C1 -1.6666654611e-1f
+#define FASTMATH_SIN_C2 8.3321608736e-3f
+#define FASTMATH_SIN_C3 -1.9515295891e-4f
+#define FASTMATH_COS_C1 4.166664568298827e-2f
+#define FASTMATH_COS_C2 -1.388731625493765e-3f
+#define FASTMATH_COS_C3 2.443315711809948e-5f
+
+// Minimax coefficients for atan on [-tan(PI/8), tan(PI/8)] (Cephes atanf)
+#define FASTMATH_ATAN_C1 -3.33329491539e-1f
+#define FASTMATH_ATAN_C2 1.99777106478e-1f
+#define FASTMATH_ATAN_C3 -1.38776856032e-1f
+#define FASTMATH_ATAN_C4 8.05374449538e-2f
+#define FASTMATH_TAN_PI8 0.414213562373095f
+
+// acos(x) ~ sqrt(1 - x)*P(x) on [0, 1] (Abramowitz & Stegun 4.4.46)
+#define FASTMATH_ACOS_C0 1.5707963050f
+#define FASTMATH_ACOS_C1 -0.2145988016f
+#define FASTMATH_ACOS_C2 0.0889789874f
+#define FASTMATH_ACOS_C3 -0.0501743046f
+#define FASTMATH_ACOS_C4 0.0308918810f
+#define FASTMATH_ACOS_C5 -0.0170881256f
+#define FASTMATH_ACOS_C6 0.0066700901f
+#define FASTMATH_ACOS_C7 -0.0012624911f
+
+#define FASTMATH_PI 3.14159265358979323846f
+#define FASTMATH_PIO2 1.57079632679489661923f
+#define FASTMATH_PIO4 0.78539816339744830962f
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Scalar
+//----------------------------------------------------------------------------------
+
+// Select a if cond is set, b otherwise, on the bits so compilers emit no branch
+FMAPI float FastSelect(bool cond, float a, float b)
+{
+    unsigned int mask = 0u - (unsigned int)cond;
+    unsigned int abits, bbits;
+    memcpy(&abits, &a, sizeof(float));
+    memcpy(&bbits, &b, sizeof(float));
+
+    unsigned int bits = (abits & mask) | (bbits & ~mask);
+    float result;
+    memcpy(&result, &bits, sizeof(float));
+
+    return result;
+}
+
+// Compute sine and cosine of an angle in radians
+FMAPI void FastSinCos(float x, float* outSin, float* outCos)
+{
+    // Reduce to r in [-PI/4, PI/4] and quadrant j
+    float fj = x * FASTMATH_2OPI;
+    fj = (float)(int)(fj + copysignf(0.5f, fj));
+    int j = (int)fj;
+    float r = ((x - fj * FASTMATH_PIO2_1) - fj * FASTMATH_PIO2_2) - fj * FASTMATH_PIO2_3;
+
+    float z = r * r;
+    float s = r + r * z * ((FASTMATH_SIN_C3 * z + FASTMATH_SIN_C2) * z + FASTMATH_SIN_C1);
+    float c = 1.0f - 0.5f * z + z * z * ((FASTMATH_COS_C3 * z + FASTMATH_COS_C2) * z + FASTMATH_COS_C1);
+
+    // Quadrant swap and sign flips without branches, they mispredict on arbitrary angles
+    float sinres = FastSelect(j & 1, c, s);
+    float cosres = FastSelect(j & 1, s, c);
+
+    *outSin = FastSelect(j & 2, -sinres, sinres);
+    *outCos = FastSelect((j + 1) & 2, -cosres, cosres);
+}
+
+// Compute sine of an angle in radians
+FMAPI float FastSin(float x)
+{
+    float s, c;
+    FastSinCos(x, &s, &c);
+
+    return s;
+}
+
+// Compute cosine of an angle in radians
+FMAPI float FastCos(float x)
+{
+    float s, c;
+    FastSinCos(x, &s, &c);
+
+    return c;
+}
+
+// Compute atan2(y, x) in radians, range [-PI, PI]
+FMAPI float FastAtan2(float y, float x)
+{
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    float mx = FastSelect(ax > ay, ax, ay);
+    float mn = FastSelect(ax > ay, ay, ax);
+
+    // atan(mn/mx) for mn/mx in [0, 1], reduced around PI/4 above tan(PI/8)
+    bool upper = mn > FASTMATH_TAN_PI8 * mx;
+    float num = FastSelect(upper, mn - mx, mn);
+    float den = FastSelect(upper, mn + mx, mx);
+    float t = FastSelect(den > 0.0f, num / den, 0.0f);
+    float z = t * t;
+    float result = (((FASTMATH_ATAN_C4 * z + FASTMATH_ATAN_C3) * z + FASTMATH_ATAN_C2) * z + FASTMATH_ATAN_C1) * z * t + t;
+
+    // Octant fixups as offset + signed term, same as the SIMD selects
+    result = FastSelect(upper, FASTMATH_PIO4, 0.0f) + result;
+    result = FastSelect(ay > ax, FASTMATH_PIO2, 0.0f) + FastSelect(ay > ax, -result, result);
+    result = FastSelect(x < 0.0f, FASTMATH_PI, 0.0f) + FastSelect(x < 0.0f, -result, result);
+
+    return FastSelect(y < 0.0f, -result, result);
+}
+
+// Compute acos(x) in radians, range [0, PI]
+FMAPI float FastAcos(float x)
+{
+    x = (x < -1.0f) ? -1.0f : ((x > 1.0f) ? 1.0f : x);
+    float a = fabsf(x);
+
+    float p = ((((((FASTMATH_ACOS_C7 * a + FASTMATH_ACOS_C6) * a + FASTMATH_ACOS_C5) * a + FASTMATH_ACOS_C4) * a +
+        FASTMATH_ACOS_C3) * a + FASTMATH_ACOS_C2) * a + FASTMATH_ACOS_C1) * a + FASTMATH_ACOS_C0;
+    float result = sqrtf(1.0f - a) * p;
+
+    return (x < 0.0f) ? FASTMATH_PI - result : result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - SSE (4 lanes)
+//----------------------------------------------------------------------------------
+#if SIMD_SSE
+
+// Select a where mask is set, b elsewhere
+FMAPI __m128 FastSelect4(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+FMAPI void FastSinCos4(__m128 x, __m128* outSin, __m128* outCos)
+{
+    __m128i j = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(FASTMATH_2OPI)));
+    __m128 fj = _mm_cvtepi32_ps(j);
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(fj, _mm_set1_ps(FASTMATH_PIO2_1)));
+    r = _mm_sub_ps(r, _mm_mul_ps(fj, _mm_set1_ps(FASTMATH_PIO2_2)));
+    r = _mm_sub_ps(r, _mm_mul_ps(fj, _mm_set1_ps(FASTMATH_PIO2_3)));
+
+    __m128 z = _mm_mul_ps(r, r);
+    __m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FASTMATH_SIN_C3), z), _mm_set1_ps(FASTMATH_SIN_C2));
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(FASTMATH_SIN_C1));
+    s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), s));
+    __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FASTMATH_COS_C3), z), _mm_set1_ps(FASTMATH_COS_C2));
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(FASTMATH_COS_C1));
+    c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_mul_ps(_mm_mul_ps(z, z), c));
+
+    __m128i one = _mm_set1_epi32(1);
+    __m128i two = _mm_set1_epi32(2);
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, one), one));
+    __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, two), 30));
+    __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(j, one), two), 30));
+
+    *outSin = _mm_xor_ps(FastSelect4(swap, c, s), sinSign);
+    *outCos = _mm_xor_ps(FastSelect4(swap, s, c), cosSign);
+}
+
+FMAPI __m128 FastAtan2_4(__m128 y, __m128 x)
+{
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_andnot_ps(signMask, x);
+    __m128 ay = _mm_andnot_ps(signMask, y);
+    __m128 mx = _mm_max_ps(ax, ay);
+    __m128 mn = _mm_min_ps(ax, ay);
+
+    __m128 upper = _mm_cmpgt_ps(mn, _mm_mul_ps(_mm_set1_ps(FASTMATH_TAN_PI8), mx));
+    __m128 num = FastSelect4(upper, _mm_sub_ps(mn, mx), mn);
+    __m128 den = FastSelect4(upper, _mm_add_ps(mn, mx), mx);
+    __m128 t = _mm_and_ps(_mm_cmpgt_ps(den, _mm_setzero_ps()), _mm_div_ps(num, den));
+
+    __m128 z = _mm_mul_ps(t, t);
+    __m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FASTMATH_ATAN_C4), z), _mm_set1_ps(FASTMATH_ATAN_C3));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(FASTMATH_ATAN_C2));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(FASTMATH_ATAN_C1));
+    __m128 result = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t);
+    result = _mm_add_ps(result, _mm_and_ps(upper, _mm_set1_ps(FASTMATH_PIO4)));
+
+    result = FastSelect4(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(FASTMATH_PIO2), result), result);
+    result = FastSelect4(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(FASTMATH_PI), result), result);
+
+    return _mm_xor_ps(result, _mm_and_ps(_mm_cmplt_ps(y, _mm_setzero_ps()), signMask));
+}
+
+FMAPI __m128 FastAcos4(__m128 x)
+{
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+    __m128 a = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+    __m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FASTMATH_ACOS_C7), a), _mm_set1_ps(FASTMATH_ACOS_C6));
+    p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(FASTMATH_ACOS_C5));
+    p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(FASTMATH_ACOS_C4));
+    p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(FASTMATH_ACOS_C3));
+    p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(FASTMATH_ACOS_C2));
+    p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(FASTMATH_ACOS_C1));
+    p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(FASTMATH_ACOS_C0));
+    __m128 result = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), a)), p);
+
+    return FastSelect4(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(FASTMATH_PI), result), result);
+}
+
+#endif // SIMD_SSE
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - AVX2 (8 lanes)
+//----------------------------------------------------------------------------------
+#if SIMD_X86
+
+SIMD_TARGET_AVX2 FMAPI void FastSinCos8(__m256 x, __m256* outSin, __m256* outCos)
+{
+    __m256i j = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(FASTMATH_2OPI)));
+    __m256 fj = _mm256_cvtepi32_ps(j);
+    __m256 r = _mm256_sub_ps(x, _mm256_mul_ps(fj, _mm256_set1_ps(FASTMATH_PIO2_1)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(fj, _mm256_set1_ps(FASTMATH_PIO2_2)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(fj, _mm256_set1_ps(FASTMATH_PIO2_3)));
+
+    __m256 z = _mm256_mul_ps(r, r);
+    __m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(FASTMATH_SIN_C3), z), _mm256_set1_ps(FASTMATH_SIN_C2));
+    s = _mm256_add_ps(_mm256_mul_ps(s, z), _mm256_set1_ps(FASTMATH_SIN_C1));
+    s = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, z), s));
+    __m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(FASTMATH_COS_C3), z), _mm256_set1_ps(FASTMATH_COS_C2));
+    c = _mm256_add_ps(_mm256_mul_ps(c, z), _mm256_set1_ps(FASTMATH_COS_C1));
+    c = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), z)), _mm256_mul_ps(_mm256_mul_ps(z, z), c));
+
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i two = _mm256_set1_epi32(2);
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, one), one));
+    __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, two), 30));
+    __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(j, one), two), 30));
+
+    *outSin = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sinSign);
+    *outCos = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cosSign);
+}
+
+SIMD_TARGET_AVX2 FMAPI __m256 FastAtan2_8(__m256 y, __m256 x)
+{
+    __m256 signMask = _mm256_set1_ps(-0.0f);
+    __m256 zero = _mm256_setzero_ps();
+    __m256 ax = _mm256_andnot_ps(signMask, x);
+    __m256 ay = _mm256_andnot_ps(signMask, y);
+    __m256 mx = _mm256_max_ps(ax, ay);
+    __m256 mn = _mm256_min_ps(ax, ay);
+
+    __m256 upper = _mm256_cmp_ps(mn, _mm256_mul_ps(_mm256_set1_ps(FASTMATH_TAN_PI8), mx), _CMP_GT_OQ);
+    __m256 num = _mm256_blendv_ps(mn, _mm256_sub_ps(mn, mx), upper);
+    __m256 den = _mm256_blendv_ps(mx, _mm256_add_ps(mn, mx), upper);
+    __m256 t = _mm256_and_ps(_mm256_cmp_ps(den, zero, _CMP_GT_OQ), _mm256_div_ps(num, den));
+
+    __m256 z = _mm256_mul_ps(t, t);
+    __m256 p = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(FASTMATH_ATAN_C4), z), _mm256_set1_ps(FASTMATH_ATAN_C3));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(FASTMATH_ATAN_C2));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(FASTMATH_ATAN_C1));
+    __m256 result = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, z), t), t);
+    result = _mm256_add_ps(result, _mm256_and_ps(upper, _mm256_set1_ps(FASTMATH_PIO4)));
+
+    result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(FASTMATH_PIO2), result), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(FASTMATH_PI), result), _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+
+    return _mm256_xor_ps(result, _mm256_and_ps(_mm256_cmp_ps(y, zero, _CMP_LT_OQ), signMask));
+}
+
+SIMD_TARGET_AVX2 FMAPI __m256 FastAcos8(__m256 x)
+{
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+    __m256 a = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+
+    __m256 p = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(FASTMATH_ACOS_C7), a), _mm256_set1_ps(FASTMATH_ACOS_C6));
+    p = _mm256_add_ps(_mm256_mul_ps(p, a), _mm256_set1_ps(FASTMATH_ACOS_C5));
+    p = _mm256_add_ps(_mm256_mul_ps(p, a), _mm256_set1_ps(FASTMATH_ACOS_C4));
+    p = _mm256_add_ps(_mm256_mul_ps(p, a), _mm256_set1_ps(FASTMATH_ACOS_C3));
+    p = _mm256_add_ps(_mm256_mul_ps(p, a), _mm256_set1_ps(FASTMATH_ACOS_C2));
+    p = _mm256_add_ps(_mm256_mul_ps(p, a), _mm256_set1_ps(FASTMATH_ACOS_C1));
+    p = _mm256_add_ps(_mm256_mul_ps(p, a), _mm256_set1_ps(FASTMATH_ACOS_C0));
+    __m256 result = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), a)), p);
+
+    return _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(FASTMATH_PI), result), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+}
+
+#endif // SIMD_X86
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Array kernels (uses GetSimdLevel())
+//----------------------------------------------------------------------------------
+
+FMAPI void SinCosBatchScalar(const float* angles, float* outSin, float* outCos, int count)
+{
+    for (int i = 0; i < count; i++) FastSinCos(angles[i], &outSin[i], &outCos[i]);
+}
+
+FMAPI void Atan2BatchScalar(const float* y, const float* x, float* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = FastAtan2(y[i], x[i]);
+}
+
+FMAPI void AcosBatchScalar(const float* x, float* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = FastAcos(x[i]);
+}
+
+#if SIMD_SSE
+FMAPI void SinCosBatchSSE(const float* angles, float* outSin, float* outCos, int count)
+{
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 s, c;
+        FastSinCos4(_mm_loadu_ps(angles + i), &s, &c);
+        _mm_storeu_ps(outSin + i, s);
+        _mm_storeu_ps(outCos + i, c);
+    }
+    SinCosBatchScalar(angles + i, outSin + i, outCos + i, count - i);
+}
+
+FMAPI void Atan2BatchSSE(const float* y, const float* x, float* out, int count)
+{
+    int i = 0;
+    for (; i + 4 <= count; i += 4) _mm_storeu_ps(out + i, FastAtan2_4(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+    Atan2BatchScalar(y + i, x + i, out + i, count - i);
+}
+
+FMAPI void AcosBatchSSE(const float* x, float* out, int count)
+{
+    int i = 0;
+    for (; i + 4 <= count; i += 4) _mm_storeu_ps(out + i, FastAcos4(_mm_loadu_ps(x + i)));
+    AcosBatchScalar(x + i, out + i, count - i);
+}
+#endif // SIMD_SSE
+
+#if SIMD_X86
+SIMD_TARGET_AVX2 FMAPI void SinCosBatchAVX2(const float* angles, float* outSin, float* outCos, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 s, c;
+        FastSinCos8(_mm256_loadu_ps(angles + i), &s, &c);
+        _mm256_storeu_ps(outSin + i, s);
+        _mm256_storeu_ps(outCos + i, c);
+    }
+    SinCosBatchScalar(angles + i, outSin + i, outCos + i, count - i);
+}
+
+SIMD_TARGET_AVX2 FMAPI void Atan2BatchAVX2(const float* y, const float* x, float* out, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8) _mm256_storeu_ps(out + i, FastAtan2_8(_mm256_loadu_ps(y + i), _mm256_loadu_ps(x + i)));
+    Atan2BatchScalar(y + i, x + i, out + i, count - i);
+}
+
+SIMD_TARGET_AVX2 FMAPI void AcosBatchAVX2(const float* x, float* out, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8) _mm256_storeu_ps(out + i, FastAcos8(_mm256_loadu_ps(x + i)));
+    AcosBatchScalar(x + i, out + i, count - i);
+}
+#endif // SIMD_X86
+
+// Compute sine and cosine for an array of angles
+FMAPI void SinCosBatch(const float* angles, float* outSin, float* outCos, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { SinCosBatchAVX2(angles, outSin, outCos, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { SinCosBatchSSE(angles, outSin, outCos, count); return; }
+#endif
+    SinCosBatchScalar(angles, outSin, outCos, count);
+}
+
+// Compute atan2(y[i], x[i]) for arrays of coordinates
+FMAPI void Atan2Batch(const float* y, const float* x, float* out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { Atan2BatchAVX2(y, x, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { Atan2BatchSSE(y, x, out, count); return; }
+#endif
+    Atan2BatchScalar(y, x, out, count);
+}
+
+// Compute acos(x[i]) for an array of values
+FMAPI void AcosBatch(const float* x, float* out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { AcosBatchAVX2(x, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { AcosBatchSSE(x, out, count); return; }
+#endif
+    AcosBatchScalar(x, out, count);
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include "GameLoop.h"
+#include "DrawList.h"
+#include "JobSystem.h"
+#include "Arena.h"
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Game simulation
+//
+// Everything the game does per tick, shared by the window loop and the headless runner in
+// main.cpp. Nothing here calls raylib: drawing goes to a DrawList and time comes from the
+// caller's clock, so the simulation runs without InitWindow or a GL context
+//----------------------------------------------------------------------------------
+
+#define GAME_SCREEN_SIZE 800
+#define GAME_TICKS_PER_SECOND 60
+#define GAME_MAX_TICKS_PER_FRAME 8
+#define GAME_BALL_COUNT 256
+#define GAME_BALL_RADIUS 6.0f
+
+// Fewest balls per job piece of the parallel update, the pieces are otherwise sized to give
+// every worker GAME_UPDATE_PIECES_PER_WORKER of them so that stealing can even out the load
+#define GAME_UPDATE_MIN_GRAIN 64
+#define GAME_UPDATE_PIECES_PER_WORKER 4
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct Ball {
+    Vector2 position;
+    Vector2 velocity;
+};
+
+// Simulation state, copied once per tick so that rendering can interpolate
+struct World {
+    std::vector<Ball> balls;
+};
+
+struct Game {
+    GameLoop loop;
+    JobSystem* jobs;            // Workers for the tick updates, null to update on the calling thread
+    World previous;             // State of the previous tick
+    World current;              // State of the last tick
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Create the world with ballCount balls, the same seed gives the same simulation
+RMAPI void InitGame(Game* game, int ballCount, uint64_t seed, JobSystem* jobs = nullptr)
+{
+    SeedRandom(seed);
+
+    game->jobs = jobs;
+    game->loop = CreateGameLoop(GAME_TICKS_PER_SECOND, GAME_MAX_TICKS_PER_FRAME);
+    game->current.balls.resize(ballCount);
+    for (Ball& ball : game->current.balls)
+    {
+        ball.position = Vector2{ Random(GAME_BALL_RADIUS, GAME_SCREEN_SIZE - GAME_BALL_RADIUS), Random(GAME_BALL_RADIUS, GAME_SCREEN_SIZE*0.5f) };
+        ball.velocity = Vector2{ Random(-200.0f, 200.0f), Random(-50.0f, 50.0f) };
+    }
+    game->previous = game->current;
+}
+
+// Advance balls [begin, end) by one fixed tick
+RMAPI void UpdateBalls(Ball* balls, int begin, int end, float dt)
+{
+    const Vector2 gravity = { 0.0f, 600.0f };
+    const Vector2 minPosition = { GAME_BALL_RADIUS, GAME_BALL_RADIUS - GAME_SCREEN_SIZE };
+    const Vector2 maxPosition = { GAME_SCREEN_SIZE - GAME_BALL_RADIUS, GAME_SCREEN_SIZE - GAME_BALL_RADIUS };
+
+    for (int i = begin; i < end; i++)
+    {
+        Ball& ball = balls[i];
+        ball.velocity = ball.velocity + gravity*dt;
+        ball.position = ball.position + ball.velocity*dt;
+
+        // Bounce on the window borders
+        if (ball.position.x < minPosition.x || ball.position.x > maxPosition.x) ball.velocity.x = -ball.velocity.x;
+        if (ball.position.y > maxPosition.y) ball.velocity.y = -0.95f*fabsf(ball.velocity.y);
+        ball.position = Clamp(ball.position, minPosition, maxPosition);
+    }
+}
+
+// Advance the world by one fixed tick, fanned out over the job system when there is one
+RMAPI void UpdateWorld(World* world, float dt, JobSystem* jobs)
+{
+    Ball* balls = world->balls.data();
+    int count = (int)world->balls.size();
+
+    if (jobs)
+    {
+        int grain = count/(GetJobWorkerCount(jobs)*GAME_UPDATE_PIECES_PER_WORKER);
+        if (grain < GAME_UPDATE_MIN_GRAIN) grain = GAME_UPDATE_MIN_GRAIN;
+        ParallelFor(jobs, count, grain, [=](int begin, int end) { UpdateBalls(balls, begin, end, dt); });
+    }
+    else UpdateBalls(balls, 0, count, dt);
+}
+
+// Run the ticks due at the given clock value (seconds), returns the number of ticks run
+// NOTE: Every tick is done when this returns, the world can be drawn right away
+RMAPI int StepGame(Game* game, double time)
+{
+    int ticks = AdvanceGameLoop(&game->loop, time);
+    for (int i = 0; i < ticks; i++)
+    {
+        game->previous.balls = game->current.balls;
+        UpdateWorld(&game->current, (float)game->loop.tickSeconds, game->jobs);
+    }
+
+    return ticks;
+}
+
+// Draw the state between the last two ticks, the HUD text goes to the frame arena
+RMAPI void DrawGame(const Game& game, DrawList* list, FrameArena* frame)
+{
+    float alpha = GetGameLoopAlpha(game.loop);
+    const std::vector<Ball>& previous = game.previous.balls;
+    const std::vector<Ball>& current = game.current.balls;
+
+    for (size_t i = 0; i < current.size(); i++)
+    {
+        DrawListCircle(list, InterpolatePosition(previous[i].position, current[i].position, alpha), GAME_BALL_RADIUS, MAROON);
+    }
+
+    DrawListText(list, FrameFormat(frame, "tick %lld, dropped %.2f s", game.loop.tick, game.loop.droppedSeconds), 10, 70, 20, DARKGRAY);
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "Math.h"
+
+//----------------------------------------------------------------------------------
+// Fixed timestep game loop
+//
+// The simulation advances in ticks of a fixed length, independent of the display refresh.
+// Every frame adds the elapsed real time to an accumulator and runs as many ticks as fit,
+// rendering then interpolates between the last two tick states with GetGameLoopAlpha()
+//
+// A frame never runs more than maxTicksPerFrame ticks: after a long stall (debugger break,
+// window drag, loading hitch) the simulation slows down instead of spending the next frame
+// catching up, which would take even longer (spiral of death). The skipped time is counted
+// in droppedSeconds
+//
+// Usage:
+//   GameLoop loop = CreateGameLoop(60, 8);
+//   while (!WindowShouldClose())
+//   {
+//       int ticks = AdvanceGameLoop(&loop, GetTime());
+//       for (int i = 0; i < ticks; i++) { previous = current; Update(&current, loop.tickSeconds); }
+//       DrawCircleV(InterpolatePosition(previous.position, current.position, GetGameLoopAlpha(loop)), 8.0f, RED);
+//   }
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct GameLoop {
+    double tickSeconds;         // Simulation step
+    double accumulator;         // Real time not simulated yet, below tickSeconds after each frame
+    double lastTime;            // Clock value of the previous frame, negative before the first one
+    double droppedSeconds;      // Time skipped by the catch-up cap since creation
+    long long tick;             // Ticks run since creation
+    int maxTicksPerFrame;       // Catch-up cap
+    int frameTicks;             // Ticks requested by the last AdvanceGameLoop()
+} GameLoop;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Game loop
+//----------------------------------------------------------------------------------
+
+// Create a loop ticking ticksPerSecond times per second, at most maxTicksPerFrame per frame
+RMAPI GameLoop CreateGameLoop(int ticksPerSecond, int maxTicksPerFrame)
+{
+    GameLoop loop = { 0 };
+    loop.tickSeconds = 1.0/ticksPerSecond;
+    loop.lastTime = -1.0;
+    loop.maxTicksPerFrame = (maxTicksPerFrame > 0) ? maxTicksPerFrame : 1;
+
+    return loop;
+}
+
+// Add the time elapsed since the previous frame and get the number of ticks to run
+// NOTE: time is an absolute clock in seconds (GetTime()), the first call only starts the clock
+RMAPI int AdvanceGameLoop(GameLoop* loop, double time)
+{
+    double elapsed = (loop->lastTime < 0.0) ? 0.0 : time - loop->lastTime;
+    loop->lastTime = time;
+
+    // A clock going backwards adds nothing
+    if (elapsed > 0.0) loop->accumulator += elapsed;
+
+    int ticks = (int)(loop->accumulator/loop->tickSeconds);
+    if (ticks > loop->maxTicksPerFrame)
+    {
+        // Keep the phase within the tick, drop the whole ticks that do not fit
+        double remainder = fmod(loop->accumulator, loop->tickSeconds);
+        loop->droppedSeconds += (ticks - loop->maxTicksPerFrame)*loop->tickSeconds;
+        loop->accumulator = remainder + loop->maxTicksPerFrame*loop->tickSeconds;
+        ticks = loop->maxTicksPerFrame;
+    }
+
+    loop->accumulator -= ticks*loop->tickSeconds;
+    if (loop->accumulator < 0.0) loop->accumulator = 0.0;
+    loop->tick += ticks;
+    loop->frameTicks = ticks;
+
+    return ticks;
+}
+
+// Position of the frame between the previous tick (0.0f) and the current one (1.0f)
+RMAPI float GetGameLoopAlpha(GameLoop loop)
+{
+    float alpha = (float)(loop.accumulator/loop.tickSeconds);
+
+    return Clamp(alpha, 0.0f, 1.0f);
+}
+
+// Simulation time of the current tick in seconds
+RMAPI double GetGameLoopTime(GameLoop loop)
+{
+    return loop.tick*loop.tickSeconds;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Render interpolation
+//----------------------------------------------------------------------------------
+
+// Position between the previous and current tick
+RMAPI Vector2 InterpolatePosition(Vector2 previous, Vector2 current, float alpha)
+{
+    return Lerp(previous, current, alpha);
+}
+
+RMAPI Vector3 InterpolatePosition(Vector3 previous, Vector3 current, float alpha)
+{
+    return Lerp(previous, current, alpha);
+}
+
+// Rotation between the previous and current tick
+RMAPI Quaternion InterpolateRotation(Quaternion previous, Quaternion current, float alpha)
+{
+    return Slerp(previous, current, alpha);
+}
+
+// 2D rotation between the previous and current tick, along the shortest arc
+// NOTE: Angles must be provided in radians
+RMAPI float InterpolateAngle(float previous, float current, float alpha)
+{
+    float delta = Wrap(current - previous, -PI, PI);
+
+    return previous + delta*alpha;
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "Game.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+//----------------------------------------------------------------------------------
+// Headless simulation
+//
+// Runs StepGame()/DrawGame() without a window or GL context, on a fake clock that advances
+// by one frame interval per frame. Frames run as fast as possible (throughput benchmark) or
+// paced to the wall clock (load tests at the real rate). Draw calls are counted, or recorded
+// with --record
+//
+//   game --headless [--ticks N] [--frame-rate HZ] [--realtime] [--record] [--balls N] [--seed N] [--threads N]
+//
+// Builds with GAME_HEADLESS defined (the CMake 'headless' target) run headless always and do
+// not link raylib
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct HeadlessOptions {
+    bool enabled;               // --headless
+    long long ticks;            // Simulation ticks to run
+    double frameRate;           // Frames per second of the fake clock
+    bool realTime;              // Sleep so that frames follow the wall clock
+    bool record;                // Record the draw calls instead of discarding them
+    int ballCount;
+    uint64_t seed;
+    int threadCount;            // Job system workers, 0: one per hardware thread
+} HeadlessOptions;
+
+typedef struct HeadlessResult {
+    long long ticks;            // Ticks run
+    long long frames;           // Frames run (StepGame + DrawGame)
+    long long drawCalls;        // Draw calls issued by DrawGame
+    double wallSeconds;         // Wall time of the run
+    double simulatedSeconds;    // Fake clock time of the run
+} HeadlessResult;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+RMAPI HeadlessOptions DefaultHeadlessOptions(void)
+{
+    HeadlessOptions options = { 0 };
+    options.ticks = 60*GAME_TICKS_PER_SECOND;
+    options.frameRate = GAME_TICKS_PER_SECOND;
+    options.ballCount = GAME_BALL_COUNT;
+    options.seed = 1005;
+
+    return options;
+}
+
+// Read the headless options from the command line, unknown arguments are ignored
+RMAPI HeadlessOptions ParseHeadlessOptions(int argc, char** argv)
+{
+    HeadlessOptions options = DefaultHeadlessOptions();
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--headless") == 0) options.enabled = true;
+        else if (strcmp(argv[i], "--realtime") == 0) options.realTime = true;
+        else if (strcmp(argv[i], "--record") == 0) options.record = true;
+        else if (hasValue && strcmp(argv[i], "--ticks") == 0) options.ticks = atoll(argv[++i]);
+        else if (hasValue && strcmp(argv[i], "--frame-rate") == 0) options.frameRate = atof(argv[++i]);
+        else if (hasValue && strcmp(argv[i], "--balls") == 0) options.ballCount = atoi(argv[++i]);
+        else if (hasValue && strcmp(argv[i], "--seed") == 0) options.seed = strtoull(argv[++i], nullptr, 10);
+        else if (hasValue && strcmp(argv[i], "--threads") == 0) options.threadCount = atoi(argv[++i]);
+    }
+    if (options.frameRate <= 0.0) options.frameRate = GAME_TICKS_PER_SECOND;
+
+    return options;
+}
+
+// Run the game loop on the fake clock until options.ticks ticks have run
+RMAPI HeadlessResult RunHeadless(Game* game, HeadlessOptions options)
+{
+    using namespace std::chrono;
+
+    HeadlessResult result = { 0 };
+    FrameArena frame = CreateFrameArena(0);
+    DrawList list = {};
+    list.mode = options.record ? DRAW_LIST_RECORD : DRAW_LIST_DISCARD;
+
+    double frameSeconds = 1.0/options.frameRate;
+    steady_clock::time_point start = steady_clock::now();
+
+    // The first frame only starts the clock, as GetTime() does for the window loop
+    StepGame(game, 0.0);
+    while (result.ticks < options.ticks)
+    {
+        result.frames++;
+        double time = result.frames*frameSeconds;
+        if (options.realTime) std::this_thread::sleep_until(start + duration_cast<steady_clock::duration>(duration<double>(time)));
+
+        result.ticks += StepGame(game, time);
+
+        ClearDrawList(&list);
+        DrawGame(*game, &list, &frame);
+        result.drawCalls += list.callCount;
+        EndFrameArena(&frame);
+    }
+
+    result.wallSeconds = duration<double>(steady_clock::now() - start).count();
+    result.simulatedSeconds = result.frames*frameSeconds;
+    DestroyFrameArena(&frame);
+
+    return result;
+}
+
+RMAPI void PrintHeadlessResult(const Game& game, HeadlessOptions options, HeadlessResult result)
+{
+    int threads = game.jobs ? GetJobWorkerCount(game.jobs) : 1;
+    printf("Headless: %lld ticks, %lld frames, %d balls, %d threads, %s, draw calls %s\n", result.ticks, result.frames, options.ballCount, threads,
+        options.realTime ? "real time" : "as fast as possible", options.record ? "recorded" : "discarded");
+    printf("  simulated %.2f s in %.3f s wall, %.0f ticks/s (%.1fx real time), %lld draw calls\n", result.simulatedSeconds, result.wallSeconds,
+        result.ticks/result.wallSeconds, result.simulatedSeconds/result.wallSeconds, result.drawCalls);
+}
@@ -0,0 +1,477 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Work-stealing job system
+//
+// One worker per hardware thread, the thread that creates the system is worker 0. Each
+// worker owns a lock-free deque (Chase-Lev): it pushes and pops jobs at the bottom, idle
+// workers steal from the top of a random other worker. Waiting never blocks a worker, the
+// waiting thread runs other jobs until the one it waits for is done
+//
+// Jobs:
+//   - Children: a job created with a parent keeps the parent unfinished until it is done,
+//     WaitJob(parent) waits for the whole tree
+//   - Dependencies: AddJobDependency(ancestor, job) holds 'job' back until 'ancestor' and
+//     its children are done. A job starts once RunJob() was called and its dependency
+//     counter drops to zero
+//   - ParallelFor() splits an index range in halves until the pieces are below 'grain',
+//     the halves are stolen by the other workers
+//
+// Usage:
+//   JobSystem* jobs = CreateJobSystem(0);
+//   ParallelFor(jobs, count, 1024, [&](int begin, int end) { ...update entities [begin, end) });
+//
+//   Job* physics = CreateJob(jobs, [&]() { StepPhysics(); });
+//   Job* collide = CreateJob(jobs, [&]() { FindCollisions(); });
+//   AddJobDependency(physics, collide);
+//   RunJob(jobs, collide);
+//   RunJob(jobs, physics);
+//   WaitJob(jobs, collide);
+//   DestroyJobSystem(jobs);
+//
+// NOTE: Jobs can only be created and run from the worker threads (inside jobs or on the thread
+// that created the system). Jobs come from a per-worker ring of JOB_POOL_SIZE entries that is
+// never freed: a worker must not have more than JOB_POOL_SIZE jobs alive at once, CreateJob()
+// aborts when the ring wraps onto an unfinished job. ParallelFor() raises the grain so that it
+// never creates more than JOB_POOL_SIZE/2 pieces
+// NOTE: Add dependencies before running the ancestor, at most JOB_MAX_CONTINUATIONS per ancestor
+// (AddJobDependency() aborts past that)
+//----------------------------------------------------------------------------------
+
+#ifndef JOBAPI
+#define JOBAPI inline
+#endif
+
+// Jobs per worker ring (power of two), also the capacity of each deque
+#ifndef JOB_POOL_SIZE
+#define JOB_POOL_SIZE 4096
+#endif
+
+// Bytes of captured state stored inside a job
+#ifndef JOB_DATA_SIZE
+#define JOB_DATA_SIZE 56
+#endif
+
+#define JOB_MAX_CONTINUATIONS 4
+
+// Failed steal rounds before an idle worker goes to sleep
+#define JOB_IDLE_SPINS 64
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct Job;
+typedef void (*JobFunction)(Job* job, void* data);
+
+struct alignas(64) Job {
+    JobFunction function;
+    Job* parent;
+    std::atomic<int> unfinished;            // 1 for the job itself + children not done
+    std::atomic<int> dependencies;          // 1 until RunJob() + ancestors not done
+    Job* continuations[JOB_MAX_CONTINUATIONS];
+    int continuationCount;
+    alignas(16) unsigned char data[JOB_DATA_SIZE];
+};
+
+// Lock-free work-stealing deque (Chase-Lev, with the C11 orderings of Le et al. 2013)
+struct alignas(64) JobQueue {
+    std::atomic<int64_t> top;
+    alignas(64) std::atomic<int64_t> bottom;
+    alignas(64) std::atomic<Job*> jobs[JOB_POOL_SIZE];
+};
+
+struct JobWorker {
+    JobQueue queue;
+    Job* pool;                              // Ring of JOB_POOL_SIZE jobs
+    unsigned int poolIndex;
+    uint32_t random;                        // Victim selection (xorshift)
+    std::thread thread;
+};
+
+struct JobSystem {
+    std::vector<JobWorker*> workers;
+    std::atomic<bool> stopping;
+    std::atomic<uint32_t> epoch;            // Bumped on every push, wakes sleeping workers
+    std::atomic<int> sleeping;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Deque
+//----------------------------------------------------------------------------------
+
+// Owner only, false when the deque is full
+JOBAPI bool PushJobQueue(JobQueue* queue, Job* job)
+{
+    int64_t b = queue->bottom.load(std::memory_order_relaxed);
+    int64_t t = queue->top.load(std::memory_order_acquire);
+    if (b - t >= JOB_POOL_SIZE) return false;
+
+    queue->jobs[b & (JOB_POOL_SIZE - 1)].store(job, std::memory_order_relaxed);
+    queue->bottom.store(b + 1, std::memory_order_release);
+
+    return true;
+}
+
+// Owner only, most recently pushed job first
+JOBAPI Job* PopJobQueue(JobQueue* queue)
+{
+    // The bottom store and top load are seq_cst operations, not relaxed ones behind a fence: same code
+    // on x86 (the store is an xchg either way) and ThreadSanitizer only models the ordering this way
+    int64_t b = queue->bottom.load(std::memory_order_relaxed) - 1;
+    queue->bottom.store(b, std::memory_order_seq_cst);
+    int64_t t = queue->top.load(std::memory_order_seq_cst);
+
+    Job* job = nullptr;
+    if (t <= b)
+    {
+        job = queue->jobs[b & (JOB_POOL_SIZE - 1)].load(std::memory_order_relaxed);
+        if (t == b)
+        {
+            // Last job, race the thieves for it
+            if (!queue->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) job = nullptr;
+            queue->bottom.store(b + 1, std::memory_order_relaxed);
+        }
+    }
+    else queue->bottom.store(b + 1, std::memory_order_relaxed);
+
+    return job;
+}
+
+// Any thread, oldest job first
+JOBAPI Job* StealJobQueue(JobQueue* queue)
+{
+    // seq_cst pairs with the bottom store in PopJobQueue()
+    int64_t t = queue->top.load(std::memory_order_seq_cst);
+    int64_t b = queue->bottom.load(std::memory_order_seq_cst);
+
+    if (t >= b) return nullptr;
+
+    Job* job = queue->jobs[t & (JOB_POOL_SIZE - 1)].load(std::memory_order_relaxed);
+    if (!queue->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return nullptr;
+
+    return job;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Scheduling
+//----------------------------------------------------------------------------------
+
+// Index of the calling thread in its job system, -1 outside the workers
+JOBAPI int& JobWorkerIndex(void)
+{
+    thread_local int index = -1;
+
+    return index;
+}
+
+JOBAPI JobWorker* CurrentJobWorker(JobSystem* system)
+{
+    int index = JobWorkerIndex();
+
+    return (index >= 0) ? system->workers[index] : nullptr;
+}
+
+JOBAPI void ExecuteJob(JobSystem* system, Job* job);
+
+// Queue a job whose dependencies are done
+JOBAPI void PushJob(JobSystem* system, Job* job)
+{
+    JobWorker* worker = CurrentJobWorker(system);
+    if (!PushJobQueue(&worker->queue, job))
+    {
+        ExecuteJob(system, job);    // Deque full: run it now
+        return;
+    }
+
+    system->epoch.fetch_add(1);
+    if (system->sleeping.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(system->sleepMutex);
+        system->wake.notify_one();
+    }
+}
+
+// Called when a job or one of its children is done
+JOBAPI void FinishJob(JobSystem* system, Job* job)
+{
+    // Read everything first: once unfinished reaches zero a waiter may return and the ring reuse the job
+    Job* parent = job->parent;
+    int continuationCount = job->continuationCount;
+    Job* continuations[JOB_MAX_CONTINUATIONS];
+    for (int i = 0; i < continuationCount; i++) continuations[i] = job->continuations[i];
+
+    if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    for (int i = 0; i < continuationCount; i++)
+    {
+        if (continuations[i]->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) PushJob(system, continuations[i]);
+    }
+    if (parent) FinishJob(system, parent);
+}
+
+JOBAPI void ExecuteJob(JobSystem* system, Job* job)
+{
+    job->function(job, job->data);
+    FinishJob(system, job);
+}
+
+// Next job for a worker: its own deque first, then steal starting at a random victim
+JOBAPI Job* GetJob(JobSystem* system, JobWorker* worker)
+{
+    Job* job = PopJobQueue(&worker->queue);
+    if (job) return job;
+
+    int count = (int)system->workers.size();
+    worker->random ^= worker->random << 13;
+    worker->random ^= worker->random >> 17;
+    worker->random ^= worker->random << 5;
+    int start = (int)(worker->random % (uint32_t)count);
+
+    for (int i = 0; i < count; i++)
+    {
+        JobWorker* victim = system->workers[(start + i) % count];
+        if (victim == worker) continue;
+
+        job = StealJobQueue(&victim->queue);
+        if (job) return job;
+    }
+
+    return nullptr;
+}
+
+JOBAPI void JobWorkerMain(JobSystem* system, int index)
+{
+    JobWorkerIndex() = index;
+    JobWorker* worker = system->workers[index];
+
+    int idle = 0;
+    while (!system->stopping.load(std::memory_order_relaxed))
+    {
+        uint32_t epoch = system->epoch.load();
+        Job* job = GetJob(system, worker);
+        if (job)
+        {
+            ExecuteJob(system, job);
+            idle = 0;
+        }
+        else if (++idle < JOB_IDLE_SPINS) std::this_thread::yield();
+        else
+        {
+            // Sleep until something is pushed: pushers bump epoch before reading 'sleeping'
+            system->sleeping.fetch_add(1);
+            {
+                std::unique_lock<std::mutex> lock(system->sleepMutex);
+                system->wake.wait(lock, [&]() { return system->epoch.load() != epoch || system->stopping.load(); });
+            }
+            system->sleeping.fetch_sub(1);
+            idle = 0;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Job system
+//----------------------------------------------------------------------------------
+
+// Create a job system with workerCount workers (0: one per hardware thread), the calling thread is worker 0
+JOBAPI JobSystem* CreateJobSystem(int workerCount)
+{
+    if (workerCount <= 0) workerCount = (int)std::thread::hardware_concurrency();
+    if (workerCount <= 0) workerCount = 1;
+
+    JobSystem* system = new JobSystem();
+    system->stopping = false;
+    system->epoch = 0;
+    system->sleeping = 0;
+
+    for (int i = 0; i < workerCount; i++)
+    {
+        JobWorker* worker = new JobWorker();
+        worker->queue.top = 0;
+        worker->queue.bottom = 0;
+        worker->pool = new Job[JOB_POOL_SIZE]();     // Zeroed: every slot starts finished
+        worker->poolIndex = 0;
+        worker->random = 0x9e3779b9u*(uint32_t)(i + 1);
+        system->workers.push_back(worker);
+    }
+
+    JobWorkerIndex() = 0;
+    for (int i = 1; i < workerCount; i++) system->workers[i]->thread = std::thread(JobWorkerMain, system, i);
+
+    return system;
+}
+
+// Stop the workers and free the system, every job must be done
+JOBAPI void DestroyJobSystem(JobSystem* system)
+{
+    {
+        std::lock_guard<std::mutex> lock(system->sleepMutex);
+        system->stopping = true;
+    }
+    system->wake.notify_all();
+
+    // Join everyone before freeing: a stopping worker may still be stealing from the others
+    for (JobWorker* worker : system->workers)
+    {
+        if (worker->thread.joinable()) worker->thread.join();
+    }
+    for (JobWorker* worker : system->workers)
+    {
+        delete[] worker->pool;
+        delete worker;
+    }
+
+    JobWorkerIndex() = -1;
+    delete system;
+}
+
+JOBAPI int GetJobWorkerCount(const JobSystem* system)
+{
+    return (int)system->workers.size();
+}
+
+// Create a job that calls function(job, data) with a copy of 'size' bytes of data
+// NOTE: The job does not start before RunJob()
+JOBAPI Job* CreateJob(JobSystem* system, JobFunction function, const void* data, int size, Job* parent = nullptr)
+{
+    JobWorker* worker = CurrentJobWorker(system);
+    Job* job = &worker->pool[worker->poolIndex++ & (JOB_POOL_SIZE - 1)];
+    if (job->unfinished.load(std::memory_order_acquire) != 0)
+    {
+        fprintf(stderr, "JobSystem: more than %d jobs alive on one worker, the job ring wrapped onto a running job\n", JOB_POOL_SIZE);
+        abort();
+    }
+
+    job->function = function;
+    job->parent = parent;
+    job->unfinished.store(1, std::memory_order_relaxed);
+    job->dependencies.store(1, std::memory_order_relaxed);
+    job->continuationCount = 0;
+    if (size > 0) memcpy(job->data, data, size);
+
+    if (parent) parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+
+    return job;
+}
+
+// Create a job running a callable, its captures are copied into the job
+template <typename Fn>
+JOBAPI Job* CreateJob(JobSystem* system, const Fn& fn, Job* parent = nullptr)
+{
+    static_assert(sizeof(Fn) <= JOB_DATA_SIZE, "Job captures do not fit in JOB_DATA_SIZE, capture by reference");
+    static_assert(std::is_trivially_copyable<Fn>::value && std::is_trivially_destructible<Fn>::value, "Job captures must be trivially copyable");
+
+    return CreateJob(system, [](Job*, void* data) { (*(Fn*)data)(); }, &fn, (int)sizeof(Fn), parent);
+}
+
+// Hold 'job' back until 'ancestor' (and its children) are done
+// NOTE: Call before RunJob(ancestor), at most JOB_MAX_CONTINUATIONS dependents per ancestor
+JOBAPI void AddJobDependency(Job* ancestor, Job* job)
+{
+    if (ancestor->continuationCount >= JOB_MAX_CONTINUATIONS)
+    {
+        fprintf(stderr, "JobSystem: more than %d jobs depend on one job, add an intermediate job\n", JOB_MAX_CONTINUATIONS);
+        abort();
+    }
+
+    ancestor->continuations[ancestor->continuationCount++] = job;
+    job->dependencies.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Allow a job to start, it is queued now or when its last dependency is done
+JOBAPI void RunJob(JobSystem* system, Job* job)
+{
+    if (job->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) PushJob(system, job);
+}
+
+JOBAPI bool IsJobDone(const Job* job)
+{
+    return job->unfinished.load(std::memory_order_acquire) == 0;
+}
+
+// Run other jobs until 'job' and its children are done
+JOBAPI void WaitJob(JobSystem* system, const Job* job)
+{
+    JobWorker* worker = CurrentJobWorker(system);
+
+    while (!IsJobDone(job))
+    {
+        Job* next = GetJob(system, worker);
+        if (next) ExecuteJob(system, next);
+        else std::this_thread::yield();
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Parallel for
+//----------------------------------------------------------------------------------
+
+// Range of a ParallelFor piece, the callable stays on the caller's stack
+template <typename Fn>
+struct ParallelForData {
+    JobSystem* system;
+    const Fn* fn;
+    int begin;
+    int end;
+    int grain;
+};
+
+template <typename Fn>
+JOBAPI void ParallelForJob(Job* job, void* data)
+{
+    ParallelForData<Fn> range = *(ParallelForData<Fn>*)data;
+
+    // Give away the upper halves as children, keep splitting the lower one
+    while (range.end - range.begin > range.grain)
+    {
+        int mid = range.begin + (range.end - range.begin)/2;
+        ParallelForData<Fn> upper = { range.system, range.fn, mid, range.end, range.grain };
+        RunJob(range.system, CreateJob(range.system, ParallelForJob<Fn>, &upper, (int)sizeof(upper), job));
+        range.end = mid;
+    }
+
+    (*range.fn)(range.begin, range.end);
+}
+
+// Create a job calling fn(begin, end) over pieces of [0, count) of at most 'grain' indices
+// NOTE: The grain is raised so that there are at most JOB_POOL_SIZE/2 pieces, each piece holds
+// a slot of a worker's job ring until it is done
+// NOTE: fn must stay alive until the job is done
+template <typename Fn>
+JOBAPI Job* CreateParallelForJob(JobSystem* system, int count, int grain, const Fn* fn, Job* parent = nullptr)
+{
+    // Halving stops with pieces above grain/2, so at most 2*count/grain of them
+    int minGrain = (int)(((int64_t)count*4 + JOB_POOL_SIZE - 1)/JOB_POOL_SIZE);
+    if (grain < minGrain) grain = minGrain;
+    ParallelForData<Fn> range = { system, fn, 0, count, (grain < 1) ? 1 : grain };
+
+    return CreateJob(system, ParallelForJob<Fn>, &range, (int)sizeof(range), parent);
+}
+
+// Call fn(begin, end) over [0, count) on all workers and wait for the whole range
+template <typename Fn>
+JOBAPI void ParallelFor(JobSystem* system, int count, int grain, const Fn& fn)
+{
+    if (count <= grain || GetJobWorkerCount(system) == 1)
+    {
+        if (count > 0) fn(0, count);
+        return;
+    }
+
+    Job* job = CreateParallelForJob(system, count, grain, &fn);
+    RunJob(system, job);
+    WaitJob(system, job);
+}
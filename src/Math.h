@@ -1,6 +1,10 @@
 #pragma once
-#include <corecrt_math.h>
+#include <cmath>
 #include <cstdlib>
+#include "Simd.h"
+#include "FastMath.h"
+#include "Random.h"
+#include "Vec.h"
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -15,6 +19,17 @@
 #define EPSILON 0.000001f
 #endif
 
+// Functions without libm calls are constexpr, usable for compile-time tables and transforms
+// NOTE: The Matrix functions with an SSE path (RMAPI_SIMD) switch to the scalar reference during
+// constant evaluation, see MATH_IS_CONSTANT_EVALUATED() in Vec.h
+#if !MATH_SIMD_SSE || defined(MATH_HAS_CONSTANT_EVALUATED)
+#define MATH_CONSTEXPR_SIMD 1
+#define RMAPI_SIMD RMAPI constexpr
+#else
+#define MATH_CONSTEXPR_SIMD 0
+#define RMAPI_SIMD RMAPI
+#endif
+
 #ifndef DEG2RAD
 #define DEG2RAD (PI/180.0f)
 #endif
@@ -92,18 +107,32 @@ typedef struct float16 {
     float v[16]{};
 } float16;
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vec conversion
+//----------------------------------------------------------------------------------
+
+// NOTE: The raylib structs keep their layout, element-wise operations round trip through Vec.h
+// and the copies fold away once inlined
+RMAPI constexpr Vec2f ToVec(Vector2 v) { return Vec2f{ { v.x, v.y } }; }
+RMAPI constexpr Vec3f ToVec(Vector3 v) { return Vec3f{ { v.x, v.y, v.z } }; }
+RMAPI constexpr Vec4f ToVec(Vector4 v) { return Vec4f{ { v.x, v.y, v.z, v.w } }; }
+RMAPI constexpr Vector2 ToVector2(Vec2f v) { return Vector2{ v.v[0], v.v[1] }; }
+RMAPI constexpr Vector3 ToVector3(Vec3f v) { return Vector3{ v.v[0], v.v[1], v.v[2] }; }
+RMAPI constexpr Vector4 ToVector4(Vec4f v) { return Vector4{ v.v[0], v.v[1], v.v[2], v.v[3] }; }
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
 
 // Random value between min and max (can be negative)
+// NOTE: Draws from the calling thread's generator (Random.h), use SeedRandom() for repeatable sequences
 RMAPI float Random(float min, float max)
 {
-    return min + (rand() / ((float)RAND_MAX / (max - min)));
+    return RandomRange(GetThreadRandomState(), min, max);
 }
 
 // Clamp float value
-RMAPI float Clamp(float value, float min, float max)
+RMAPI constexpr float Clamp(float value, float min, float max)
 {
     float result = (value < min) ? min : value;
 
@@ -113,7 +142,7 @@ RMAPI float Clamp(float value, float min, float max)
 }
 
 // Calculate linear interpolation between two floats
-RMAPI float Lerp(float start, float end, float amount)
+RMAPI constexpr float Lerp(float start, float end, float amount)
 {
     float result = start + amount * (end - start);
 
@@ -121,7 +150,7 @@ RMAPI float Lerp(float start, float end, float amount)
 }
 
 // Normalize input value within input range
-RMAPI float Normalize(float value, float start, float end)
+RMAPI constexpr float Normalize(float value, float start, float end)
 {
     float result = (value - start) / (end - start);
 
@@ -129,7 +158,7 @@ RMAPI float Normalize(float value, float start, float end)
 }
 
 // Remap input value within input range to output range
-RMAPI float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
+RMAPI constexpr float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
 {
     float result = (value - inputStart) / (inputEnd - inputStart) * (outputEnd - outputStart) + outputStart;
 
@@ -152,8 +181,38 @@ RMAPI int Equals(float x, float y)
     return result;
 }
 
+// Trigonometry used by the angle based Vector2 helpers (Direction, Angle, Rotate...)
+// NOTE: Define MATH_FAST_TRIG to use the polynomial approximations of FastMath.h instead of the CRT
+RMAPI void TrigSinCos(float angle, float* outSin, float* outCos)
+{
+#if defined(MATH_FAST_TRIG)
+    FastSinCos(angle, outSin, outCos);
+#else
+    *outSin = sinf(angle);
+    *outCos = cosf(angle);
+#endif
+}
+
+RMAPI float TrigAtan2(float y, float x)
+{
+#if defined(MATH_FAST_TRIG)
+    return FastAtan2(y, x);
+#else
+    return atan2f(y, x);
+#endif
+}
+
+RMAPI float TrigAcos(float x)
+{
+#if defined(MATH_FAST_TRIG)
+    return FastAcos(x);
+#else
+    return acosf(x);
+#endif
+}
+
 // Vector with components value 0.0f
-RMAPI Vector2 Vector2Zero(void)
+RMAPI constexpr Vector2 Vector2Zero(void)
 {
     Vector2 result = { 0.0f, 0.0f };
 
@@ -161,21 +220,21 @@ RMAPI Vector2 Vector2Zero(void)
 }
 
 // Vector with components value 1.0f
-RMAPI Vector2 Vector2One(void)
+RMAPI constexpr Vector2 Vector2One(void)
 {
     Vector2 result = { 1.0f, 1.0f };
 
     return result;
 }
 
-RMAPI Vector3 ToV3(Vector2 v)
+RMAPI constexpr Vector3 ToV3(Vector2 v)
 {
     Vector3 result = { v.x, v.y, 0.0f };
 
     return result;
 }
 
-RMAPI Vector2 FromV3(Vector3 v)
+RMAPI constexpr Vector2 FromV3(Vector3 v)
 {
     Vector2 result = { v.x, v.y };
 
@@ -183,35 +242,27 @@ RMAPI Vector2 FromV3(Vector3 v)
 }
 
 // Add two vectors (v1 + v2)
-RMAPI Vector2 Add(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Add(Vector2 v1, Vector2 v2)
 {
-    Vector2 result = { v1.x + v2.x, v1.y + v2.y };
-
-    return result;
+    return ToVector2(Add(ToVec(v1), ToVec(v2)));
 }
 
 // Add vector and float value
-RMAPI Vector2 Add(Vector2 v, float add)
+RMAPI constexpr Vector2 Add(Vector2 v, float add)
 {
-    Vector2 result = { v.x + add, v.y + add };
-
-    return result;
+    return ToVector2(Add(ToVec(v), add));
 }
 
 // Subtract two vectors (v1 - v2)
-RMAPI Vector2 Subtract(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Subtract(Vector2 v1, Vector2 v2)
 {
-    Vector2 result = { v1.x - v2.x, v1.y - v2.y };
-
-    return result;
+    return ToVector2(Subtract(ToVec(v1), ToVec(v2)));
 }
 
 // Subtract vector by float value
-RMAPI Vector2 Subtract(Vector2 v, float sub)
+RMAPI constexpr Vector2 Subtract(Vector2 v, float sub)
 {
-    Vector2 result = { v.x - sub, v.y - sub };
-
-    return result;
+    return ToVector2(Subtract(ToVec(v), sub));
 }
 
 RMAPI float Length(Vector2 v)
@@ -222,22 +273,18 @@ RMAPI float Length(Vector2 v)
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(Vector2 v)
+RMAPI constexpr float LengthSqr(Vector2 v)
 {
-    float result = (v.x * v.x) + (v.y * v.y);
-
-    return result;
+    return LengthSqr(ToVec(v));
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Dot(Vector2 v1, Vector2 v2)
 {
-    float result = (v1.x * v2.x + v1.y * v2.y);
-
-    return result;
+    return Dot(ToVec(v1), ToVec(v2));
 }
 
-RMAPI float Cross(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Cross(Vector2 v1, Vector2 v2)
 {
     float result = v1.x * v2.y - v1.y * v2.x;
 
@@ -253,15 +300,13 @@ RMAPI float Distance(Vector2 v1, Vector2 v2)
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector2 v1, Vector2 v2)
+RMAPI constexpr float DistanceSqr(Vector2 v1, Vector2 v2)
 {
-    float result = ((v1.x - v2.x) * (v1.x - v2.x) + (v1.y - v2.y) * (v1.y - v2.y));
-
-    return result;
+    return DistanceSqr(ToVec(v1), ToVec(v2));
 }
 
 // -1 if below zero, +1 if above zero
-RMAPI float Sign(float value)
+RMAPI constexpr float Sign(float value)
 {
     float result = (value < 0.0f) ? -1.0f : 1.0f;
 
@@ -271,7 +316,9 @@ RMAPI float Sign(float value)
 // Convert angle to direction
 RMAPI Vector2 Direction(float angle)
 {
-    Vector2 result = { cosf(angle), sinf(angle) };
+    Vector2 result = { 0 };
+
+    TrigSinCos(angle, &result.y, &result.x);
 
     return result;
 }
@@ -279,7 +326,7 @@ RMAPI Vector2 Direction(float angle)
 // Convert direction to angle
 RMAPI float Angle(Vector2 v)
 {
-    float result = atan2f(v.y, v.x);
+    float result = TrigAtan2(v.y, v.x);
 
     return result;
 }
@@ -294,7 +341,7 @@ RMAPI float UnsignedAngle(Vector2 start, Vector2 end)
     float dotClamp = (dot < -1.0f) ? -1.0f : dot;    // Clamp
     if (dotClamp > 1.0f) dotClamp = 1.0f;
 
-    result = acosf(dotClamp);
+    result = TrigAcos(dotClamp);
 
     return result;
 }
@@ -308,22 +355,20 @@ RMAPI float SignedAngle(Vector2 from, Vector2 to)
 }
 
 // Scale vector (multiply by value)
-RMAPI Vector2 Scale(Vector2 v, float scale)
+RMAPI constexpr Vector2 Scale(Vector2 v, float scale)
 {
-    Vector2 result = { v.x * scale, v.y * scale };
-
-    return result;
+    return ToVector2(Scale(ToVec(v), scale));
 }
 
 // Project v1 onto v2
-RMAPI Vector2 Project(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Project(Vector2 v1, Vector2 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y };
 }
 
 // Projects point P onto line AB
-RMAPI Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
+RMAPI constexpr Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
 {
     Vector2 AB = Subtract(B, A);
     float t = Dot(Subtract(P, A), AB) / Dot(AB, AB);
@@ -331,27 +376,21 @@ RMAPI Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
 }
 
 // Multiply vector by vector
-RMAPI Vector2 Multiply(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Multiply(Vector2 v1, Vector2 v2)
 {
-    Vector2 result = { v1.x * v2.x, v1.y * v2.y };
-
-    return result;
+    return ToVector2(Multiply(ToVec(v1), ToVec(v2)));
 }
 
 // Negate vector
-RMAPI Vector2 Negate(Vector2 v)
+RMAPI constexpr Vector2 Negate(Vector2 v)
 {
-    Vector2 result = { -v.x, -v.y };
-
-    return result;
+    return ToVector2(Negate(ToVec(v)));
 }
 
 // Divide vector by vector
-RMAPI Vector2 Divide(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Divide(Vector2 v1, Vector2 v2)
 {
-    Vector2 result = { v1.x / v2.x, v1.y / v2.y };
-
-    return result;
+    return ToVector2(Divide(ToVec(v1), ToVec(v2)));
 }
 
 // Normalize provided vector
@@ -371,7 +410,7 @@ RMAPI Vector2 Normalize(Vector2 v)
 }
 
 // Transforms a Vector2 by a given Matrix
-RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
+RMAPI constexpr Vector2 Multiply(Vector2 v, Matrix mat)
 {
     Vector2 result = { 0 };
 
@@ -386,18 +425,13 @@ RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
+RMAPI constexpr Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
 {
-    Vector2 result = { 0 };
-
-    result.x = v1.x + amount * (v2.x - v1.x);
-    result.y = v1.y + amount * (v2.y - v1.y);
-
-    return result;
+    return ToVector2(Lerp(ToVec(v1), ToVec(v2), amount));
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector2 Reflect(Vector2 v, Vector2 normal)
+RMAPI constexpr Vector2 Reflect(Vector2 v, Vector2 normal)
 {
     Vector2 result = { 0 };
 
@@ -414,8 +448,8 @@ RMAPI Vector2 Rotate(Vector2 v, float angle)
 {
     Vector2 result = { 0 };
 
-    float cosres = cosf(angle);
-    float sinres = sinf(angle);
+    float cosres, sinres;
+    TrigSinCos(angle, &sinres, &cosres);
 
     result.x = v.x * cosres - v.y * sinres;
     result.y = v.x * sinres + v.y * cosres;
@@ -450,7 +484,7 @@ RMAPI Vector2 RotateTowards(Vector2 from, Vector2 to, float maxRadians)
 }
 
 // Invert the given vector
-RMAPI Vector2 Invert(Vector2 v)
+RMAPI constexpr Vector2 Invert(Vector2 v)
 {
     Vector2 result = { 1.0f / v.x, 1.0f / v.y };
 
@@ -510,7 +544,7 @@ RMAPI bool Equals(Vector2 p, Vector2 q)
 //----------------------------------------------------------------------------------
 
 // Vector with components value 0.0f
-RMAPI Vector3 Vector3Zero(void)
+RMAPI constexpr Vector3 Vector3Zero(void)
 {
     Vector3 result = { 0.0f, 0.0f, 0.0f };
 
@@ -518,7 +552,7 @@ RMAPI Vector3 Vector3Zero(void)
 }
 
 // Vector with components value 1.0f
-RMAPI Vector3 Vector3One(void)
+RMAPI constexpr Vector3 Vector3One(void)
 {
     Vector3 result = { 1.0f, 1.0f, 1.0f };
 
@@ -526,55 +560,43 @@ RMAPI Vector3 Vector3One(void)
 }
 
 // Add two vectors
-RMAPI Vector3 Add(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Add(Vector3 v1, Vector3 v2)
 {
-    Vector3 result = { v1.x + v2.x, v1.y + v2.y, v1.z + v2.z };
-
-    return result;
+    return ToVector3(Add(ToVec(v1), ToVec(v2)));
 }
 
 // Add vector and float value
-RMAPI Vector3 Add(Vector3 v, float add)
+RMAPI constexpr Vector3 Add(Vector3 v, float add)
 {
-    Vector3 result = { v.x + add, v.y + add, v.z + add };
-
-    return result;
+    return ToVector3(Add(ToVec(v), add));
 }
 
 // Subtract two vectors
-RMAPI Vector3 Subtract(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Subtract(Vector3 v1, Vector3 v2)
 {
-    Vector3 result = { v1.x - v2.x, v1.y - v2.y, v1.z - v2.z };
-
-    return result;
+    return ToVector3(Subtract(ToVec(v1), ToVec(v2)));
 }
 
 // Subtract vector by float value
-RMAPI Vector3 Subtract(Vector3 v, float sub)
+RMAPI constexpr Vector3 Subtract(Vector3 v, float sub)
 {
-    Vector3 result = { v.x - sub, v.y - sub, v.z - sub };
-
-    return result;
+    return ToVector3(Subtract(ToVec(v), sub));
 }
 
 // Multiply vector by scalar
-RMAPI Vector3 Scale(Vector3 v, float scalar)
+RMAPI constexpr Vector3 Scale(Vector3 v, float scalar)
 {
-    Vector3 result = { v.x * scalar, v.y * scalar, v.z * scalar };
-
-    return result;
+    return ToVector3(Scale(ToVec(v), scalar));
 }
 
 // Multiply vector by vector
-RMAPI Vector3 Multiply(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Multiply(Vector3 v1, Vector3 v2)
 {
-    Vector3 result = { v1.x * v2.x, v1.y * v2.y, v1.z * v2.z };
-
-    return result;
+    return ToVector3(Multiply(ToVec(v1), ToVec(v2)));
 }
 
 // Calculate two vectors cross product
-RMAPI Vector3 Cross(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Cross(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
 
@@ -619,19 +641,15 @@ RMAPI float Length(const Vector3 v)
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(const Vector3 v)
+RMAPI constexpr float LengthSqr(const Vector3 v)
 {
-    float result = v.x * v.x + v.y * v.y + v.z * v.z;
-
-    return result;
+    return LengthSqr(ToVec(v));
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector3 v1, Vector3 v2)
+RMAPI constexpr float Dot(Vector3 v1, Vector3 v2)
 {
-    float result = (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z);
-
-    return result;
+    return Dot(ToVec(v1), ToVec(v2));
 }
 
 // Calculate distance between two vectors
@@ -648,27 +666,20 @@ RMAPI float Distance(Vector3 v1, Vector3 v2)
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector3 v1, Vector3 v2)
+RMAPI constexpr float DistanceSqr(Vector3 v1, Vector3 v2)
 {
-    float result = 0.0f;
-
-    float dx = v2.x - v1.x;
-    float dy = v2.y - v1.y;
-    float dz = v2.z - v1.z;
-    result = dx * dx + dy * dy + dz * dz;
-
-    return result;
+    return DistanceSqr(ToVec(v1), ToVec(v2));
 }
 
 // Project v1 onto v2
-RMAPI Vector3 Project(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Project(Vector3 v1, Vector3 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y, t * v2.z };
 }
 
 // Returns the point on line AB nearest to point P
-RMAPI Vector3 ProjectPointLine(Vector3 A, Vector3 B, Vector3 P)
+RMAPI constexpr Vector3 ProjectPointLine(Vector3 A, Vector3 B, Vector3 P)
 {
     Vector3 AB = Subtract(B, A);
     float t = Dot(Subtract(P, A), AB) / Dot(AB, AB);
@@ -689,19 +700,15 @@ RMAPI float Angle(Vector3 v1, Vector3 v2)
 }
 
 // Negate provided vector (invert direction)
-RMAPI Vector3 Negate(Vector3 v)
+RMAPI constexpr Vector3 Negate(Vector3 v)
 {
-    Vector3 result = { -v.x, -v.y, -v.z };
-
-    return result;
+    return ToVector3(Negate(ToVec(v)));
 }
 
 // Divide vector by vector
-RMAPI Vector3 Divide(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Divide(Vector3 v1, Vector3 v2)
 {
-    Vector3 result = { v1.x / v2.x, v1.y / v2.y, v1.z / v2.z };
-
-    return result;
+    return ToVector3(Divide(ToVec(v1), ToVec(v2)));
 }
 
 // Normalize provided vector
@@ -756,7 +763,7 @@ RMAPI void OrthoNormalize(Vector3* v1, Vector3* v2)
 }
 
 // Transforms a Vector3 by a given Matrix
-RMAPI Vector3 Multiply(Vector3 v, Matrix mat)
+RMAPI constexpr Vector3 Multiply(Vector3 v, Matrix mat)
 {
     Vector3 result = { 0 };
 
@@ -772,7 +779,7 @@ RMAPI Vector3 Multiply(Vector3 v, Matrix mat)
 }
 
 // Transform a vector by quaternion rotation
-RMAPI Vector3 Rotate(Vector3 v, Quaternion q)
+RMAPI constexpr Vector3 Rotate(Vector3 v, Quaternion q)
 {
     Vector3 result = { 0 };
 
@@ -836,19 +843,13 @@ RMAPI Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
+RMAPI constexpr Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
 {
-    Vector3 result = { 0 };
-
-    result.x = v1.x + amount * (v2.x - v1.x);
-    result.y = v1.y + amount * (v2.y - v1.y);
-    result.z = v1.z + amount * (v2.z - v1.z);
-
-    return result;
+    return ToVector3(Lerp(ToVec(v1), ToVec(v2), amount));
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector3 Reflect(Vector3 v, Vector3 normal)
+RMAPI constexpr Vector3 Reflect(Vector3 v, Vector3 normal)
 {
     Vector3 result = { 0 };
 
@@ -891,7 +892,7 @@ RMAPI Vector3 Max(Vector3 v1, Vector3 v2)
 
 // Compute barycenter coordinates (u, v, w) for point p with respect to triangle (a, b, c)
 // NOTE: Assumes P is on the plane of the triangle
-RMAPI Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
+RMAPI constexpr Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
 {
     Vector3 result = { 0 };
 
@@ -915,7 +916,8 @@ RMAPI Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
 
 // Projects a Vector3 from screen space into object space
 // NOTE: We are avoiding calling other raymath functions despite available
-RMAPI Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
+// NOTE: Rebuilds and inverts view*projection on every call, use an Unprojector (Unprojector.h) for repeated calls
+RMAPI constexpr Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
 {
     Vector3 result = { 0 };
 
@@ -998,7 +1000,7 @@ RMAPI Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
 }
 
 // Get Vector3 as float array
-RMAPI float3 ToFloatV(Vector3 v)
+RMAPI constexpr float3 ToFloatV(Vector3 v)
 {
     float3 buffer = { 0 };
 
@@ -1010,7 +1012,7 @@ RMAPI float3 ToFloatV(Vector3 v)
 }
 
 // Invert the given vector
-RMAPI Vector3 Invert(Vector3 v)
+RMAPI constexpr Vector3 Invert(Vector3 v)
 {
     Vector3 result = { 1.0f / v.x, 1.0f / v.y, 1.0f / v.z };
 
@@ -1100,7 +1102,7 @@ RMAPI Vector3 Refract(Vector3 v, Vector3 n, float r)
 //----------------------------------------------------------------------------------
 
 // Compute matrix determinant
-RMAPI float Determinant(Matrix mat)
+RMAPI constexpr float Determinant(Matrix mat)
 {
     float result = 0.0f;
 
@@ -1121,7 +1123,7 @@ RMAPI float Determinant(Matrix mat)
 }
 
 // Get the trace of the matrix (sum of the values along the diagonal)
-RMAPI float Trace(Matrix mat)
+RMAPI constexpr float Trace(Matrix mat)
 {
     float result = (mat.m0 + mat.m5 + mat.m10 + mat.m15);
 
@@ -1129,7 +1131,7 @@ RMAPI float Trace(Matrix mat)
 }
 
 // Transposes provided matrix
-RMAPI Matrix Transpose(Matrix mat)
+RMAPI constexpr Matrix Transpose(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1153,8 +1155,8 @@ RMAPI Matrix Transpose(Matrix mat)
     return result;
 }
 
-// Invert provided matrix
-RMAPI Matrix Invert(Matrix mat)
+// Invert provided matrix (scalar reference implementation)
+RMAPI constexpr Matrix InvertScalar(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1200,8 +1202,97 @@ RMAPI Matrix Invert(Matrix mat)
     return result;
 }
 
+#if MATH_SIMD_SSE
+// 2x2 block helpers for the SSE inverse, each __m128 holds a row major 2x2 block (a b c d)
+#define MATH_SHUFFLE(v1, v2, x, y, z, w) _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x))
+#define MATH_SWIZZLE(v, x, y, z, w) MATH_SHUFFLE(v, v, x, y, z, w)
+
+// 2x2 matrix multiply A*B
+RMAPI __m128 Mat2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, MATH_SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(MATH_SWIZZLE(a, 1, 0, 3, 2), MATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+// 2x2 matrix adjugate multiply (A#)*B
+RMAPI __m128 Mat2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(MATH_SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(MATH_SWIZZLE(a, 1, 1, 2, 2), MATH_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+// 2x2 matrix multiply adjugate A*(B#)
+RMAPI __m128 Mat2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, MATH_SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(MATH_SWIZZLE(a, 1, 0, 3, 2), MATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+#endif
+
+// Invert provided matrix
+// NOTE: SSE path uses the 2x2 block (Schur complement) formulation, it matches InvertScalar() within float rounding
+RMAPI_SIMD Matrix Invert(Matrix mat)
+{
+#if MATH_SIMD_SSE
+    if (!MATH_IS_CONSTANT_EVALUATED())
+    {
+        const float* m = &mat.m0;
+        __m128 r0 = _mm_loadu_ps(m);
+        __m128 r1 = _mm_loadu_ps(m + 4);
+        __m128 r2 = _mm_loadu_ps(m + 8);
+        __m128 r3 = _mm_loadu_ps(m + 12);
+
+        // Split into 2x2 blocks | A B |
+        //                       | C D |
+        __m128 A = _mm_movelh_ps(r0, r1);
+        __m128 B = _mm_movehl_ps(r1, r0);
+        __m128 C = _mm_movelh_ps(r2, r3);
+        __m128 D = _mm_movehl_ps(r3, r2);
+
+        // Block determinants (|A| |B| |C| |D|)
+        __m128 detSub = _mm_sub_ps(
+            _mm_mul_ps(MATH_SHUFFLE(r0, r2, 0, 2, 0, 2), MATH_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+            _mm_mul_ps(MATH_SHUFFLE(r0, r2, 1, 3, 1, 3), MATH_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+        __m128 detA = MATH_SWIZZLE(detSub, 0, 0, 0, 0);
+        __m128 detB = MATH_SWIZZLE(detSub, 1, 1, 1, 1);
+        __m128 detC = MATH_SWIZZLE(detSub, 2, 2, 2, 2);
+        __m128 detD = MATH_SWIZZLE(detSub, 3, 3, 3, 3);
+
+        __m128 DC = Mat2AdjMul(D, C);
+        __m128 AB = Mat2AdjMul(A, B);
+
+        // Adjugate blocks of the inverse
+        __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, DC));
+        __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, AB));
+        __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, AB));
+        __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, DC));
+
+        // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+        __m128 tr = _mm_mul_ps(AB, MATH_SWIZZLE(DC, 0, 2, 1, 3));
+        tr = _mm_add_ps(tr, MATH_SWIZZLE(tr, 2, 3, 0, 1));
+        tr = _mm_add_ps(tr, MATH_SWIZZLE(tr, 1, 0, 3, 2));
+        __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+        __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+        X = _mm_mul_ps(X, invDet);
+        Y = _mm_mul_ps(Y, invDet);
+        Z = _mm_mul_ps(Z, invDet);
+        W = _mm_mul_ps(W, invDet);
+
+        // Apply the adjugate shuffle while storing the rows
+        Matrix result = { 0 };
+        float* out = &result.m0;
+        _mm_storeu_ps(out, MATH_SHUFFLE(X, Y, 3, 1, 3, 1));
+        _mm_storeu_ps(out + 4, MATH_SHUFFLE(X, Y, 2, 0, 2, 0));
+        _mm_storeu_ps(out + 8, MATH_SHUFFLE(Z, W, 3, 1, 3, 1));
+        _mm_storeu_ps(out + 12, MATH_SHUFFLE(Z, W, 2, 0, 2, 0));
+
+        return result;
+    }
+#endif
+
+    return InvertScalar(mat);
+}
+
 // Get identity matrix
-RMAPI Matrix MatrixIdentity(void)
+RMAPI constexpr Matrix MatrixIdentity(void)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -1212,7 +1303,7 @@ RMAPI Matrix MatrixIdentity(void)
 }
 
 // Add two matrices
-RMAPI Matrix Add(Matrix left, Matrix right)
+RMAPI constexpr Matrix Add(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1237,7 +1328,7 @@ RMAPI Matrix Add(Matrix left, Matrix right)
 }
 
 // Subtract two matrices (left - right)
-RMAPI Matrix Subtract(Matrix left, Matrix right)
+RMAPI constexpr Matrix Subtract(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1261,9 +1352,9 @@ RMAPI Matrix Subtract(Matrix left, Matrix right)
     return result;
 }
 
-// Get two matrix multiplication
+// Get two matrix multiplication (scalar reference implementation)
 // NOTE: When multiplying matrices... the order matters!
-RMAPI Matrix Multiply(Matrix left, Matrix right)
+RMAPI constexpr Matrix MultiplyScalar(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1287,8 +1378,44 @@ RMAPI Matrix Multiply(Matrix left, Matrix right)
     return result;
 }
 
+// Get two matrix multiplication
+// NOTE: When multiplying matrices... the order matters!
+// NOTE: Each stored row of the result is a linear combination of the stored rows of left,
+// weighted by the matching stored row of right, which maps directly onto SIMD lanes
+// NOTE: AVX builds get the VEX encoded form of this path, 256-bit (two rows at once) measured slower
+RMAPI_SIMD Matrix Multiply(Matrix left, Matrix right)
+{
+#if MATH_SIMD_SSE
+    if (!MATH_IS_CONSTANT_EVALUATED())
+    {
+        const float* l = &left.m0;
+        const float* r = &right.m0;
+        __m128 l0 = _mm_loadu_ps(l);
+        __m128 l1 = _mm_loadu_ps(l + 4);
+        __m128 l2 = _mm_loadu_ps(l + 8);
+        __m128 l3 = _mm_loadu_ps(l + 12);
+
+        Matrix result = { 0 };
+        float* out = &result.m0;
+        for (int i = 0; i < 16; i += 4)
+        {
+            __m128 w = _mm_loadu_ps(r + i);
+            __m128 row = _mm_mul_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 0, 0, 0)), l0);
+            row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 1, 1, 1)), l1));
+            row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 2, 2)), l2));
+            row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 3, 3)), l3));
+            _mm_storeu_ps(out + i, row);
+        }
+
+        return result;
+    }
+#endif
+
+    return MultiplyScalar(left, right);
+}
+
 // Get translation matrix
-RMAPI Matrix Translate(float x, float y, float z)
+RMAPI constexpr Matrix Translate(float x, float y, float z)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, x,
                       0.0f, 1.0f, 0.0f, y,
@@ -1472,7 +1599,7 @@ RMAPI Matrix RotateZYX(Vector3 angle)
 }
 
 // Get scaling matrix
-RMAPI Matrix Scale(float x, float y, float z)
+RMAPI constexpr Matrix Scale(float x, float y, float z)
 {
     Matrix result = { x, 0.0f, 0.0f, 0.0f,
                       0.0f, y, 0.0f, 0.0f,
@@ -1483,7 +1610,7 @@ RMAPI Matrix Scale(float x, float y, float z)
 }
 
 // Get perspective projection matrix
-RMAPI Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1542,7 +1669,7 @@ RMAPI Matrix Perspective(double fovy, double aspect, double near, double far)
 }
 
 // Get orthographic projection matrix
-RMAPI Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1626,7 +1753,7 @@ RMAPI Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
 }
 
 // Get float array of matrix data
-RMAPI float16 ToFloatV(Matrix mat)
+RMAPI constexpr float16 ToFloatV(Matrix mat)
 {
     float16 result = { 0 };
 
@@ -1655,39 +1782,31 @@ RMAPI float16 ToFloatV(Matrix mat)
 //----------------------------------------------------------------------------------
 
 // Add two quaternions
-RMAPI Quaternion Add(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Add(Quaternion q1, Quaternion q2)
 {
-    Quaternion result = { q1.x + q2.x, q1.y + q2.y, q1.z + q2.z, q1.w + q2.w };
-
-    return result;
+    return ToVector4(Add(ToVec(q1), ToVec(q2)));
 }
 
 // Add quaternion and float value
-RMAPI Quaternion Add(Quaternion q, float add)
+RMAPI constexpr Quaternion Add(Quaternion q, float add)
 {
-    Quaternion result = { q.x + add, q.y + add, q.z + add, q.w + add };
-
-    return result;
+    return ToVector4(Add(ToVec(q), add));
 }
 
 // Subtract two quaternions
-RMAPI Quaternion Subtract(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Subtract(Quaternion q1, Quaternion q2)
 {
-    Quaternion result = { q1.x - q2.x, q1.y - q2.y, q1.z - q2.z, q1.w - q2.w };
-
-    return result;
+    return ToVector4(Subtract(ToVec(q1), ToVec(q2)));
 }
 
 // Subtract quaternion and float value
-RMAPI Quaternion Subtract(Quaternion q, float sub)
+RMAPI constexpr Quaternion Subtract(Quaternion q, float sub)
 {
-    Quaternion result = { q.x - sub, q.y - sub, q.z - sub, q.w - sub };
-
-    return result;
+    return ToVector4(Subtract(ToVec(q), sub));
 }
 
 // Get identity quaternion
-RMAPI Quaternion QuaternionIdentity(void)
+RMAPI constexpr Quaternion QuaternionIdentity(void)
 {
     Quaternion result = { 0.0f, 0.0f, 0.0f, 1.0f };
 
@@ -1720,7 +1839,7 @@ RMAPI Quaternion Normalize(Quaternion q)
 }
 
 // Invert provided quaternion
-RMAPI Quaternion Invert(Quaternion q)
+RMAPI constexpr Quaternion Invert(Quaternion q)
 {
     Quaternion result = q;
 
@@ -1740,7 +1859,7 @@ RMAPI Quaternion Invert(Quaternion q)
 }
 
 // Calculate two quaternion multiplication
-RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Multiply(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { 0 };
 
@@ -1756,37 +1875,21 @@ RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
 }
 
 // Scale quaternion by float value
-RMAPI Quaternion Scale(Quaternion q, float mul)
+RMAPI constexpr Quaternion Scale(Quaternion q, float mul)
 {
-    Quaternion result = { 0 };
-
-    result.x = q.x * mul;
-    result.y = q.y * mul;
-    result.z = q.z * mul;
-    result.w = q.w * mul;
-
-    return result;
+    return ToVector4(Scale(ToVec(q), mul));
 }
 
 // Divide two quaternions
-RMAPI Quaternion Divide(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Divide(Quaternion q1, Quaternion q2)
 {
-    Quaternion result = { q1.x / q2.x, q1.y / q2.y, q1.z / q2.z, q1.w / q2.w };
-
-    return result;
+    return ToVector4(Divide(ToVec(q1), ToVec(q2)));
 }
 
 // Calculate linear interpolation between two quaternions
-RMAPI Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
+RMAPI constexpr Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
 {
-    Quaternion result = { 0 };
-
-    result.x = q1.x + amount * (q2.x - q1.x);
-    result.y = q1.y + amount * (q2.y - q1.y);
-    result.z = q1.z + amount * (q2.z - q1.z);
-    result.w = q1.w + amount * (q2.w - q1.w);
-
-    return result;
+    return ToVector4(Lerp(ToVec(q1), ToVec(q2), amount));
 }
 
 // Calculate slerp-optimized interpolation between two quaternions
@@ -1949,7 +2052,7 @@ RMAPI Quaternion FromMatrix(Matrix mat)
 }
 
 // Get a matrix for a given quaternion
-RMAPI Matrix ToMatrix(Quaternion q)
+RMAPI constexpr Matrix ToMatrix(Quaternion q)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -2111,7 +2214,7 @@ RMAPI Vector3 ToEuler(Quaternion q)
 }
 
 // Transform a quaternion given a transformation matrix
-RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
+RMAPI constexpr Quaternion Multiply(Quaternion q, Matrix mat)
 {
     Quaternion result = { 0 };
 
@@ -2142,137 +2245,198 @@ RMAPI int Equals(Quaternion p, Quaternion q)
 // Module Functions Definition - Global operator overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Vector2 operator+(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator+(const Vector2& a, const Vector2& b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator-(const Vector2& a, const Vector2& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator*(const Vector2& a, const Vector2& b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector2 operator/(const Vector2& a, const Vector2& b)
+RMAPI constexpr Vector2 operator/(const Vector2& a, const Vector2& b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector2 operator+(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator+(const Vector2& a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator-(const Vector2& a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator*(const Vector2& a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector3 operator+(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator+(const Vector3& a, const Vector3& b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator-(const Vector3& a, const Vector3& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator*(const Vector3& a, const Vector3& b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector3 operator/(const Vector3& a, const Vector3& b)
+RMAPI constexpr Vector3 operator/(const Vector3& a, const Vector3& b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector3 operator+(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator+(const Vector3& a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator-(const Vector3& a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator*(const Vector3& a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector3 operator/(const Vector3& a, float b)
+RMAPI constexpr Vector3 operator/(const Vector3& a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector4 operator+(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator+(const Vector4& a, const Vector4& b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator-(const Vector4& a, const Vector4& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator*(const Vector4& a, const Vector4& b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector4 operator/(const Vector4& a, const Vector4& b)
+RMAPI constexpr Vector4 operator/(const Vector4& a, const Vector4& b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector4 operator+(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator+(const Vector4& a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator-(const Vector4& a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator*(const Vector4& a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector4 operator/(const Vector4& a, float b)
+RMAPI constexpr Vector4 operator/(const Vector4& a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector2 operator/(const Vector2& a, float b)
+RMAPI constexpr Vector2 operator/(const Vector2& a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Matrix operator+(const Matrix& a, const Matrix& b)
+RMAPI constexpr Matrix operator+(const Matrix& a, const Matrix& b)
 {
     return Add(a, b);
 }
 
-RMAPI Matrix operator-(const Matrix& a, const Matrix& b)
+RMAPI constexpr Matrix operator-(const Matrix& a, const Matrix& b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Matrix operator*(const Matrix& a, const Matrix& b)
+RMAPI_SIMD Matrix operator*(const Matrix& a, const Matrix& b)
 {
     return Multiply(a, b);
 }
+
+//----------------------------------------------------------------------------------
+// Compile-time checks of the constexpr functions
+// NOTE: Inputs are small integers and powers of two so every result is exact in float
+//----------------------------------------------------------------------------------
+namespace MathConstexprChecks {
+
+constexpr bool Same(Vector2 a, Vector2 b) { return (a.x == b.x) && (a.y == b.y); }
+constexpr bool Same(Vector3 a, Vector3 b) { return (a.x == b.x) && (a.y == b.y) && (a.z == b.z); }
+constexpr bool Same(Vector4 a, Vector4 b) { return (a.x == b.x) && (a.y == b.y) && (a.z == b.z) && (a.w == b.w); }
+constexpr bool Same(Matrix a, Matrix b)
+{
+    return Same(Vector4{ a.m0, a.m4, a.m8, a.m12 }, Vector4{ b.m0, b.m4, b.m8, b.m12 }) &&
+        Same(Vector4{ a.m1, a.m5, a.m9, a.m13 }, Vector4{ b.m1, b.m5, b.m9, b.m13 }) &&
+        Same(Vector4{ a.m2, a.m6, a.m10, a.m14 }, Vector4{ b.m2, b.m6, b.m10, b.m14 }) &&
+        Same(Vector4{ a.m3, a.m7, a.m11, a.m15 }, Vector4{ b.m3, b.m7, b.m11, b.m15 });
+}
+
+// Utils
+static_assert(Clamp(3.0f, 0.0f, 1.0f) == 1.0f, "Clamp");
+static_assert(Lerp(2.0f, 4.0f, 0.5f) == 3.0f, "Lerp");
+static_assert(Remap(5.0f, 0.0f, 10.0f, 0.0f, 2.0f) == 1.0f, "Remap");
+static_assert(Sign(-2.0f) == -1.0f, "Sign");
+
+// Vector2
+static_assert(Same(Vector2{ 1.0f, 2.0f } + Vector2{ 3.0f, 4.0f } * 2.0f, Vector2{ 7.0f, 10.0f }), "Vector2 operators");
+static_assert(Dot(Vector2{ 1.0f, 2.0f }, Vector2{ 3.0f, 4.0f }) == 11.0f, "Vector2 Dot");
+static_assert(Cross(Vector2{ 1.0f, 0.0f }, Vector2{ 0.0f, 1.0f }) == 1.0f, "Vector2 Cross");
+static_assert(Same(ProjectPointLine(Vector2{ 0.0f, 0.0f }, Vector2{ 4.0f, 0.0f }, Vector2{ 8.0f, 3.0f }), Vector2{ 4.0f, 0.0f }), "Vector2 ProjectPointLine");
+static_assert(Same(Reflect(Vector2{ 1.0f, -1.0f }, Vector2{ 0.0f, 1.0f }), Vector2{ 1.0f, 1.0f }), "Vector2 Reflect");
+
+// Vector3
+static_assert(Same(Cross(Vector3{ 1.0f, 0.0f, 0.0f }, Vector3{ 0.0f, 1.0f, 0.0f }), Vector3{ 0.0f, 0.0f, 1.0f }), "Vector3 Cross");
+static_assert(Same(Lerp(Vector3{ 0.0f, 2.0f, 4.0f }, Vector3{ 2.0f, 4.0f, 8.0f }, 0.5f), Vector3{ 1.0f, 3.0f, 6.0f }), "Vector3 Lerp");
+static_assert(Same((Vector3{ 2.0f, 4.0f, 8.0f } - 1.0f) / 2.0f, Vector3{ 0.5f, 1.5f, 3.5f }), "Vector3 operators");
+static_assert(Same(Barycenter(Vector3{ 1.0f, 1.0f, 0.0f }, Vector3{ 0.0f, 0.0f, 0.0f }, Vector3{ 2.0f, 0.0f, 0.0f }, Vector3{ 0.0f, 2.0f, 0.0f }), Vector3{ 0.0f, 0.5f, 0.5f }), "Vector3 Barycenter");
+
+// Vec, integer and double instantiations and the SSE backed 4-wide float
+static_assert(Add(Vec2i{ { 3, 4 } }, 1) == Vec2i{ { 4, 5 } }, "Vec2i Add");
+static_assert(Add(Vec2s{ { 32767, 0 } }, Vec2s{ { 1, 0 } }) == Vec2s{ { -32768, 0 } }, "Vec2s wraps");
+static_assert(Lerp(Vec3d{ { 0.0, 2.0, 4.0 } }, Vec3d{ { 2.0, 4.0, 8.0 } }, 0.5) == Vec3d{ { 1.0, 3.0, 6.0 } }, "Vec3d Lerp");
+static_assert(Same(Lerp(Vector4{ 0.0f, 2.0f, 4.0f, 6.0f }, Vector4{ 2.0f, 4.0f, 8.0f, 6.0f }, 0.5f), Vector4{ 1.0f, 3.0f, 6.0f, 6.0f }), "Vector4 Lerp");
+static_assert(Min(Vec4f{ { 1.0f, 5.0f, -2.0f, 0.0f } }, Vec4f{ { 2.0f, 4.0f, -3.0f, 0.0f } }) == Vec4f{ { 1.0f, 4.0f, -3.0f, 0.0f } }, "Vec4f Min");
+
+// Matrix, including the functions with an SSE path
+static_assert(Same(Multiply(Vector3{ 1.0f, 2.0f, 3.0f }, MultiplyScalar(Scale(2.0f, 2.0f, 2.0f), Translate(1.0f, 0.0f, -1.0f))), Vector3{ 3.0f, 4.0f, 5.0f }), "Matrix transform");
+static_assert(Same(Transpose(Transpose(Translate(1.0f, 2.0f, 3.0f))), Translate(1.0f, 2.0f, 3.0f)), "Matrix Transpose");
+static_assert(Same(InvertScalar(Scale(2.0f, 4.0f, 0.5f)), Scale(0.5f, 0.25f, 2.0f)), "Matrix InvertScalar");
+static_assert(Determinant(Scale(2.0f, 4.0f, 0.5f)) == 4.0f, "Matrix Determinant");
+#if MATH_CONSTEXPR_SIMD
+static_assert(Same(Translate(1.0f, 2.0f, 3.0f) * Translate(-1.0f, -2.0f, -3.0f), MatrixIdentity()), "Matrix operator*");
+static_assert(Same(Invert(Translate(1.0f, 2.0f, 3.0f)), Translate(-1.0f, -2.0f, -3.0f)), "Matrix Invert");
+#endif
+
+// Quaternion (half turn around z)
+static_assert(Same(Multiply(QuaternionIdentity(), Vector4{ 1.0f, 2.0f, 3.0f, 4.0f }), Vector4{ 1.0f, 2.0f, 3.0f, 4.0f }), "Quaternion Multiply");
+static_assert(Same(Rotate(Vector3{ 1.0f, 0.0f, 0.0f }, Quaternion{ 0.0f, 0.0f, 1.0f, 0.0f }), Vector3{ -1.0f, 0.0f, 0.0f }), "Vector3 Rotate by Quaternion");
+static_assert(Same(ToMatrix(Quaternion{ 0.0f, 0.0f, 1.0f, 0.0f }), Scale(-1.0f, -1.0f, 1.0f)), "Quaternion ToMatrix");
+static_assert(Same(Invert(Quaternion{ 0.0f, 0.0f, 1.0f, 0.0f }), Quaternion{ 0.0f, 0.0f, -1.0f, 0.0f }), "Quaternion Invert");
+
+}
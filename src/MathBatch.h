@@ -0,0 +1,1207 @@
+#pragma once
+#include "Math.h"
+#include "Simd.h"
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Batch kernels over SoA (structure of arrays) data
+//
+// Every function processes 'count' elements stored in separate x[] / y[] arrays
+// and matches the scalar Math.h function of the same name within EPSILON
+// Output arrays may alias the input arrays (in-place update is allowed)
+// No alignment is required, but 32-byte aligned arrays are faster
+// NOTE: Kernels avoid FMA on purpose so every path rounds like the scalar code
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Scalar kernels
+//----------------------------------------------------------------------------------
+
+RMAPI void AddBatchScalar(const float* x1, const float* y1, const float* x2, const float* y2, float* outX, float* outY, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        outX[i] = x1[i] + x2[i];
+        outY[i] = y1[i] + y2[i];
+    }
+}
+
+RMAPI void ScaleBatchScalar(const float* x, const float* y, float scale, float* outX, float* outY, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        outX[i] = x[i] * scale;
+        outY[i] = y[i] * scale;
+    }
+}
+
+RMAPI void NormalizeBatchScalar(const float* x, const float* y, float* outX, float* outY, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 result = Normalize(Vector2{ x[i], y[i] });
+        outX[i] = result.x;
+        outY[i] = result.y;
+    }
+}
+
+RMAPI void LerpBatchScalar(const float* x1, const float* y1, const float* x2, const float* y2, float amount, float* outX, float* outY, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        outX[i] = x1[i] + amount * (x2[i] - x1[i]);
+        outY[i] = y1[i] + amount * (y2[i] - y1[i]);
+    }
+}
+
+RMAPI void MoveTowardsBatchScalar(const float* x, const float* y, const float* targetX, const float* targetY, float maxDistance, float* outX, float* outY, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 result = MoveTowards(Vector2{ x[i], y[i] }, Vector2{ targetX[i], targetY[i] }, maxDistance);
+        outX[i] = result.x;
+        outY[i] = result.y;
+    }
+}
+
+RMAPI void ClampBatchScalar(const float* x, const float* y, Vector2 min, Vector2 max, float* outX, float* outY, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        outX[i] = fminf(max.x, fmaxf(min.x, x[i]));
+        outY[i] = fminf(max.y, fmaxf(min.y, y[i]));
+    }
+}
+
+RMAPI void ClampBatchScalar(const float* x, const float* y, float min, float max, float* outX, float* outY, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 result = Clamp(Vector2{ x[i], y[i] }, min, max);
+        outX[i] = result.x;
+        outY[i] = result.y;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - SSE kernels (4 elements per iteration)
+//----------------------------------------------------------------------------------
+#if SIMD_SSE
+
+RMAPI void AddBatchSSE(const float* x1, const float* y1, const float* x2, const float* y2, float* outX, float* outY, int count)
+{
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(outX + i, _mm_add_ps(_mm_loadu_ps(x1 + i), _mm_loadu_ps(x2 + i)));
+        _mm_storeu_ps(outY + i, _mm_add_ps(_mm_loadu_ps(y1 + i), _mm_loadu_ps(y2 + i)));
+    }
+    AddBatchScalar(x1 + i, y1 + i, x2 + i, y2 + i, outX + i, outY + i, count - i);
+}
+
+RMAPI void ScaleBatchSSE(const float* x, const float* y, float scale, float* outX, float* outY, int count)
+{
+    __m128 s = _mm_set1_ps(scale);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(outX + i, _mm_mul_ps(_mm_loadu_ps(x + i), s));
+        _mm_storeu_ps(outY + i, _mm_mul_ps(_mm_loadu_ps(y + i), s));
+    }
+    ScaleBatchScalar(x + i, y + i, scale, outX + i, outY + i, count - i);
+}
+
+RMAPI void NormalizeBatchSSE(const float* x, const float* y, float* outX, float* outY, int count)
+{
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+
+        // Zero-length vectors stay zero, as in Normalize(Vector2)
+        __m128 valid = _mm_cmpgt_ps(length, zero);
+        __m128 ilength = _mm_and_ps(valid, _mm_div_ps(one, length));
+
+        _mm_storeu_ps(outX + i, _mm_mul_ps(vx, ilength));
+        _mm_storeu_ps(outY + i, _mm_mul_ps(vy, ilength));
+    }
+    NormalizeBatchScalar(x + i, y + i, outX + i, outY + i, count - i);
+}
+
+RMAPI void LerpBatchSSE(const float* x1, const float* y1, const float* x2, const float* y2, float amount, float* outX, float* outY, int count)
+{
+    __m128 t = _mm_set1_ps(amount);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 ax = _mm_loadu_ps(x1 + i);
+        __m128 ay = _mm_loadu_ps(y1 + i);
+        _mm_storeu_ps(outX + i, _mm_add_ps(ax, _mm_mul_ps(t, _mm_sub_ps(_mm_loadu_ps(x2 + i), ax))));
+        _mm_storeu_ps(outY + i, _mm_add_ps(ay, _mm_mul_ps(t, _mm_sub_ps(_mm_loadu_ps(y2 + i), ay))));
+    }
+    LerpBatchScalar(x1 + i, y1 + i, x2 + i, y2 + i, amount, outX + i, outY + i, count - i);
+}
+
+RMAPI void MoveTowardsBatchSSE(const float* x, const float* y, const float* targetX, const float* targetY, float maxDistance, float* outX, float* outY, int count)
+{
+    __m128 maxDist = _mm_set1_ps(maxDistance);
+    __m128 maxDistSqr = _mm_set1_ps(maxDistance * maxDistance);
+    __m128 zero = _mm_setzero_ps();
+    __m128 allowSnap = (maxDistance >= 0.0f) ? _mm_castsi128_ps(_mm_set1_epi32(-1)) : zero;
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 tx = _mm_loadu_ps(targetX + i);
+        __m128 ty = _mm_loadu_ps(targetY + i);
+
+        __m128 dx = _mm_sub_ps(tx, vx);
+        __m128 dy = _mm_sub_ps(ty, vy);
+        __m128 value = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 dist = _mm_sqrt_ps(value);
+
+        __m128 rx = _mm_add_ps(vx, _mm_mul_ps(_mm_div_ps(dx, dist), maxDist));
+        __m128 ry = _mm_add_ps(vy, _mm_mul_ps(_mm_div_ps(dy, dist), maxDist));
+
+        // Lanes already at the target, or within reach, snap to the target
+        __m128 snap = _mm_or_ps(_mm_cmpeq_ps(value, zero), _mm_and_ps(allowSnap, _mm_cmple_ps(value, maxDistSqr)));
+
+        _mm_storeu_ps(outX + i, _mm_or_ps(_mm_and_ps(snap, tx), _mm_andnot_ps(snap, rx)));
+        _mm_storeu_ps(outY + i, _mm_or_ps(_mm_and_ps(snap, ty), _mm_andnot_ps(snap, ry)));
+    }
+    MoveTowardsBatchScalar(x + i, y + i, targetX + i, targetY + i, maxDistance, outX + i, outY + i, count - i);
+}
+
+RMAPI void ClampBatchSSE(const float* x, const float* y, Vector2 min, Vector2 max, float* outX, float* outY, int count)
+{
+    __m128 minX = _mm_set1_ps(min.x);
+    __m128 minY = _mm_set1_ps(min.y);
+    __m128 maxX = _mm_set1_ps(max.x);
+    __m128 maxY = _mm_set1_ps(max.y);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(outX + i, _mm_min_ps(maxX, _mm_max_ps(minX, _mm_loadu_ps(x + i))));
+        _mm_storeu_ps(outY + i, _mm_min_ps(maxY, _mm_max_ps(minY, _mm_loadu_ps(y + i))));
+    }
+    ClampBatchScalar(x + i, y + i, min, max, outX + i, outY + i, count - i);
+}
+
+RMAPI void ClampBatchSSE(const float* x, const float* y, float min, float max, float* outX, float* outY, int count)
+{
+    __m128 vmin = _mm_set1_ps(min);
+    __m128 vmax = _mm_set1_ps(max);
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 lengthSqr = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+        __m128 length = _mm_sqrt_ps(lengthSqr);
+
+        __m128 below = _mm_cmplt_ps(length, vmin);
+        __m128 above = _mm_andnot_ps(below, _mm_cmpgt_ps(length, vmax));
+        __m128 limit = _mm_or_ps(_mm_and_ps(below, vmin), _mm_and_ps(above, vmax));
+        __m128 scale = _mm_div_ps(limit, length);
+
+        // Keep the input where the length is in range or the vector is zero
+        __m128 apply = _mm_and_ps(_mm_or_ps(below, above), _mm_cmpgt_ps(lengthSqr, zero));
+        scale = _mm_or_ps(_mm_and_ps(apply, scale), _mm_andnot_ps(apply, one));
+
+        _mm_storeu_ps(outX + i, _mm_mul_ps(vx, scale));
+        _mm_storeu_ps(outY + i, _mm_mul_ps(vy, scale));
+    }
+    ClampBatchScalar(x + i, y + i, min, max, outX + i, outY + i, count - i);
+}
+
+#endif // SIMD_SSE
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - AVX2 kernels (8 elements per iteration)
+//----------------------------------------------------------------------------------
+#if SIMD_X86
+
+SIMD_TARGET_AVX2 RMAPI void AddBatchAVX2(const float* x1, const float* y1, const float* x2, const float* y2, float* outX, float* outY, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(outX + i, _mm256_add_ps(_mm256_loadu_ps(x1 + i), _mm256_loadu_ps(x2 + i)));
+        _mm256_storeu_ps(outY + i, _mm256_add_ps(_mm256_loadu_ps(y1 + i), _mm256_loadu_ps(y2 + i)));
+    }
+    AddBatchScalar(x1 + i, y1 + i, x2 + i, y2 + i, outX + i, outY + i, count - i);
+}
+
+SIMD_TARGET_AVX2 RMAPI void ScaleBatchAVX2(const float* x, const float* y, float scale, float* outX, float* outY, int count)
+{
+    __m256 s = _mm256_set1_ps(scale);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(outX + i, _mm256_mul_ps(_mm256_loadu_ps(x + i), s));
+        _mm256_storeu_ps(outY + i, _mm256_mul_ps(_mm256_loadu_ps(y + i), s));
+    }
+    ScaleBatchScalar(x + i, y + i, scale, outX + i, outY + i, count - i);
+}
+
+SIMD_TARGET_AVX2 RMAPI void NormalizeBatchAVX2(const float* x, const float* y, float* outX, float* outY, int count)
+{
+    __m256 zero = _mm256_setzero_ps();
+    __m256 one = _mm256_set1_ps(1.0f);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)));
+
+        __m256 valid = _mm256_cmp_ps(length, zero, _CMP_GT_OQ);
+        __m256 ilength = _mm256_and_ps(valid, _mm256_div_ps(one, length));
+
+        _mm256_storeu_ps(outX + i, _mm256_mul_ps(vx, ilength));
+        _mm256_storeu_ps(outY + i, _mm256_mul_ps(vy, ilength));
+    }
+    NormalizeBatchScalar(x + i, y + i, outX + i, outY + i, count - i);
+}
+
+SIMD_TARGET_AVX2 RMAPI void LerpBatchAVX2(const float* x1, const float* y1, const float* x2, const float* y2, float amount, float* outX, float* outY, int count)
+{
+    __m256 t = _mm256_set1_ps(amount);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 ax = _mm256_loadu_ps(x1 + i);
+        __m256 ay = _mm256_loadu_ps(y1 + i);
+        _mm256_storeu_ps(outX + i, _mm256_add_ps(ax, _mm256_mul_ps(t, _mm256_sub_ps(_mm256_loadu_ps(x2 + i), ax))));
+        _mm256_storeu_ps(outY + i, _mm256_add_ps(ay, _mm256_mul_ps(t, _mm256_sub_ps(_mm256_loadu_ps(y2 + i), ay))));
+    }
+    LerpBatchScalar(x1 + i, y1 + i, x2 + i, y2 + i, amount, outX + i, outY + i, count - i);
+}
+
+SIMD_TARGET_AVX2 RMAPI void MoveTowardsBatchAVX2(const float* x, const float* y, const float* targetX, const float* targetY, float maxDistance, float* outX, float* outY, int count)
+{
+    __m256 maxDist = _mm256_set1_ps(maxDistance);
+    __m256 maxDistSqr = _mm256_set1_ps(maxDistance * maxDistance);
+    __m256 zero = _mm256_setzero_ps();
+    __m256 allowSnap = (maxDistance >= 0.0f) ? _mm256_castsi256_ps(_mm256_set1_epi32(-1)) : zero;
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 tx = _mm256_loadu_ps(targetX + i);
+        __m256 ty = _mm256_loadu_ps(targetY + i);
+
+        __m256 dx = _mm256_sub_ps(tx, vx);
+        __m256 dy = _mm256_sub_ps(ty, vy);
+        __m256 value = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        __m256 dist = _mm256_sqrt_ps(value);
+
+        __m256 rx = _mm256_add_ps(vx, _mm256_mul_ps(_mm256_div_ps(dx, dist), maxDist));
+        __m256 ry = _mm256_add_ps(vy, _mm256_mul_ps(_mm256_div_ps(dy, dist), maxDist));
+
+        __m256 snap = _mm256_or_ps(_mm256_cmp_ps(value, zero, _CMP_EQ_OQ),
+            _mm256_and_ps(allowSnap, _mm256_cmp_ps(value, maxDistSqr, _CMP_LE_OQ)));
+
+        _mm256_storeu_ps(outX + i, _mm256_blendv_ps(rx, tx, snap));
+        _mm256_storeu_ps(outY + i, _mm256_blendv_ps(ry, ty, snap));
+    }
+    MoveTowardsBatchScalar(x + i, y + i, targetX + i, targetY + i, maxDistance, outX + i, outY + i, count - i);
+}
+
+SIMD_TARGET_AVX2 RMAPI void ClampBatchAVX2(const float* x, const float* y, Vector2 min, Vector2 max, float* outX, float* outY, int count)
+{
+    __m256 minX = _mm256_set1_ps(min.x);
+    __m256 minY = _mm256_set1_ps(min.y);
+    __m256 maxX = _mm256_set1_ps(max.x);
+    __m256 maxY = _mm256_set1_ps(max.y);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(outX + i, _mm256_min_ps(maxX, _mm256_max_ps(minX, _mm256_loadu_ps(x + i))));
+        _mm256_storeu_ps(outY + i, _mm256_min_ps(maxY, _mm256_max_ps(minY, _mm256_loadu_ps(y + i))));
+    }
+    ClampBatchScalar(x + i, y + i, min, max, outX + i, outY + i, count - i);
+}
+
+SIMD_TARGET_AVX2 RMAPI void ClampBatchAVX2(const float* x, const float* y, float min, float max, float* outX, float* outY, int count)
+{
+    __m256 vmin = _mm256_set1_ps(min);
+    __m256 vmax = _mm256_set1_ps(max);
+    __m256 zero = _mm256_setzero_ps();
+    __m256 one = _mm256_set1_ps(1.0f);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 lengthSqr = _mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy));
+        __m256 length = _mm256_sqrt_ps(lengthSqr);
+
+        __m256 below = _mm256_cmp_ps(length, vmin, _CMP_LT_OQ);
+        __m256 above = _mm256_andnot_ps(below, _mm256_cmp_ps(length, vmax, _CMP_GT_OQ));
+        __m256 limit = _mm256_blendv_ps(vmax, vmin, below);
+        __m256 scale = _mm256_div_ps(limit, length);
+
+        __m256 apply = _mm256_and_ps(_mm256_or_ps(below, above), _mm256_cmp_ps(lengthSqr, zero, _CMP_GT_OQ));
+        scale = _mm256_blendv_ps(one, scale, apply);
+
+        _mm256_storeu_ps(outX + i, _mm256_mul_ps(vx, scale));
+        _mm256_storeu_ps(outY + i, _mm256_mul_ps(vy, scale));
+    }
+    ClampBatchScalar(x + i, y + i, min, max, outX + i, outY + i, count - i);
+}
+
+#endif // SIMD_X86
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Dispatch (uses GetSimdLevel())
+//----------------------------------------------------------------------------------
+
+// Add two arrays of vectors (v1[i] + v2[i])
+RMAPI void AddBatch(const float* x1, const float* y1, const float* x2, const float* y2, float* outX, float* outY, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { AddBatchAVX2(x1, y1, x2, y2, outX, outY, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { AddBatchSSE(x1, y1, x2, y2, outX, outY, count); return; }
+#endif
+    AddBatchScalar(x1, y1, x2, y2, outX, outY, count);
+}
+
+// Scale an array of vectors (v[i] * scale)
+RMAPI void ScaleBatch(const float* x, const float* y, float scale, float* outX, float* outY, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { ScaleBatchAVX2(x, y, scale, outX, outY, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { ScaleBatchSSE(x, y, scale, outX, outY, count); return; }
+#endif
+    ScaleBatchScalar(x, y, scale, outX, outY, count);
+}
+
+// Normalize an array of vectors, zero vectors stay zero
+RMAPI void NormalizeBatch(const float* x, const float* y, float* outX, float* outY, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { NormalizeBatchAVX2(x, y, outX, outY, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { NormalizeBatchSSE(x, y, outX, outY, count); return; }
+#endif
+    NormalizeBatchScalar(x, y, outX, outY, count);
+}
+
+// Linear interpolation between two arrays of vectors with a uniform amount
+RMAPI void LerpBatch(const float* x1, const float* y1, const float* x2, const float* y2, float amount, float* outX, float* outY, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { LerpBatchAVX2(x1, y1, x2, y2, amount, outX, outY, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { LerpBatchSSE(x1, y1, x2, y2, amount, outX, outY, count); return; }
+#endif
+    LerpBatchScalar(x1, y1, x2, y2, amount, outX, outY, count);
+}
+
+// Move an array of vectors towards their targets by at most maxDistance
+RMAPI void MoveTowardsBatch(const float* x, const float* y, const float* targetX, const float* targetY, float maxDistance, float* outX, float* outY, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { MoveTowardsBatchAVX2(x, y, targetX, targetY, maxDistance, outX, outY, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { MoveTowardsBatchSSE(x, y, targetX, targetY, maxDistance, outX, outY, count); return; }
+#endif
+    MoveTowardsBatchScalar(x, y, targetX, targetY, maxDistance, outX, outY, count);
+}
+
+// Clamp the components of an array of vectors between min and max
+RMAPI void ClampBatch(const float* x, const float* y, Vector2 min, Vector2 max, float* outX, float* outY, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { ClampBatchAVX2(x, y, min, max, outX, outY, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { ClampBatchSSE(x, y, min, max, outX, outY, count); return; }
+#endif
+    ClampBatchScalar(x, y, min, max, outX, outY, count);
+}
+
+// Clamp the magnitude of an array of vectors between min and max
+RMAPI void ClampBatch(const float* x, const float* y, float min, float max, float* outX, float* outY, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { ClampBatchAVX2(x, y, min, max, outX, outY, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { ClampBatchSSE(x, y, min, max, outX, outY, count); return; }
+#endif
+    ClampBatchScalar(x, y, min, max, outX, outY, count);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector3 transform kernels
+//
+// Points are transformed as (x, y, z, 1), directions as (x, y, z, 0)
+// AoS kernels work on Vector3 arrays, SoA kernels on separate x[] / y[] / z[] arrays
+// Results match Multiply(Vector3, Matrix) exactly (same operation order, no FMA)
+//----------------------------------------------------------------------------------
+
+RMAPI void TransformBatchScalar(const Vector3* in, Vector3* out, int count, Matrix mat, float w)
+{
+    float tx = mat.m12 * w, ty = mat.m13 * w, tz = mat.m14 * w;
+
+    for (int i = 0; i < count; i++)
+    {
+        float x = in[i].x, y = in[i].y, z = in[i].z;
+        out[i].x = mat.m0 * x + mat.m4 * y + mat.m8 * z + tx;
+        out[i].y = mat.m1 * x + mat.m5 * y + mat.m9 * z + ty;
+        out[i].z = mat.m2 * x + mat.m6 * y + mat.m10 * z + tz;
+    }
+}
+
+RMAPI void TransformBatchScalar(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat, float w)
+{
+    float tx = mat.m12 * w, ty = mat.m13 * w, tz = mat.m14 * w;
+
+    for (int i = 0; i < count; i++)
+    {
+        float px = x[i], py = y[i], pz = z[i];
+        outX[i] = mat.m0 * px + mat.m4 * py + mat.m8 * pz + tx;
+        outY[i] = mat.m1 * px + mat.m5 * py + mat.m9 * pz + ty;
+        outZ[i] = mat.m2 * px + mat.m6 * py + mat.m10 * pz + tz;
+    }
+}
+
+#if SIMD_SSE
+
+// Shuffle helper with lanes given in memory order: (v1[x], v1[y], v2[z], v2[w])
+#ifndef MATH_SHUFFLE
+#define MATH_SHUFFLE(v1, v2, x, y, z, w) _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x))
+#endif
+
+RMAPI void TransformBatchSSE(const Vector3* in, Vector3* out, int count, Matrix mat, float w)
+{
+    // Matrix hoisted into registers once for the whole batch
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), tx = _mm_set1_ps(mat.m12 * w);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), ty = _mm_set1_ps(mat.m13 * w);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), tz = _mm_set1_ps(mat.m14 * w);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // Deinterleave 4 points: (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) -> x, y, z
+        const float* p = &in[i].x;
+        __m128 in0 = _mm_loadu_ps(p);
+        __m128 in1 = _mm_loadu_ps(p + 4);
+        __m128 in2 = _mm_loadu_ps(p + 8);
+
+        __m128 x = MATH_SHUFFLE(in0, MATH_SHUFFLE(in1, in2, 2, 2, 1, 1), 0, 3, 0, 2);
+        __m128 y = MATH_SHUFFLE(MATH_SHUFFLE(in0, in1, 1, 1, 0, 0), MATH_SHUFFLE(in1, in2, 3, 3, 2, 2), 0, 2, 0, 2);
+        __m128 z = MATH_SHUFFLE(MATH_SHUFFLE(in0, in1, 2, 2, 1, 1), in2, 0, 2, 0, 3);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), tx);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), ty);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), tz);
+
+        // Interleave back into (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+        float* o = &out[i].x;
+        _mm_storeu_ps(o, MATH_SHUFFLE(MATH_SHUFFLE(rx, ry, 0, 0, 0, 0), MATH_SHUFFLE(rz, rx, 0, 0, 1, 1), 0, 2, 0, 2));
+        _mm_storeu_ps(o + 4, MATH_SHUFFLE(MATH_SHUFFLE(ry, rz, 1, 1, 1, 1), MATH_SHUFFLE(rx, ry, 2, 2, 2, 2), 0, 2, 0, 2));
+        _mm_storeu_ps(o + 8, MATH_SHUFFLE(MATH_SHUFFLE(rz, rx, 2, 2, 3, 3), MATH_SHUFFLE(ry, rz, 3, 3, 3, 3), 0, 2, 0, 2));
+    }
+    TransformBatchScalar(in + i, out + i, count - i, mat, w);
+}
+
+RMAPI void TransformBatchSSE(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat, float w)
+{
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), tx = _mm_set1_ps(mat.m12 * w);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), ty = _mm_set1_ps(mat.m13 * w);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), tz = _mm_set1_ps(mat.m14 * w);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        __m128 pz = _mm_loadu_ps(z + i);
+
+        _mm_storeu_ps(outX + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, px), _mm_mul_ps(m4, py)), _mm_mul_ps(m8, pz)), tx));
+        _mm_storeu_ps(outY + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, px), _mm_mul_ps(m5, py)), _mm_mul_ps(m9, pz)), ty));
+        _mm_storeu_ps(outZ + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, px), _mm_mul_ps(m6, py)), _mm_mul_ps(m10, pz)), tz));
+    }
+    TransformBatchScalar(x + i, y + i, z + i, outX + i, outY + i, outZ + i, count - i, mat, w);
+}
+
+#endif // SIMD_SSE
+
+#if SIMD_X86
+
+// Same lane selection as MATH_SHUFFLE, applied to both 128-bit halves
+#define MATH_SHUFFLE256(v1, v2, x, y, z, w) _mm256_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x))
+
+SIMD_TARGET_AVX2 RMAPI void TransformBatchAVX2(const Vector3* in, Vector3* out, int count, Matrix mat, float w)
+{
+    __m256 m0 = _mm256_set1_ps(mat.m0), m4 = _mm256_set1_ps(mat.m4), m8 = _mm256_set1_ps(mat.m8), tx = _mm256_set1_ps(mat.m12 * w);
+    __m256 m1 = _mm256_set1_ps(mat.m1), m5 = _mm256_set1_ps(mat.m5), m9 = _mm256_set1_ps(mat.m9), ty = _mm256_set1_ps(mat.m13 * w);
+    __m256 m2 = _mm256_set1_ps(mat.m2), m6 = _mm256_set1_ps(mat.m6), m10 = _mm256_set1_ps(mat.m10), tz = _mm256_set1_ps(mat.m14 * w);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        // Points 0-3 go to the low half and points 4-7 to the high half, so the
+        // in-lane shuffles deinterleave both groups of 4 at once
+        const float* p = &in[i].x;
+        __m256 in0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+        __m256 in1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+        __m256 in2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+
+        __m256 x = MATH_SHUFFLE256(in0, MATH_SHUFFLE256(in1, in2, 2, 2, 1, 1), 0, 3, 0, 2);
+        __m256 y = MATH_SHUFFLE256(MATH_SHUFFLE256(in0, in1, 1, 1, 0, 0), MATH_SHUFFLE256(in1, in2, 3, 3, 2, 2), 0, 2, 0, 2);
+        __m256 z = MATH_SHUFFLE256(MATH_SHUFFLE256(in0, in1, 2, 2, 1, 1), in2, 0, 2, 0, 3);
+
+        __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, x), _mm256_mul_ps(m4, y)), _mm256_mul_ps(m8, z)), tx);
+        __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, x), _mm256_mul_ps(m5, y)), _mm256_mul_ps(m9, z)), ty);
+        __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, x), _mm256_mul_ps(m6, y)), _mm256_mul_ps(m10, z)), tz);
+
+        __m256 out0 = MATH_SHUFFLE256(MATH_SHUFFLE256(rx, ry, 0, 0, 0, 0), MATH_SHUFFLE256(rz, rx, 0, 0, 1, 1), 0, 2, 0, 2);
+        __m256 out1 = MATH_SHUFFLE256(MATH_SHUFFLE256(ry, rz, 1, 1, 1, 1), MATH_SHUFFLE256(rx, ry, 2, 2, 2, 2), 0, 2, 0, 2);
+        __m256 out2 = MATH_SHUFFLE256(MATH_SHUFFLE256(rz, rx, 2, 2, 3, 3), MATH_SHUFFLE256(ry, rz, 3, 3, 3, 3), 0, 2, 0, 2);
+
+        float* o = &out[i].x;
+        _mm_storeu_ps(o, _mm256_castps256_ps128(out0));
+        _mm_storeu_ps(o + 4, _mm256_castps256_ps128(out1));
+        _mm_storeu_ps(o + 8, _mm256_castps256_ps128(out2));
+        _mm_storeu_ps(o + 12, _mm256_extractf128_ps(out0, 1));
+        _mm_storeu_ps(o + 16, _mm256_extractf128_ps(out1, 1));
+        _mm_storeu_ps(o + 20, _mm256_extractf128_ps(out2, 1));
+    }
+    TransformBatchScalar(in + i, out + i, count - i, mat, w);
+}
+
+SIMD_TARGET_AVX2 RMAPI void TransformBatchAVX2(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat, float w)
+{
+    __m256 m0 = _mm256_set1_ps(mat.m0), m4 = _mm256_set1_ps(mat.m4), m8 = _mm256_set1_ps(mat.m8), tx = _mm256_set1_ps(mat.m12 * w);
+    __m256 m1 = _mm256_set1_ps(mat.m1), m5 = _mm256_set1_ps(mat.m5), m9 = _mm256_set1_ps(mat.m9), ty = _mm256_set1_ps(mat.m13 * w);
+    __m256 m2 = _mm256_set1_ps(mat.m2), m6 = _mm256_set1_ps(mat.m6), m10 = _mm256_set1_ps(mat.m10), tz = _mm256_set1_ps(mat.m14 * w);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        __m256 pz = _mm256_loadu_ps(z + i);
+
+        _mm256_storeu_ps(outX + i, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, px), _mm256_mul_ps(m4, py)), _mm256_mul_ps(m8, pz)), tx));
+        _mm256_storeu_ps(outY + i, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, px), _mm256_mul_ps(m5, py)), _mm256_mul_ps(m9, pz)), ty));
+        _mm256_storeu_ps(outZ + i, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, px), _mm256_mul_ps(m6, py)), _mm256_mul_ps(m10, pz)), tz));
+    }
+    TransformBatchScalar(x + i, y + i, z + i, outX + i, outY + i, outZ + i, count - i, mat, w);
+}
+
+#endif // SIMD_X86
+
+RMAPI void TransformBatch(const Vector3* in, Vector3* out, int count, Matrix mat, float w)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { TransformBatchAVX2(in, out, count, mat, w); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { TransformBatchSSE(in, out, count, mat, w); return; }
+#endif
+    TransformBatchScalar(in, out, count, mat, w);
+}
+
+RMAPI void TransformBatch(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat, float w)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { TransformBatchAVX2(x, y, z, outX, outY, outZ, count, mat, w); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { TransformBatchSSE(x, y, z, outX, outY, outZ, count, mat, w); return; }
+#endif
+    TransformBatchScalar(x, y, z, outX, outY, outZ, count, mat, w);
+}
+
+// Transform an array of points by a given Matrix (Multiply(Vector3, Matrix) for each point)
+RMAPI void TransformPoints(const Vector3* points, Vector3* out, int count, Matrix mat)
+{
+    TransformBatch(points, out, count, mat, 1.0f);
+}
+
+// Transform an array of directions by a given Matrix, translation is ignored
+RMAPI void TransformDirections(const Vector3* directions, Vector3* out, int count, Matrix mat)
+{
+    TransformBatch(directions, out, count, mat, 0.0f);
+}
+
+// Transform SoA points by a given Matrix
+RMAPI void TransformPoints(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat)
+{
+    TransformBatch(x, y, z, outX, outY, outZ, count, mat, 1.0f);
+}
+
+// Transform SoA directions by a given Matrix, translation is ignored
+RMAPI void TransformDirections(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat)
+{
+    TransformBatch(x, y, z, outX, outY, outZ, count, mat, 0.0f);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Multithreaded transform
+//
+// Splits the array into one contiguous range per thread, the calling thread takes
+// the last range. Arrays below BATCH_PARALLEL_MIN_COUNT per thread are not split
+//----------------------------------------------------------------------------------
+#ifndef BATCH_PARALLEL_MIN_COUNT
+#define BATCH_PARALLEL_MIN_COUNT 16384
+#endif
+
+// Run fn(begin, end) over [0, count) on up to threadCount threads (0: one per hardware thread)
+template <typename Fn>
+inline void BatchParallelFor(int count, int threadCount, Fn fn)
+{
+    if (threadCount <= 0) threadCount = (int)std::thread::hardware_concurrency();
+    int maxThreads = count / BATCH_PARALLEL_MIN_COUNT;
+    if (threadCount > maxThreads) threadCount = maxThreads;
+
+    if (threadCount <= 1)
+    {
+        fn(0, count);
+        return;
+    }
+
+    // Ranges are rounded to 8 elements so that only the final range has a scalar tail
+    int chunk = ((count / threadCount) + 7) & ~7;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+
+    int begin = 0;
+    for (int t = 0; t < threadCount - 1; t++, begin += chunk) workers.emplace_back(fn, begin, begin + chunk);
+    fn(begin, count);
+
+    for (std::thread& worker : workers) worker.join();
+}
+
+// Transform an array of points on multiple threads
+RMAPI void TransformPointsParallel(const Vector3* points, Vector3* out, int count, Matrix mat, int threadCount = 0)
+{
+    BatchParallelFor(count, threadCount, [=](int begin, int end) { TransformBatch(points + begin, out + begin, end - begin, mat, 1.0f); });
+}
+
+// Transform an array of directions on multiple threads
+RMAPI void TransformDirectionsParallel(const Vector3* directions, Vector3* out, int count, Matrix mat, int threadCount = 0)
+{
+    BatchParallelFor(count, threadCount, [=](int begin, int end) { TransformBatch(directions + begin, out + begin, end - begin, mat, 0.0f); });
+}
+
+// Transform SoA points on multiple threads
+RMAPI void TransformPointsParallel(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat, int threadCount = 0)
+{
+    BatchParallelFor(count, threadCount, [=](int begin, int end) {
+        TransformBatch(x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin, mat, 1.0f);
+    });
+}
+
+// Transform SoA directions on multiple threads
+RMAPI void TransformDirectionsParallel(const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, int count, Matrix mat, int threadCount = 0)
+{
+    BatchParallelFor(count, threadCount, [=](int begin, int end) {
+        TransformBatch(x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin, mat, 0.0f);
+    });
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Angle based Vector2 kernels
+//
+// Batch forms of Direction, Angle, UnsignedAngle, SignedAngle, Rotate and RotateTowards
+// They always use the FastMath.h approximations (see the error bounds there), the
+// arithmetic around them runs in tiles of BATCH_TILE elements on the stack
+//----------------------------------------------------------------------------------
+#ifndef BATCH_TILE
+#define BATCH_TILE 256
+#endif
+
+// Convert an array of angles to directions
+RMAPI void DirectionBatch(const float* angles, float* outX, float* outY, int count)
+{
+    SinCosBatch(angles, outY, outX, count);
+}
+
+// Convert an array of directions to angles
+RMAPI void AngleBatch(const float* x, const float* y, float* outAngles, int count)
+{
+    Atan2Batch(y, x, outAngles, count);
+}
+
+// Unsigned angles between two arrays of directions. Range of [0, PI]
+RMAPI void UnsignedAngleBatch(const float* startX, const float* startY, const float* endX, const float* endY, float* outAngles, int count)
+{
+    // Clamped dot products go straight into the output, then acos in place
+    // NOTE: Compare-select clamp instead of fminf/fmaxf so the loop vectorizes
+    for (int i = 0; i < count; i++)
+    {
+        float dot = startX[i] * endX[i] + startY[i] * endY[i];
+        dot = (dot > 1.0f) ? 1.0f : dot;
+        outAngles[i] = (dot < -1.0f) ? -1.0f : dot;
+    }
+    AcosBatch(outAngles, outAngles, count);
+}
+
+// Signed angles between two arrays of directions. Range of [-PI, PI]
+RMAPI void SignedAngleBatch(const float* fromX, const float* fromY, const float* toX, const float* toY, float* outAngles, int count)
+{
+    // Unsigned angles go to the stack so the inputs are still intact for the cross products
+    // when outAngles aliases one of them
+    float angles[BATCH_TILE];
+
+    for (int base = 0; base < count; base += BATCH_TILE)
+    {
+        int n = (count - base < BATCH_TILE) ? count - base : BATCH_TILE;
+        const float* fx = fromX + base;
+        const float* fy = fromY + base;
+        const float* tx = toX + base;
+        const float* ty = toY + base;
+
+        UnsignedAngleBatch(fx, fy, tx, ty, angles, n);
+        for (int i = 0; i < n; i++)
+        {
+            float cross = fx[i] * ty[i] - fy[i] * tx[i];
+            outAngles[base + i] = (cross < 0.0f) ? -angles[i] : angles[i];
+        }
+    }
+}
+
+// Rotate an array of vectors, each by its own angle
+RMAPI void RotateBatch(const float* x, const float* y, const float* angles, float* outX, float* outY, int count)
+{
+    float sinres[BATCH_TILE];
+    float cosres[BATCH_TILE];
+
+    for (int base = 0; base < count; base += BATCH_TILE)
+    {
+        int n = (count - base < BATCH_TILE) ? count - base : BATCH_TILE;
+        SinCosBatch(angles + base, sinres, cosres, n);
+
+        for (int i = 0; i < n; i++)
+        {
+            float vx = x[base + i];
+            float vy = y[base + i];
+            outX[base + i] = vx * cosres[i] - vy * sinres[i];
+            outY[base + i] = vx * sinres[i] + vy * cosres[i];
+        }
+    }
+}
+
+// Rotate an array of directions at most maxRadians towards their targets
+RMAPI void RotateTowardsBatch(const float* fromX, const float* fromY, const float* toX, const float* toY, float maxRadians, float* outX, float* outY, int count)
+{
+    float angles[BATCH_TILE];
+
+    for (int base = 0; base < count; base += BATCH_TILE)
+    {
+        int n = (count - base < BATCH_TILE) ? count - base : BATCH_TILE;
+        const float* fx = fromX + base;
+        const float* fy = fromY + base;
+        const float* tx = toX + base;
+        const float* ty = toY + base;
+
+        UnsignedAngleBatch(fx, fy, tx, ty, angles, n);
+        for (int i = 0; i < n; i++)
+        {
+            float cross = fx[i] * ty[i] - fy[i] * tx[i];
+            float angle = (angles[i] < maxRadians) ? angles[i] : maxRadians;
+            angles[i] = (cross < 0.0f) ? -angle : angle;
+        }
+
+        RotateBatch(fx, fy, angles, outX + base, outY + base, n);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Random bulk generators
+//
+// Fill SoA arrays from an explicit RandomState (Random.h), directions use the FastMath.h
+// sin/cos so a tile of samples costs a few SIMD passes instead of per-sample CRT calls
+//----------------------------------------------------------------------------------
+
+// Fill arrays with random unit Vector2 directions
+RMAPI void RandomDirectionBatch(RandomState* state, float* outX, float* outY, int count)
+{
+    float angles[BATCH_TILE];
+
+    for (int base = 0; base < count; base += BATCH_TILE)
+    {
+        int n = (count - base < BATCH_TILE) ? count - base : BATCH_TILE;
+        RandomFill(state, angles, n, -PI, PI);
+        SinCosBatch(angles, outY + base, outX + base, n);
+    }
+}
+
+// Fill arrays with random unit Vector3 directions, uniform on the sphere
+RMAPI void RandomDirectionBatch(RandomState* state, float* outX, float* outY, float* outZ, int count)
+{
+    float angles[BATCH_TILE];
+    float sinres[BATCH_TILE];
+    float cosres[BATCH_TILE];
+
+    for (int base = 0; base < count; base += BATCH_TILE)
+    {
+        int n = (count - base < BATCH_TILE) ? count - base : BATCH_TILE;
+        float* z = outZ + base;
+
+        // Archimedes: z uniform in [-1, 1] and a uniform angle around the axis
+        RandomFill(state, z, n, -1.0f, 1.0f);
+        RandomFill(state, angles, n, -PI, PI);
+        SinCosBatch(angles, sinres, cosres, n);
+
+        for (int i = 0; i < n; i++)
+        {
+            float r2 = 1.0f - z[i] * z[i];
+            float r = sqrtf((r2 > 0.0f) ? r2 : 0.0f);
+            outX[base + i] = r * cosres[i];
+            outY[base + i] = r * sinres[i];
+        }
+    }
+}
+
+// Fill arrays with random points uniformly distributed in a disk around the origin
+RMAPI void RandomInDiskBatch(RandomState* state, float radius, float* outX, float* outY, int count)
+{
+    float u[BATCH_TILE];
+
+    RandomDirectionBatch(state, outX, outY, count);
+
+    for (int base = 0; base < count; base += BATCH_TILE)
+    {
+        int n = (count - base < BATCH_TILE) ? count - base : BATCH_TILE;
+        RandomFill(state, u, n, 0.0f, 1.0f);
+
+        // Area grows with r^2, so the radius is sqrt of a uniform sample
+        for (int i = 0; i < n; i++)
+        {
+            float r = radius * sqrtf(u[i]);
+            outX[base + i] *= r;
+            outY[base + i] *= r;
+        }
+    }
+}
+
+// Fill arrays with random points uniformly distributed in a sphere around the origin
+RMAPI void RandomInSphereBatch(RandomState* state, float radius, float* outX, float* outY, float* outZ, int count)
+{
+    float u0[BATCH_TILE];
+    float u1[BATCH_TILE];
+    float u2[BATCH_TILE];
+
+    RandomDirectionBatch(state, outX, outY, outZ, count);
+
+    for (int base = 0; base < count; base += BATCH_TILE)
+    {
+        int n = (count - base < BATCH_TILE) ? count - base : BATCH_TILE;
+        RandomFill(state, u0, n, 0.0f, 1.0f);
+        RandomFill(state, u1, n, 0.0f, 1.0f);
+        RandomFill(state, u2, n, 0.0f, 1.0f);
+
+        // Volume grows with r^3: the max of three uniform samples has the same distribution as cbrt(u), without the cbrt
+        for (int i = 0; i < n; i++)
+        {
+            float m = (u0[i] > u1[i]) ? u0[i] : u1[i];
+            m = (m > u2[i]) ? m : u2[i];
+
+            float r = radius * m;
+            outX[base + i] *= r;
+            outY[base + i] *= r;
+            outZ[base + i] *= r;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Quaternion interpolation kernels
+//
+// Nlerp and Slerp over SoA quaternion arrays, with one blend factor per element or a
+// uniform one. Nlerp matches the scalar function exactly; Slerp takes the same branches
+// as the scalar one per lane, with the FastMath.h acos/sin inside (see BenchSlerp.cpp)
+//----------------------------------------------------------------------------------
+
+// Four float arrays holding the components of 'count' quaternions
+typedef struct QuaternionSoA {
+    float* x;
+    float* y;
+    float* z;
+    float* w;
+} QuaternionSoA;
+
+// NOTE: A null 'amounts' array means every element uses 'amount'
+RMAPI void NlerpBatchScalar(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, float amount, QuaternionSoA out, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Quaternion result = Nlerp(Quaternion{ q1.x[i], q1.y[i], q1.z[i], q1.w[i] }, Quaternion{ q2.x[i], q2.y[i], q2.z[i], q2.w[i] }, amounts ? amounts[i] : amount);
+        out.x[i] = result.x;
+        out.y[i] = result.y;
+        out.z[i] = result.z;
+        out.w[i] = result.w;
+    }
+}
+
+RMAPI void SlerpBatchScalar(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, float amount, QuaternionSoA out, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Quaternion result = Slerp(Quaternion{ q1.x[i], q1.y[i], q1.z[i], q1.w[i] }, Quaternion{ q2.x[i], q2.y[i], q2.z[i], q2.w[i] }, amounts ? amounts[i] : amount);
+        out.x[i] = result.x;
+        out.y[i] = result.y;
+        out.z[i] = result.z;
+        out.w[i] = result.w;
+    }
+}
+
+#if SIMD_SSE
+// Lerp four quaternions and normalize them (Nlerp)
+RMAPI void NlerpSSE(const __m128* a, const __m128* b, __m128 t, __m128* result)
+{
+    __m128 lerp[4];
+    for (int k = 0; k < 4; k++) lerp[k] = _mm_add_ps(a[k], _mm_mul_ps(t, _mm_sub_ps(b[k], a[k])));
+
+    __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(lerp[0], lerp[0]), _mm_mul_ps(lerp[1], lerp[1])),
+        _mm_mul_ps(lerp[2], lerp[2])), _mm_mul_ps(lerp[3], lerp[3])));
+    length = FastSelect4(_mm_cmpeq_ps(length, _mm_setzero_ps()), _mm_set1_ps(1.0f), length);
+    __m128 ilength = _mm_div_ps(_mm_set1_ps(1.0f), length);
+
+    for (int k = 0; k < 4; k++) result[k] = _mm_mul_ps(lerp[k], ilength);
+}
+
+RMAPI void NlerpBatchSSE(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, float amount, QuaternionSoA out, int count)
+{
+    float* src1[4] = { q1.x, q1.y, q1.z, q1.w };
+    float* src2[4] = { q2.x, q2.y, q2.z, q2.w };
+    float* dst[4] = { out.x, out.y, out.z, out.w };
+    __m128 uniform = _mm_set1_ps(amount);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 a[4], b[4], result[4];
+        for (int k = 0; k < 4; k++) { a[k] = _mm_loadu_ps(src1[k] + i); b[k] = _mm_loadu_ps(src2[k] + i); }
+        __m128 t = amounts ? _mm_loadu_ps(amounts + i) : uniform;
+
+        NlerpSSE(a, b, t, result);
+        for (int k = 0; k < 4; k++) _mm_storeu_ps(dst[k] + i, result[k]);
+    }
+
+    QuaternionSoA q1Tail = { q1.x + i, q1.y + i, q1.z + i, q1.w + i };
+    QuaternionSoA q2Tail = { q2.x + i, q2.y + i, q2.z + i, q2.w + i };
+    QuaternionSoA outTail = { out.x + i, out.y + i, out.z + i, out.w + i };
+    NlerpBatchScalar(q1Tail, q2Tail, amounts ? amounts + i : nullptr, amount, outTail, count - i);
+}
+
+RMAPI void SlerpBatchSSE(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, float amount, QuaternionSoA out, int count)
+{
+    float* src1[4] = { q1.x, q1.y, q1.z, q1.w };
+    float* src2[4] = { q2.x, q2.y, q2.z, q2.w };
+    float* dst[4] = { out.x, out.y, out.z, out.w };
+    const __m128 uniform = _mm_set1_ps(amount);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 a[4], b[4], nlerp[4];
+        for (int k = 0; k < 4; k++) { a[k] = _mm_loadu_ps(src1[k] + i); b[k] = _mm_loadu_ps(src2[k] + i); }
+        __m128 t = amounts ? _mm_loadu_ps(amounts + i) : uniform;
+
+        // Take the short way around: flip q2 where the dot product is negative
+        __m128 cosHalfTheta = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_mul_ps(a[2], b[2])), _mm_mul_ps(a[3], b[3]));
+        __m128 flip = _mm_and_ps(_mm_cmplt_ps(cosHalfTheta, _mm_setzero_ps()), signBit);
+        for (int k = 0; k < 4; k++) b[k] = _mm_xor_ps(b[k], flip);
+        cosHalfTheta = _mm_xor_ps(cosHalfTheta, flip);
+
+        NlerpSSE(a, b, t, nlerp);
+
+        __m128 halfTheta = FastAcos4(cosHalfTheta);
+        __m128 sinHalfTheta = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(cosHalfTheta, cosHalfTheta)), _mm_setzero_ps()));
+        __m128 sinA, sinB, unused;
+        FastSinCos4(_mm_mul_ps(_mm_sub_ps(one, t), halfTheta), &sinA, &unused);
+        FastSinCos4(_mm_mul_ps(t, halfTheta), &sinB, &unused);
+        __m128 ratioA = _mm_div_ps(sinA, sinHalfTheta);
+        __m128 ratioB = _mm_div_ps(sinB, sinHalfTheta);
+
+        // Same branches as Slerp(): identical -> q1, close -> Nlerp, otherwise slerp
+        __m128 same = _mm_cmpge_ps(cosHalfTheta, one);
+        __m128 close = _mm_cmpgt_ps(cosHalfTheta, _mm_set1_ps(0.95f));
+        for (int k = 0; k < 4; k++)
+        {
+            __m128 slerp = _mm_add_ps(_mm_mul_ps(a[k], ratioA), _mm_mul_ps(b[k], ratioB));
+            __m128 result = FastSelect4(same, a[k], FastSelect4(close, nlerp[k], slerp));
+            _mm_storeu_ps(dst[k] + i, result);
+        }
+    }
+
+    QuaternionSoA q1Tail = { q1.x + i, q1.y + i, q1.z + i, q1.w + i };
+    QuaternionSoA q2Tail = { q2.x + i, q2.y + i, q2.z + i, q2.w + i };
+    QuaternionSoA outTail = { out.x + i, out.y + i, out.z + i, out.w + i };
+    SlerpBatchScalar(q1Tail, q2Tail, amounts ? amounts + i : nullptr, amount, outTail, count - i);
+}
+#endif // SIMD_SSE
+
+#if SIMD_X86
+SIMD_TARGET_AVX2 RMAPI void NlerpAVX2(const __m256* a, const __m256* b, __m256 t, __m256* result)
+{
+    __m256 lerp[4];
+    for (int k = 0; k < 4; k++) lerp[k] = _mm256_add_ps(a[k], _mm256_mul_ps(t, _mm256_sub_ps(b[k], a[k])));
+
+    __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(lerp[0], lerp[0]), _mm256_mul_ps(lerp[1], lerp[1])),
+        _mm256_mul_ps(lerp[2], lerp[2])), _mm256_mul_ps(lerp[3], lerp[3])));
+    length = _mm256_blendv_ps(length, _mm256_set1_ps(1.0f), _mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_EQ_OQ));
+    __m256 ilength = _mm256_div_ps(_mm256_set1_ps(1.0f), length);
+
+    for (int k = 0; k < 4; k++) result[k] = _mm256_mul_ps(lerp[k], ilength);
+}
+
+SIMD_TARGET_AVX2 RMAPI void NlerpBatchAVX2(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, float amount, QuaternionSoA out, int count)
+{
+    float* src1[4] = { q1.x, q1.y, q1.z, q1.w };
+    float* src2[4] = { q2.x, q2.y, q2.z, q2.w };
+    float* dst[4] = { out.x, out.y, out.z, out.w };
+    __m256 uniform = _mm256_set1_ps(amount);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 a[4], b[4], result[4];
+        for (int k = 0; k < 4; k++) { a[k] = _mm256_loadu_ps(src1[k] + i); b[k] = _mm256_loadu_ps(src2[k] + i); }
+        __m256 t = amounts ? _mm256_loadu_ps(amounts + i) : uniform;
+
+        NlerpAVX2(a, b, t, result);
+        for (int k = 0; k < 4; k++) _mm256_storeu_ps(dst[k] + i, result[k]);
+    }
+
+    QuaternionSoA q1Tail = { q1.x + i, q1.y + i, q1.z + i, q1.w + i };
+    QuaternionSoA q2Tail = { q2.x + i, q2.y + i, q2.z + i, q2.w + i };
+    QuaternionSoA outTail = { out.x + i, out.y + i, out.z + i, out.w + i };
+    NlerpBatchScalar(q1Tail, q2Tail, amounts ? amounts + i : nullptr, amount, outTail, count - i);
+}
+
+SIMD_TARGET_AVX2 RMAPI void SlerpBatchAVX2(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, float amount, QuaternionSoA out, int count)
+{
+    float* src1[4] = { q1.x, q1.y, q1.z, q1.w };
+    float* src2[4] = { q2.x, q2.y, q2.z, q2.w };
+    float* dst[4] = { out.x, out.y, out.z, out.w };
+    const __m256 uniform = _mm256_set1_ps(amount);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 a[4], b[4], nlerp[4];
+        for (int k = 0; k < 4; k++) { a[k] = _mm256_loadu_ps(src1[k] + i); b[k] = _mm256_loadu_ps(src2[k] + i); }
+        __m256 t = amounts ? _mm256_loadu_ps(amounts + i) : uniform;
+
+        __m256 cosHalfTheta = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[0], b[0]), _mm256_mul_ps(a[1], b[1])),
+            _mm256_mul_ps(a[2], b[2])), _mm256_mul_ps(a[3], b[3]));
+        __m256 flip = _mm256_and_ps(_mm256_cmp_ps(cosHalfTheta, _mm256_setzero_ps(), _CMP_LT_OQ), signBit);
+        for (int k = 0; k < 4; k++) b[k] = _mm256_xor_ps(b[k], flip);
+        cosHalfTheta = _mm256_xor_ps(cosHalfTheta, flip);
+
+        NlerpAVX2(a, b, t, nlerp);
+
+        __m256 halfTheta = FastAcos8(cosHalfTheta);
+        __m256 sinHalfTheta = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(one, _mm256_mul_ps(cosHalfTheta, cosHalfTheta)), _mm256_setzero_ps()));
+        __m256 sinA, sinB, unused;
+        FastSinCos8(_mm256_mul_ps(_mm256_sub_ps(one, t), halfTheta), &sinA, &unused);
+        FastSinCos8(_mm256_mul_ps(t, halfTheta), &sinB, &unused);
+        __m256 ratioA = _mm256_div_ps(sinA, sinHalfTheta);
+        __m256 ratioB = _mm256_div_ps(sinB, sinHalfTheta);
+
+        __m256 same = _mm256_cmp_ps(cosHalfTheta, one, _CMP_GE_OQ);
+        __m256 close = _mm256_cmp_ps(cosHalfTheta, _mm256_set1_ps(0.95f), _CMP_GT_OQ);
+        for (int k = 0; k < 4; k++)
+        {
+            __m256 slerp = _mm256_add_ps(_mm256_mul_ps(a[k], ratioA), _mm256_mul_ps(b[k], ratioB));
+            __m256 result = _mm256_blendv_ps(_mm256_blendv_ps(slerp, nlerp[k], close), a[k], same);
+            _mm256_storeu_ps(dst[k] + i, result);
+        }
+    }
+
+    QuaternionSoA q1Tail = { q1.x + i, q1.y + i, q1.z + i, q1.w + i };
+    QuaternionSoA q2Tail = { q2.x + i, q2.y + i, q2.z + i, q2.w + i };
+    QuaternionSoA outTail = { out.x + i, out.y + i, out.z + i, out.w + i };
+    SlerpBatchScalar(q1Tail, q2Tail, amounts ? amounts + i : nullptr, amount, outTail, count - i);
+}
+#endif // SIMD_X86
+
+// Normalized lerp of two quaternion arrays, each element with its own amount
+RMAPI void NlerpBatch(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, QuaternionSoA out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { NlerpBatchAVX2(q1, q2, amounts, 0.0f, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { NlerpBatchSSE(q1, q2, amounts, 0.0f, out, count); return; }
+#endif
+    NlerpBatchScalar(q1, q2, amounts, 0.0f, out, count);
+}
+
+// Normalized lerp of two quaternion arrays with one amount for all elements
+RMAPI void NlerpBatch(QuaternionSoA q1, QuaternionSoA q2, float amount, QuaternionSoA out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { NlerpBatchAVX2(q1, q2, nullptr, amount, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { NlerpBatchSSE(q1, q2, nullptr, amount, out, count); return; }
+#endif
+    NlerpBatchScalar(q1, q2, nullptr, amount, out, count);
+}
+
+// Spherical lerp of two quaternion arrays, each element with its own amount
+RMAPI void SlerpBatch(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, QuaternionSoA out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { SlerpBatchAVX2(q1, q2, amounts, 0.0f, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { SlerpBatchSSE(q1, q2, amounts, 0.0f, out, count); return; }
+#endif
+    SlerpBatchScalar(q1, q2, amounts, 0.0f, out, count);
+}
+
+// Spherical lerp of two quaternion arrays with one amount for all elements
+RMAPI void SlerpBatch(QuaternionSoA q1, QuaternionSoA q2, float amount, QuaternionSoA out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { SlerpBatchAVX2(q1, q2, nullptr, amount, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { SlerpBatchSSE(q1, q2, nullptr, amount, out, count); return; }
+#endif
+    SlerpBatchScalar(q1, q2, nullptr, amount, out, count);
+}
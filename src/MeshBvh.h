@@ -0,0 +1,481 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Mesh bounding volume hierarchy (ray picking against static meshes)
+//
+// raylib's GetRayCollisionMesh() transforms and tests every triangle of the mesh on every
+// call. The BVH is built once per Mesh, in mesh space, and a ray only visits the boxes it
+// crosses: the cost of a query grows with the log of the triangle count
+//
+// Build: binned SAH (surface area heuristic). Every node tries BVH_BIN_COUNT planes per axis
+// over the triangle centroids and keeps the split with the lowest expected cost, or stays a
+// leaf when no split is cheaper than testing its triangles (at most BVH_MAX_LEAF_SIZE)
+//
+// Layout: nodes are 32 bytes, two per cache line, and siblings are stored next to each
+// other so an inner node only keeps the index of its first child. Triangles are copied in
+// leaf order as the first vertex and the two edges, the values Moller-Trumbore starts from
+//
+// Queries take the model transform like GetRayCollisionMesh(): the ray is brought into mesh
+// space with the inverse transform (distances along the ray do not change) and the closest
+// hit comes back in world space. Children are visited nearest first and boxes behind the
+// closest hit so far are skipped
+//
+// Usage:
+//   MeshBvh bvh = CreateMeshBvh(model.meshes[0]);                 // once, after loading
+//   RayCollision hit = GetRayCollisionMeshBvh(GetScreenToWorldRay(mouse, camera), &bvh, model.transform);
+//   GetRayCollisionMeshBvhParallel(rays, hits, count, &bvh, model.transform, jobs);
+//   DestroyMeshBvh(&bvh);
+//
+// NOTE: The triangle test is GetRayCollisionTriangle(): same epsilons, no culling, the hit
+// with the smallest distance wins and ties go to the first triangle of the mesh. With an
+// identity transform hits match GetRayCollisionMesh() exactly when compiled without FP
+// contraction (the CMake build passes -ffp-contract=off, MSVC must not use /fp:contract or
+// /fp:fast), otherwise the two get fused into FMA differently. Other transforms match
+// within float rounding (raylib tests transformed vertices, the BVH a transformed ray)
+// NOTE: The mesh data is copied, the BVH stays valid after the mesh is unloaded. Rebuild it
+// when the vertices change
+//----------------------------------------------------------------------------------
+
+#ifndef BVHAPI
+#define BVHAPI inline
+#endif
+
+#ifndef BVH_BIN_COUNT
+#define BVH_BIN_COUNT 16
+#endif
+
+#ifndef BVH_MAX_LEAF_SIZE
+#define BVH_MAX_LEAF_SIZE 8
+#endif
+
+// Cost of visiting a node relative to one triangle test
+#ifndef BVH_TRAVERSAL_COST
+#define BVH_TRAVERSAL_COST 1.0f
+#endif
+
+// Deeper nodes become leaves whatever their size, bounds the traversal stack
+#define BVH_MAX_DEPTH 64
+
+// Fewest rays per job piece of GetRayCollisionMeshBvhParallel(), the pieces are otherwise sized
+// to give every worker BVH_PARALLEL_PIECES_PER_WORKER of them
+#define BVH_PARALLEL_MIN_GRAIN 64
+#define BVH_PARALLEL_PIECES_PER_WORKER 8
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct BvhNode {
+    Vector3 min;
+    int leftFirst;                  // First child for inner nodes (the second follows), first triangle for leaves
+    Vector3 max;
+    int count;                      // Triangles of a leaf, 0 for inner nodes
+};
+
+struct BvhTriangle {
+    Vector3 v0;
+    Vector3 edge1;                  // v1 - v0
+    Vector3 edge2;                  // v2 - v0
+};
+
+struct MeshBvh {
+    std::vector<BvhNode> nodes;     // Root first
+    std::vector<BvhTriangle> triangles;     // Leaf order
+    std::vector<int> indices;       // Mesh triangle of every stored triangle
+    int depth;                      // Deepest leaf, the root is 0
+};
+
+// Build scratch: per triangle bounds and centroids, indexed by mesh triangle
+struct BvhBuild {
+    std::vector<Vector3> min;
+    std::vector<Vector3> max;
+    std::vector<Vector3> centroids;
+    std::vector<int> order;         // Mesh triangles, partitioned in place while building
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Build
+//----------------------------------------------------------------------------------
+
+BVHAPI float BvhBoxArea(Vector3 min, Vector3 max)
+{
+    Vector3 e = max - min;
+
+    return e.x*e.y + e.y*e.z + e.z*e.x;
+}
+
+// NOTE: Plain comparisons instead of fminf()/fmaxf(), they compile to single min/max instructions
+BVHAPI void GrowBvhBox(Vector3* min, Vector3* max, Vector3 boxMin, Vector3 boxMax)
+{
+    min->x = (boxMin.x < min->x) ? boxMin.x : min->x;
+    min->y = (boxMin.y < min->y) ? boxMin.y : min->y;
+    min->z = (boxMin.z < min->z) ? boxMin.z : min->z;
+    max->x = (boxMax.x > max->x) ? boxMax.x : max->x;
+    max->y = (boxMax.y > max->y) ? boxMax.y : max->y;
+    max->z = (boxMax.z > max->z) ? boxMax.z : max->z;
+}
+
+BVHAPI float BvhAxis(Vector3 v, int axis)
+{
+    return (axis == 0) ? v.x : ((axis == 1) ? v.y : v.z);
+}
+
+// Split node over its triangles [first, first + count) of build->order, or keep it a leaf
+BVHAPI void SubdivideBvhNode(MeshBvh* bvh, BvhBuild* build, int index, int first, int count, int depth)
+{
+    Vector3 min = { FLT_MAX, FLT_MAX, FLT_MAX };
+    Vector3 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    Vector3 centroidMin = min;
+    Vector3 centroidMax = max;
+    for (int i = first; i < first + count; i++)
+    {
+        int triangle = build->order[i];
+        GrowBvhBox(&min, &max, build->min[triangle], build->max[triangle]);
+        GrowBvhBox(&centroidMin, &centroidMax, build->centroids[triangle], build->centroids[triangle]);
+    }
+
+    BvhNode& node = bvh->nodes[index];
+    node.min = min;
+    node.max = max;
+    node.leftFirst = first;
+    node.count = count;
+    if (depth > bvh->depth) bvh->depth = depth;
+    if ((count <= 1) || (depth >= BVH_MAX_DEPTH - 1)) return;
+
+    // Bin the centroids along every axis and sweep the planes between bins from both sides
+    int bestAxis = -1;
+    int bestBin = 0;
+    float bestCost = FLT_MAX;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float lo = BvhAxis(centroidMin, axis);
+        float extent = BvhAxis(centroidMax, axis) - lo;
+        if (extent <= 0.0f) continue;
+        float scale = BVH_BIN_COUNT/extent;
+
+        int binCount[BVH_BIN_COUNT] = { 0 };
+        Vector3 binMin[BVH_BIN_COUNT], binMax[BVH_BIN_COUNT];
+        for (int b = 0; b < BVH_BIN_COUNT; b++)
+        {
+            binMin[b] = Vector3{ FLT_MAX, FLT_MAX, FLT_MAX };
+            binMax[b] = Vector3{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        }
+        for (int i = first; i < first + count; i++)
+        {
+            int triangle = build->order[i];
+            int b = std::min(BVH_BIN_COUNT - 1, (int)((BvhAxis(build->centroids[triangle], axis) - lo)*scale));
+            binCount[b]++;
+            GrowBvhBox(&binMin[b], &binMax[b], build->min[triangle], build->max[triangle]);
+        }
+
+        float leftArea[BVH_BIN_COUNT - 1];
+        int leftCount[BVH_BIN_COUNT - 1];
+        Vector3 sweepMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+        Vector3 sweepMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        int sum = 0;
+        for (int b = 0; b < BVH_BIN_COUNT - 1; b++)
+        {
+            sum += binCount[b];
+            GrowBvhBox(&sweepMin, &sweepMax, binMin[b], binMax[b]);
+            leftCount[b] = sum;
+            leftArea[b] = (sum > 0) ? BvhBoxArea(sweepMin, sweepMax) : 0.0f;
+        }
+
+        sweepMin = Vector3{ FLT_MAX, FLT_MAX, FLT_MAX };
+        sweepMax = Vector3{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        sum = 0;
+        for (int b = BVH_BIN_COUNT - 1; b > 0; b--)
+        {
+            sum += binCount[b];
+            GrowBvhBox(&sweepMin, &sweepMax, binMin[b], binMax[b]);
+            if ((sum == 0) || (leftCount[b - 1] == 0)) continue;
+
+            float cost = leftCount[b - 1]*leftArea[b - 1] + sum*BvhBoxArea(sweepMin, sweepMax);
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = b;
+            }
+        }
+    }
+
+    // Costs are in triangle tests times area, relative to this node's area
+    float area = BvhBoxArea(min, max);
+    int middle = first;
+    if (bestAxis >= 0)
+    {
+        if ((count <= BVH_MAX_LEAF_SIZE) && (BVH_TRAVERSAL_COST*area + bestCost >= count*area)) return;
+
+        float lo = BvhAxis(centroidMin, bestAxis);
+        float scale = BVH_BIN_COUNT/(BvhAxis(centroidMax, bestAxis) - lo);
+        middle = (int)(std::partition(build->order.begin() + first, build->order.begin() + first + count, [&](int triangle) {
+            return std::min(BVH_BIN_COUNT - 1, (int)((BvhAxis(build->centroids[triangle], bestAxis) - lo)*scale)) < bestBin;
+        }) - build->order.begin());
+    }
+    else
+    {
+        // All centroids in one point: split in halves only when the leaf would be too large
+        if (count <= BVH_MAX_LEAF_SIZE) return;
+        middle = first + count/2;
+    }
+
+    int left = (int)bvh->nodes.size();
+    bvh->nodes.push_back(BvhNode{});
+    bvh->nodes.push_back(BvhNode{});
+    bvh->nodes[index].leftFirst = left;
+    bvh->nodes[index].count = 0;
+
+    SubdivideBvhNode(bvh, build, left, first, middle - first, depth + 1);
+    SubdivideBvhNode(bvh, build, left + 1, middle, first + count - middle, depth + 1);
+}
+
+// Build the hierarchy of a mesh, indexed or not
+// NOTE: Reads mesh.vertices on the CPU, like GetRayCollisionMesh()
+BVHAPI MeshBvh CreateMeshBvh(Mesh mesh)
+{
+    MeshBvh bvh = {};
+    int count = (mesh.vertices != NULL) ? mesh.triangleCount : 0;
+    if (count <= 0) return bvh;
+
+    const Vector3* vertices = (const Vector3*)mesh.vertices;
+    std::vector<BvhTriangle> triangles(count);
+    BvhBuild build;
+    build.min.resize(count);
+    build.max.resize(count);
+    build.centroids.resize(count);
+    build.order.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 a, b, c;
+        if (mesh.indices)
+        {
+            a = vertices[mesh.indices[i*3 + 0]];
+            b = vertices[mesh.indices[i*3 + 1]];
+            c = vertices[mesh.indices[i*3 + 2]];
+        }
+        else
+        {
+            a = vertices[i*3 + 0];
+            b = vertices[i*3 + 1];
+            c = vertices[i*3 + 2];
+        }
+
+        // Edges as GetRayCollisionTriangle() computes them
+        triangles[i] = BvhTriangle{ a, Subtract(b, a), Subtract(c, a) };
+        build.min[i] = Vector3{ fminf(a.x, fminf(b.x, c.x)), fminf(a.y, fminf(b.y, c.y)), fminf(a.z, fminf(b.z, c.z)) };
+        build.max[i] = Vector3{ fmaxf(a.x, fmaxf(b.x, c.x)), fmaxf(a.y, fmaxf(b.y, c.y)), fmaxf(a.z, fmaxf(b.z, c.z)) };
+        build.centroids[i] = (build.min[i] + build.max[i])*0.5f;
+        build.order[i] = i;
+    }
+
+    bvh.nodes.reserve(2*count);
+    bvh.nodes.push_back(BvhNode{});
+    SubdivideBvhNode(&bvh, &build, 0, 0, count, 0);
+
+    // Grow every box a little so that rounding in the slab test never drops a hit the
+    // triangle test finds, on an edge or in a plane that bounds the box
+    Vector3 rootMin = bvh.nodes[0].min, rootMax = bvh.nodes[0].max;
+    float size = fmaxf(fmaxf(fmaxf(fabsf(rootMin.x), fabsf(rootMax.x)), fmaxf(fabsf(rootMin.y), fabsf(rootMax.y))), fmaxf(fabsf(rootMin.z), fabsf(rootMax.z)));
+    float padding = size*1e-6f;
+    for (BvhNode& node : bvh.nodes)
+    {
+        node.min = node.min - Vector3{ padding, padding, padding };
+        node.max = node.max + Vector3{ padding, padding, padding };
+    }
+
+    bvh.triangles.resize(count);
+    bvh.indices = build.order;
+    for (int i = 0; i < count; i++) bvh.triangles[i] = triangles[build.order[i]];
+
+    return bvh;
+}
+
+BVHAPI void DestroyMeshBvh(MeshBvh* bvh)
+{
+    *bvh = MeshBvh{};
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Ray queries
+//----------------------------------------------------------------------------------
+
+// Distance along the ray to the box, FLT_MAX when missed or farther than maxDistance
+BVHAPI float IntersectBvhNode(const BvhNode& node, Vector3 origin, Vector3 invDirection, float maxDistance)
+{
+    float x1 = (node.min.x - origin.x)*invDirection.x, x2 = (node.max.x - origin.x)*invDirection.x;
+    float y1 = (node.min.y - origin.y)*invDirection.y, y2 = (node.max.y - origin.y)*invDirection.y;
+    float z1 = (node.min.z - origin.z)*invDirection.z, z2 = (node.max.z - origin.z)*invDirection.z;
+
+    float tNear = (x1 < x2) ? x1 : x2, tFar = (x1 < x2) ? x2 : x1;
+    float yNear = (y1 < y2) ? y1 : y2, yFar = (y1 < y2) ? y2 : y1;
+    float zNear = (z1 < z2) ? z1 : z2, zFar = (z1 < z2) ? z2 : z1;
+    tNear = (tNear > yNear) ? tNear : yNear;
+    tNear = (tNear > zNear) ? tNear : zNear;
+    tFar = (tFar < yFar) ? tFar : yFar;
+    tFar = (tFar < zFar) ? tFar : zFar;
+
+    return ((tNear <= tFar) && (tFar >= 0.0f) && (tNear <= maxDistance)) ? tNear : FLT_MAX;
+}
+
+// Moller-Trumbore with the tests of GetRayCollisionTriangle(), distance in *t
+BVHAPI bool IntersectBvhTriangle(const BvhTriangle& triangle, Vector3 origin, Vector3 direction, float* t)
+{
+    Vector3 p = Cross(direction, triangle.edge2);
+    float det = Dot(triangle.edge1, p);
+    if ((det > -EPSILON) && (det < EPSILON)) return false;
+
+    float invDet = 1.0f/det;
+    Vector3 tv = Subtract(origin, triangle.v0);
+    float u = Dot(tv, p)*invDet;
+    if ((u < 0.0f) || (u > 1.0f)) return false;
+
+    Vector3 q = Cross(tv, triangle.edge1);
+    float v = Dot(direction, q)*invDet;
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return false;
+
+    *t = Dot(triangle.edge2, q)*invDet;
+
+    return *t > EPSILON;
+}
+
+// Closest hit of a ray already in mesh space, the stored triangle index or -1
+BVHAPI int RaycastMeshBvh(const MeshBvh* bvh, Vector3 origin, Vector3 direction, float* distance)
+{
+    if (bvh->nodes.empty()) return -1;
+
+    // Zero components give 0 instead of NaN for a ray in the plane of a box face
+    Vector3 invDirection = {
+        (direction.x != 0.0f) ? 1.0f/direction.x : copysignf(FLT_MAX, direction.x),
+        (direction.y != 0.0f) ? 1.0f/direction.y : copysignf(FLT_MAX, direction.y),
+        (direction.z != 0.0f) ? 1.0f/direction.z : copysignf(FLT_MAX, direction.z) };
+
+    const BvhNode* nodes = bvh->nodes.data();
+    const BvhTriangle* triangles = bvh->triangles.data();
+    const int* indices = bvh->indices.data();
+    int best = -1;
+    float bestDistance = FLT_MAX;
+
+    int stack[BVH_MAX_DEPTH];
+    int top = 0;
+    if (IntersectBvhNode(nodes[0], origin, invDirection, bestDistance) == FLT_MAX) return -1;
+    const BvhNode* node = &nodes[0];
+    for (;;)
+    {
+        if (node->count > 0)
+        {
+            for (int i = node->leftFirst; i < node->leftFirst + node->count; i++)
+            {
+                float t;
+                if (IntersectBvhTriangle(triangles[i], origin, direction, &t) &&
+                    ((t < bestDistance) || ((t == bestDistance) && (indices[i] < indices[best]))))
+                {
+                    best = i;
+                    bestDistance = t;
+                }
+            }
+        }
+        else
+        {
+            // Nearest child first, the other waits on the stack. Equal distances still
+            // enter a box, an equal hit on a lower triangle wins the tie
+            const BvhNode* child1 = &nodes[node->leftFirst];
+            const BvhNode* child2 = child1 + 1;
+            float d1 = IntersectBvhNode(*child1, origin, invDirection, bestDistance);
+            float d2 = IntersectBvhNode(*child2, origin, invDirection, bestDistance);
+            if (d1 > d2)
+            {
+                std::swap(d1, d2);
+                std::swap(child1, child2);
+            }
+
+            if (d1 != FLT_MAX)
+            {
+                if (d2 != FLT_MAX) stack[top++] = (int)(child2 - nodes);
+                node = child1;
+                continue;
+            }
+        }
+
+        // Pop, skipping boxes behind a hit found since they were pushed
+        node = nullptr;
+        while (top > 0)
+        {
+            const BvhNode* next = &nodes[stack[--top]];
+            if (IntersectBvhNode(*next, origin, invDirection, bestDistance) != FLT_MAX)
+            {
+                node = next;
+                break;
+            }
+        }
+        if (node == nullptr) break;
+    }
+
+    *distance = bestDistance;
+
+    return best;
+}
+
+// Ray query of a prepared transform, see GetRayCollisionMeshBvh()
+BVHAPI RayCollision GetRayCollisionMeshBvhLocal(Ray ray, const MeshBvh* bvh, Matrix transform, Matrix invTransform)
+{
+    RayCollision collision = { 0 };
+
+    Vector3 origin = Multiply(ray.position, invTransform);
+    Vector3 direction = {
+        invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z,
+        invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z,
+        invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z };
+
+    float distance = 0.0f;
+    int index = RaycastMeshBvh(bvh, origin, direction, &distance);
+    if (index < 0) return collision;
+
+    // Normal from the world space edges: right for any scale, mirroring included
+    const BvhTriangle& triangle = bvh->triangles[index];
+    Vector3 edge1 = {
+        transform.m0*triangle.edge1.x + transform.m4*triangle.edge1.y + transform.m8*triangle.edge1.z,
+        transform.m1*triangle.edge1.x + transform.m5*triangle.edge1.y + transform.m9*triangle.edge1.z,
+        transform.m2*triangle.edge1.x + transform.m6*triangle.edge1.y + transform.m10*triangle.edge1.z };
+    Vector3 edge2 = {
+        transform.m0*triangle.edge2.x + transform.m4*triangle.edge2.y + transform.m8*triangle.edge2.z,
+        transform.m1*triangle.edge2.x + transform.m5*triangle.edge2.y + transform.m9*triangle.edge2.z,
+        transform.m2*triangle.edge2.x + transform.m6*triangle.edge2.y + transform.m10*triangle.edge2.z };
+
+    collision.hit = true;
+    collision.distance = distance;
+    collision.normal = Normalize(Cross(edge1, edge2));
+    collision.point = Add(ray.position, Scale(ray.direction, distance));
+
+    return collision;
+}
+
+// Get collision info between ray and mesh, same result as GetRayCollisionMesh(ray, mesh, transform)
+BVHAPI RayCollision GetRayCollisionMeshBvh(Ray ray, const MeshBvh* bvh, Matrix transform)
+{
+    return GetRayCollisionMeshBvhLocal(ray, bvh, transform, Invert(transform));
+}
+
+// Get collision info for an array of rays against the same mesh
+BVHAPI void GetRayCollisionMeshBvhBatch(const Ray* rays, RayCollision* collisions, int count, const MeshBvh* bvh, Matrix transform)
+{
+    Matrix invTransform = Invert(transform);
+    for (int i = 0; i < count; i++) collisions[i] = GetRayCollisionMeshBvhLocal(rays[i], bvh, transform, invTransform);
+}
+
+// Get collision info for an array of rays on all workers of the job system
+BVHAPI void GetRayCollisionMeshBvhParallel(const Ray* rays, RayCollision* collisions, int count, const MeshBvh* bvh, Matrix transform, JobSystem* jobs)
+{
+    Matrix invTransform = Invert(transform);
+    int grain = count/(GetJobWorkerCount(jobs)*BVH_PARALLEL_PIECES_PER_WORKER);
+    if (grain < BVH_PARALLEL_MIN_GRAIN) grain = BVH_PARALLEL_MIN_GRAIN;
+    ParallelFor(jobs, count, grain, [=](int begin, int end) {
+        for (int i = begin; i < end; i++) collisions[i] = GetRayCollisionMeshBvhLocal(rays[i], bvh, transform, invTransform);
+    });
+}
@@ -0,0 +1,702 @@
+#pragma once
+#include "MathBatch.h"
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Quantized storage for vectors, directions and quaternions
+//
+// Compact formats for data that is stored or sent far more often than it is computed on
+// (animation keyframes, network snapshots, particle buffers). Decode to the Math.h types
+// before doing math. Maximum error measured over random inputs (see bench/BenchQuantize.cpp):
+//
+//   Vector3Half, Vector4Half  : IEEE binary16, relative error 2^-11 (4.9e-4) for |v| in
+//     (6 bytes, 8 bytes)        [6.1e-5, 65504], absolute 3.0e-8 below, larger values become inf
+//   DirectionOct16 (2 bytes)  : octahedral unit vector, 8-bit snorm, 0.95 deg
+//   DirectionOct32 (4 bytes)  : octahedral unit vector, 16-bit snorm, 0.0037 deg
+//   QuaternionPacked (4 bytes): smallest three, 2-bit index + 3x10 bits, 0.26 deg rotation,
+//                               1.9e-3 per component
+//
+// Half conversion rounds to nearest even and keeps inf/nan (nan payloads are not preserved,
+// FloatToHalf() turns every nan into the quiet nan 0x7e00 with its sign)
+// The batch kernels match the scalar functions bit for bit when compiled without FP
+// contraction (the CMake build passes -ffp-contract=off, MSVC must not use /fp:contract or
+// /fp:fast), otherwise the scalar octahedral decode gets fused into FMA and the SIMD one does
+// not. The exception is nan: the AVX2 half conversions (F16C) keep the nan payload bits, so a
+// nan comes out as a nan but not always the same one. Directions and quaternions must be
+// normalized before encoding, decoding returns them normalized (within float rounding)
+//
+// Usage:
+//   QuaternionPacked key = PackQuaternion(bone.rotation);
+//   bone.rotation = UnpackQuaternion(key);
+//   PackHalfBatch(positions, snapshot.positions, count);
+//----------------------------------------------------------------------------------
+
+// Magic numbers of the float <-> half conversion (F. Giesen, "half_to_float" / "float_to_half_fast3")
+#define QUANTIZE_HALF_OVERFLOW 0x47800000u          // (127 + 16) << 23, smallest float rounding to inf
+#define QUANTIZE_HALF_MIN_NORMAL 0x38800000u        // (127 - 14) << 23, smallest float giving a normal half
+#define QUANTIZE_HALF_DENORM_MAGIC 0x3f000000u      // ((127 - 15) + (23 - 10) + 1) << 23
+#define QUANTIZE_HALF_NORMAL_BIAS 0xc8000fffu       // ((15 - 127) << 23) + 0xfff, rebias and round
+#define QUANTIZE_HALF_TO_FLOAT 0x77800000u          // 2^112, rebias half exponents to float ones
+
+// 1/sqrt(2), range of the three smallest components of a unit quaternion
+#define QUANTIZE_SQRT1_2 0.70710678118654752f
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Vector3 stored as three IEEE half floats
+typedef struct Vector3Half {
+    uint16_t x;
+    uint16_t y;
+    uint16_t z;
+} Vector3Half;
+
+// Vector4/Quaternion stored as four IEEE half floats
+typedef struct Vector4Half {
+    uint16_t x;
+    uint16_t y;
+    uint16_t z;
+    uint16_t w;
+} Vector4Half;
+
+// Unit vector folded onto the octahedron, 8-bit snorm coordinates
+typedef struct DirectionOct16 {
+    int8_t u;
+    int8_t v;
+} DirectionOct16;
+
+// Unit vector folded onto the octahedron, 16-bit snorm coordinates
+typedef struct DirectionOct32 {
+    int16_t u;
+    int16_t v;
+} DirectionOct32;
+
+// Unit quaternion with its largest component dropped
+// Bits 30-31: index of the dropped component (x, y, z, w), bits 0-29: the other three,
+// 10 bits each in order, scaled from [-1/sqrt(2), 1/sqrt(2)]. The quaternion is negated
+// when needed so that the dropped component is positive (same rotation)
+typedef struct QuaternionPacked {
+    uint32_t bits;
+} QuaternionPacked;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Half float
+//----------------------------------------------------------------------------------
+
+RMAPI uint32_t QuantizeFloatBits(float value) { uint32_t bits; memcpy(&bits, &value, sizeof(bits)); return bits; }
+RMAPI float QuantizeBitsFloat(uint32_t bits) { float value; memcpy(&value, &bits, sizeof(value)); return value; }
+
+// Convert float to half, round to nearest even
+RMAPI uint16_t FloatToHalf(float value)
+{
+    uint32_t f = QuantizeFloatBits(value);
+    uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+
+    uint32_t result = 0;
+    if (f >= QUANTIZE_HALF_OVERFLOW) result = (f > 0x7f800000u) ? 0x7e00u : 0x7c00u;     // Overflow, inf or nan
+    else if (f < QUANTIZE_HALF_MIN_NORMAL)
+    {
+        // Denormal or zero: the float addition aligns the mantissa and rounds it
+        result = QuantizeFloatBits(QuantizeBitsFloat(f) + QuantizeBitsFloat(QUANTIZE_HALF_DENORM_MAGIC)) - QUANTIZE_HALF_DENORM_MAGIC;
+    }
+    else
+    {
+        uint32_t mantissaOdd = (f >> 13) & 1;
+        result = (f + QUANTIZE_HALF_NORMAL_BIAS + mantissaOdd) >> 13;
+    }
+
+    return (uint16_t)(result | (sign >> 16));
+}
+
+// Convert half to float (exact)
+// NOTE: Half denormals go through float denormals, do not enable denormals-are-zero
+RMAPI float HalfToFloat(uint16_t value)
+{
+    uint32_t expMantissa = value & 0x7fffu;
+    uint32_t result = QuantizeFloatBits(QuantizeBitsFloat(expMantissa << 13) * QuantizeBitsFloat(QUANTIZE_HALF_TO_FLOAT));
+    if (expMantissa > 0x7bffu) result |= 0x7f800000u;       // Inf or nan
+    result |= (uint32_t)(value & 0x8000u) << 16;
+
+    return QuantizeBitsFloat(result);
+}
+
+RMAPI Vector3Half ToHalf(Vector3 v)
+{
+    Vector3Half result = { FloatToHalf(v.x), FloatToHalf(v.y), FloatToHalf(v.z) };
+
+    return result;
+}
+
+RMAPI Vector4Half ToHalf(Vector4 v)
+{
+    Vector4Half result = { FloatToHalf(v.x), FloatToHalf(v.y), FloatToHalf(v.z), FloatToHalf(v.w) };
+
+    return result;
+}
+
+RMAPI Vector3 ToVector3(Vector3Half v)
+{
+    Vector3 result = { HalfToFloat(v.x), HalfToFloat(v.y), HalfToFloat(v.z) };
+
+    return result;
+}
+
+RMAPI Vector4 ToVector4(Vector4Half v)
+{
+    Vector4 result = { HalfToFloat(v.x), HalfToFloat(v.y), HalfToFloat(v.z), HalfToFloat(v.w) };
+
+    return result;
+}
+
+RMAPI void FloatToHalfBatchScalar(const float* in, uint16_t* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = FloatToHalf(in[i]);
+}
+
+RMAPI void HalfToFloatBatchScalar(const uint16_t* in, float* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = HalfToFloat(in[i]);
+}
+
+#if SIMD_SSE
+// Four floats to halves in the low 16 bits of each lane, same steps as FloatToHalf()
+RMAPI __m128i FloatToHalfSSE(__m128 value)
+{
+    __m128i f = _mm_castps_si128(value);
+    __m128i sign = _mm_and_si128(f, _mm_set1_epi32((int)0x80000000u));
+    f = _mm_xor_si128(f, sign);
+
+    __m128i isNan = _mm_cmpgt_epi32(f, _mm_set1_epi32(0x7f800000));
+    __m128i isRegular = _mm_cmpgt_epi32(_mm_set1_epi32((int)QUANTIZE_HALF_OVERFLOW), f);
+    __m128i isDenormal = _mm_cmpgt_epi32(_mm_set1_epi32((int)QUANTIZE_HALF_MIN_NORMAL), f);
+    __m128i infOrNan = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(isNan, _mm_set1_epi32(0x200)));
+
+    __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((int)QUANTIZE_HALF_DENORM_MAGIC));
+    __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f), magic)), _mm_castps_si128(magic));
+
+    __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+    __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32((int)QUANTIZE_HALF_NORMAL_BIAS)), mantissaOdd), 13);
+
+    __m128i finite = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+    __m128i result = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, infOrNan));
+
+    return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+}
+
+// Four halves in the low 16 bits of each lane to floats, same steps as HalfToFloat()
+RMAPI __m128 HalfToFloatSSE(__m128i value)
+{
+    __m128i expMantissa = _mm_and_si128(value, _mm_set1_epi32(0x7fff));
+    __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((int)QUANTIZE_HALF_TO_FLOAT)));
+    __m128i infNan = _mm_and_si128(_mm_cmpgt_epi32(expMantissa, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(0x7f800000));
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16);
+
+    return _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(scaled), _mm_or_si128(infNan, sign)));
+}
+
+// Pack the low 16 bits of two lanes of four into eight 16-bit values
+RMAPI __m128i PackLow16SSE(__m128i lo, __m128i hi)
+{
+    // Sign extend so that the signed saturation of packs keeps the bits
+    lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+    hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+
+    return _mm_packs_epi32(lo, hi);
+}
+
+RMAPI void FloatToHalfBatchSSE(const float* in, uint16_t* out, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i lo = FloatToHalfSSE(_mm_loadu_ps(in + i));
+        __m128i hi = FloatToHalfSSE(_mm_loadu_ps(in + i + 4));
+        _mm_storeu_si128((__m128i*)(out + i), PackLow16SSE(lo, hi));
+    }
+    FloatToHalfBatchScalar(in + i, out + i, count - i);
+}
+
+RMAPI void HalfToFloatBatchSSE(const uint16_t* in, float* out, int count)
+{
+    __m128i zero = _mm_setzero_si128();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i h = _mm_loadu_si128((const __m128i*)(in + i));
+        _mm_storeu_ps(out + i, HalfToFloatSSE(_mm_unpacklo_epi16(h, zero)));
+        _mm_storeu_ps(out + i + 4, HalfToFloatSSE(_mm_unpackhi_epi16(h, zero)));
+    }
+    HalfToFloatBatchScalar(in + i, out + i, count - i);
+}
+#endif // SIMD_SSE
+
+#if SIMD_X86
+// AVX2 level CPUs all have the F16C conversion instructions (checked by DetectSimdLevel())
+SIMD_TARGET_F16C RMAPI void FloatToHalfBatchAVX2(const float* in, uint16_t* out, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_si128((__m128i*)(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    FloatToHalfBatchScalar(in + i, out + i, count - i);
+}
+
+SIMD_TARGET_F16C RMAPI void HalfToFloatBatchAVX2(const uint16_t* in, float* out, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(in + i))));
+    }
+    HalfToFloatBatchScalar(in + i, out + i, count - i);
+}
+#endif // SIMD_X86
+
+// Convert an array of floats to halves
+RMAPI void FloatToHalfBatch(const float* in, uint16_t* out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { FloatToHalfBatchAVX2(in, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { FloatToHalfBatchSSE(in, out, count); return; }
+#endif
+    FloatToHalfBatchScalar(in, out, count);
+}
+
+// Convert an array of halves to floats
+RMAPI void HalfToFloatBatch(const uint16_t* in, float* out, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { HalfToFloatBatchAVX2(in, out, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { HalfToFloatBatchSSE(in, out, count); return; }
+#endif
+    HalfToFloatBatchScalar(in, out, count);
+}
+
+// Pack an array of vectors to half floats
+RMAPI void PackHalfBatch(const Vector3* in, Vector3Half* out, int count) { FloatToHalfBatch(&in->x, &out->x, count*3); }
+RMAPI void PackHalfBatch(const Vector4* in, Vector4Half* out, int count) { FloatToHalfBatch(&in->x, &out->x, count*4); }
+
+// Unpack an array of half float vectors
+RMAPI void UnpackHalfBatch(const Vector3Half* in, Vector3* out, int count) { HalfToFloatBatch(&in->x, &out->x, count*3); }
+RMAPI void UnpackHalfBatch(const Vector4Half* in, Vector4* out, int count) { HalfToFloatBatch(&in->x, &out->x, count*4); }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Octahedral directions
+//
+// The unit sphere is projected on the octahedron |x| + |y| + |z| = 1, the lower half
+// is folded over the upper one and (x, y) is stored as snorm. Zero vectors encode as +Z
+//----------------------------------------------------------------------------------
+
+// Project a direction on the unfolded octahedron, coordinates in [-1, 1]
+RMAPI void OctProject(float x, float y, float z, float* outU, float* outV)
+{
+    float sum = fabsf(x) + fabsf(y) + fabsf(z);
+    float scale = (sum > 0.0f) ? 1.0f/sum : 0.0f;
+    float u = x*scale;
+    float v = y*scale;
+
+    if (z < 0.0f)
+    {
+        float foldU = (1.0f - fabsf(v))*((u >= 0.0f) ? 1.0f : -1.0f);
+        float foldV = (1.0f - fabsf(u))*((v >= 0.0f) ? 1.0f : -1.0f);
+        u = foldU;
+        v = foldV;
+    }
+
+    *outU = u;
+    *outV = v;
+}
+
+// Direction back from octahedron coordinates, normalized
+RMAPI Vector3 OctUnproject(float u, float v)
+{
+    float z = 1.0f - fabsf(u) - fabsf(v);
+    float t = (-z > 0.0f) ? -z : 0.0f;        // Not fmaxf(), keeps the zero sign of _mm_max_ps()
+    float x = u + ((u >= 0.0f) ? -t : t);
+    float y = v + ((v >= 0.0f) ? -t : t);
+
+    float ilength = 1.0f/sqrtf(x*x + y*y + z*z);
+    Vector3 result = { x*ilength, y*ilength, z*ilength };
+
+    return result;
+}
+
+// Encode a unit vector in 2 bytes
+RMAPI DirectionOct16 PackDirection16(Vector3 v)
+{
+    float u, w;
+    OctProject(v.x, v.y, v.z, &u, &w);
+
+    DirectionOct16 result = { (int8_t)lrintf(u*127.0f), (int8_t)lrintf(w*127.0f) };
+
+    return result;
+}
+
+// Encode a unit vector in 4 bytes
+RMAPI DirectionOct32 PackDirection32(Vector3 v)
+{
+    float u, w;
+    OctProject(v.x, v.y, v.z, &u, &w);
+
+    DirectionOct32 result = { (int16_t)lrintf(u*32767.0f), (int16_t)lrintf(w*32767.0f) };
+
+    return result;
+}
+
+RMAPI Vector3 UnpackDirection(DirectionOct16 d) { return OctUnproject(d.u*(1.0f/127.0f), d.v*(1.0f/127.0f)); }
+RMAPI Vector3 UnpackDirection(DirectionOct32 d) { return OctUnproject(d.u*(1.0f/32767.0f), d.v*(1.0f/32767.0f)); }
+
+RMAPI void PackDirectionBatchScalar(const float* x, const float* y, const float* z, DirectionOct16* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = PackDirection16(Vector3{ x[i], y[i], z[i] });
+}
+
+RMAPI void PackDirectionBatchScalar(const float* x, const float* y, const float* z, DirectionOct32* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = PackDirection32(Vector3{ x[i], y[i], z[i] });
+}
+
+template <typename D>
+RMAPI void UnpackDirectionBatchScalar(const D* in, float* outX, float* outY, float* outZ, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 result = UnpackDirection(in[i]);
+        outX[i] = result.x;
+        outY[i] = result.y;
+        outZ[i] = result.z;
+    }
+}
+
+#if SIMD_SSE
+// Four directions to snorm octahedron coordinates, same steps as OctProject()
+RMAPI void OctProjectSSE(__m128 x, __m128 y, __m128 z, __m128 scale, __m128i* outU, __m128i* outV)
+{
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    __m128 sum = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)), _mm_andnot_ps(signMask, z));
+    __m128 inv = _mm_and_ps(_mm_cmpgt_ps(sum, zero), _mm_div_ps(one, sum));
+    __m128 u = _mm_mul_ps(x, inv);
+    __m128 v = _mm_mul_ps(y, inv);
+
+    // sign(u) as +-1 with u >= 0 giving +1 (so -0 folds like +0, as in the scalar code)
+    __m128 signU = _mm_or_ps(one, _mm_andnot_ps(_mm_cmpge_ps(u, zero), signMask));
+    __m128 signV = _mm_or_ps(one, _mm_andnot_ps(_mm_cmpge_ps(v, zero), signMask));
+    __m128 foldU = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, v)), signU);
+    __m128 foldV = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, u)), signV);
+
+    __m128 lower = _mm_cmplt_ps(z, zero);
+    u = _mm_or_ps(_mm_and_ps(lower, foldU), _mm_andnot_ps(lower, u));
+    v = _mm_or_ps(_mm_and_ps(lower, foldV), _mm_andnot_ps(lower, v));
+
+    // Round to nearest even like lrintf() in the default rounding mode
+    *outU = _mm_cvtps_epi32(_mm_mul_ps(u, scale));
+    *outV = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+}
+
+// Four directions from octahedron coordinates, same steps as OctUnproject()
+RMAPI void OctUnprojectSSE(__m128 u, __m128 v, float* outX, float* outY, float* outZ)
+{
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    __m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, u)), _mm_andnot_ps(signMask, v));
+    __m128 t = _mm_max_ps(_mm_xor_ps(z, signMask), zero);
+    __m128 x = _mm_add_ps(u, _mm_xor_ps(t, _mm_and_ps(_mm_cmpge_ps(u, zero), signMask)));
+    __m128 y = _mm_add_ps(v, _mm_xor_ps(t, _mm_and_ps(_mm_cmpge_ps(v, zero), signMask)));
+
+    __m128 ilength = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z))));
+    _mm_storeu_ps(outX, _mm_mul_ps(x, ilength));
+    _mm_storeu_ps(outY, _mm_mul_ps(y, ilength));
+    _mm_storeu_ps(outZ, _mm_mul_ps(z, ilength));
+}
+
+RMAPI void PackDirectionBatchSSE(const float* x, const float* y, const float* z, DirectionOct16* out, int count)
+{
+    __m128 scale = _mm_set1_ps(127.0f);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i u[2], v[2];
+        OctProjectSSE(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i), scale, &u[0], &v[0]);
+        OctProjectSSE(_mm_loadu_ps(x + i + 4), _mm_loadu_ps(y + i + 4), _mm_loadu_ps(z + i + 4), scale, &u[1], &v[1]);
+
+        // u in the low byte, v in the high byte of each 16-bit element
+        __m128i lo = _mm_or_si128(_mm_and_si128(u[0], _mm_set1_epi32(0xff)), _mm_slli_epi32(v[0], 8));
+        __m128i hi = _mm_or_si128(_mm_and_si128(u[1], _mm_set1_epi32(0xff)), _mm_slli_epi32(v[1], 8));
+        _mm_storeu_si128((__m128i*)(out + i), PackLow16SSE(lo, hi));
+    }
+    PackDirectionBatchScalar(x + i, y + i, z + i, out + i, count - i);
+}
+
+RMAPI void PackDirectionBatchSSE(const float* x, const float* y, const float* z, DirectionOct32* out, int count)
+{
+    __m128 scale = _mm_set1_ps(32767.0f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i u, v;
+        OctProjectSSE(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i), scale, &u, &v);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_or_si128(_mm_and_si128(u, _mm_set1_epi32(0xffff)), _mm_slli_epi32(v, 16)));
+    }
+    PackDirectionBatchScalar(x + i, y + i, z + i, out + i, count - i);
+}
+
+RMAPI void UnpackDirectionBatchSSE(const DirectionOct16* in, float* outX, float* outY, float* outZ, int count)
+{
+    __m128 scale = _mm_set1_ps(1.0f/127.0f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // Four 16-bit elements to 32-bit lanes, then sign extend each byte
+        __m128i d = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)(in + i)), _mm_setzero_si128());
+        __m128 u = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(d, 24), 24));
+        __m128 v = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(d, 16), 24));
+        OctUnprojectSSE(_mm_mul_ps(u, scale), _mm_mul_ps(v, scale), outX + i, outY + i, outZ + i);
+    }
+    UnpackDirectionBatchScalar(in + i, outX + i, outY + i, outZ + i, count - i);
+}
+
+RMAPI void UnpackDirectionBatchSSE(const DirectionOct32* in, float* outX, float* outY, float* outZ, int count)
+{
+    __m128 scale = _mm_set1_ps(1.0f/32767.0f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)(in + i));
+        __m128 u = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(d, 16), 16));
+        __m128 v = _mm_cvtepi32_ps(_mm_srai_epi32(d, 16));
+        OctUnprojectSSE(_mm_mul_ps(u, scale), _mm_mul_ps(v, scale), outX + i, outY + i, outZ + i);
+    }
+    UnpackDirectionBatchScalar(in + i, outX + i, outY + i, outZ + i, count - i);
+}
+#endif // SIMD_SSE
+
+// Encode SoA unit vectors, the octahedral and quaternion kernels use SSE on AVX2 machines too
+RMAPI void PackDirectionBatch(const float* x, const float* y, const float* z, DirectionOct16* out, int count)
+{
+#if SIMD_SSE
+    if (GetSimdLevel() >= SIMD_LEVEL_SSE) { PackDirectionBatchSSE(x, y, z, out, count); return; }
+#endif
+    PackDirectionBatchScalar(x, y, z, out, count);
+}
+
+RMAPI void PackDirectionBatch(const float* x, const float* y, const float* z, DirectionOct32* out, int count)
+{
+#if SIMD_SSE
+    if (GetSimdLevel() >= SIMD_LEVEL_SSE) { PackDirectionBatchSSE(x, y, z, out, count); return; }
+#endif
+    PackDirectionBatchScalar(x, y, z, out, count);
+}
+
+// Decode unit vectors to SoA arrays
+RMAPI void UnpackDirectionBatch(const DirectionOct16* in, float* outX, float* outY, float* outZ, int count)
+{
+#if SIMD_SSE
+    if (GetSimdLevel() >= SIMD_LEVEL_SSE) { UnpackDirectionBatchSSE(in, outX, outY, outZ, count); return; }
+#endif
+    UnpackDirectionBatchScalar(in, outX, outY, outZ, count);
+}
+
+RMAPI void UnpackDirectionBatch(const DirectionOct32* in, float* outX, float* outY, float* outZ, int count)
+{
+#if SIMD_SSE
+    if (GetSimdLevel() >= SIMD_LEVEL_SSE) { UnpackDirectionBatchSSE(in, outX, outY, outZ, count); return; }
+#endif
+    UnpackDirectionBatchScalar(in, outX, outY, outZ, count);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Smallest three quaternions
+//----------------------------------------------------------------------------------
+
+// Compress a unit quaternion to 32 bits
+RMAPI QuaternionPacked PackQuaternion(Quaternion q)
+{
+    float c[4] = { q.x, q.y, q.z, q.w };
+
+    // Largest magnitude, first one on ties
+    int index = 0;
+    for (int k = 1; k < 4; k++) if (fabsf(c[k]) > fabsf(c[index])) index = k;
+    float sign = (c[index] < 0.0f) ? -1.0f : 1.0f;
+
+    // [-1/sqrt(2), 1/sqrt(2)] to [0, 1023]
+    const float scale = 1023.0f*0.5f/QUANTIZE_SQRT1_2;
+    uint32_t bits = (uint32_t)index << 30;
+    for (int k = 0, shift = 20; k < 4; k++)
+    {
+        if (k == index) continue;
+        float value = Clamp(c[k]*sign, -QUANTIZE_SQRT1_2, QUANTIZE_SQRT1_2);
+        bits |= (uint32_t)lrintf(value*scale + 511.5f) << shift;
+        shift -= 10;
+    }
+
+    QuaternionPacked result = { bits };
+
+    return result;
+}
+
+// Decompress a quaternion, the dropped component is rebuilt from the unit length
+RMAPI Quaternion UnpackQuaternion(QuaternionPacked packed)
+{
+    const float scale = QUANTIZE_SQRT1_2/(1023.0f*0.5f);
+    int index = (int)(packed.bits >> 30);
+    float a = (float)((packed.bits >> 20) & 1023)*scale - QUANTIZE_SQRT1_2;
+    float b = (float)((packed.bits >> 10) & 1023)*scale - QUANTIZE_SQRT1_2;
+    float c = (float)(packed.bits & 1023)*scale - QUANTIZE_SQRT1_2;
+    float largest = sqrtf(fmaxf(1.0f - a*a - b*b - c*c, 0.0f));
+
+    Quaternion result = { 0 };
+    switch (index)
+    {
+    case 0: result = Quaternion{ largest, a, b, c }; break;
+    case 1: result = Quaternion{ a, largest, b, c }; break;
+    case 2: result = Quaternion{ a, b, largest, c }; break;
+    default: result = Quaternion{ a, b, c, largest }; break;
+    }
+
+    return result;
+}
+
+RMAPI void PackQuaternionBatchScalar(QuaternionSoA q, QuaternionPacked* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = PackQuaternion(Quaternion{ q.x[i], q.y[i], q.z[i], q.w[i] });
+}
+
+RMAPI void UnpackQuaternionBatchScalar(const QuaternionPacked* in, QuaternionSoA out, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Quaternion result = UnpackQuaternion(in[i]);
+        out.x[i] = result.x;
+        out.y[i] = result.y;
+        out.z[i] = result.z;
+        out.w[i] = result.w;
+    }
+}
+
+#if SIMD_SSE
+RMAPI __m128 QuantizeSelectSSE(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+RMAPI void PackQuaternionBatchSSE(QuaternionSoA q, QuaternionPacked* out, int count)
+{
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 limit = _mm_set1_ps(QUANTIZE_SQRT1_2);
+    __m128 scale = _mm_set1_ps(1023.0f*0.5f/QUANTIZE_SQRT1_2);
+    __m128 offset = _mm_set1_ps(511.5f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(q.x + i);
+        __m128 y = _mm_loadu_ps(q.y + i);
+        __m128 z = _mm_loadu_ps(q.z + i);
+        __m128 w = _mm_loadu_ps(q.w + i);
+
+        // Index of the largest magnitude as three masks: index >= 1, >= 2, == 3 (first one on ties)
+        __m128 largest = _mm_andnot_ps(signMask, x);
+        __m128 isY = _mm_cmpgt_ps(_mm_andnot_ps(signMask, y), largest);
+        largest = _mm_max_ps(largest, _mm_andnot_ps(signMask, y));
+        __m128 isZ = _mm_cmpgt_ps(_mm_andnot_ps(signMask, z), largest);
+        largest = _mm_max_ps(largest, _mm_andnot_ps(signMask, z));
+        __m128 isW = _mm_cmpgt_ps(_mm_andnot_ps(signMask, w), largest);
+        __m128 atLeast2 = _mm_or_ps(isZ, isW);
+        __m128 atLeast1 = _mm_or_ps(isY, atLeast2);
+
+        // The three kept components in order, then flipped when the dropped one is negative
+        __m128 dropped = QuantizeSelectSSE(isW, w, QuantizeSelectSSE(isZ, z, QuantizeSelectSSE(isY, y, x)));
+        __m128 flip = _mm_and_ps(_mm_cmplt_ps(dropped, _mm_setzero_ps()), signMask);
+        __m128 a = _mm_xor_ps(QuantizeSelectSSE(atLeast1, x, y), flip);
+        __m128 b = _mm_xor_ps(QuantizeSelectSSE(atLeast2, y, z), flip);
+        __m128 c = _mm_xor_ps(QuantizeSelectSSE(isW, z, w), flip);
+
+        // Same clamp order as Clamp(value, min, max)
+        __m128 low = _mm_xor_ps(limit, signMask);
+        a = _mm_min_ps(_mm_max_ps(a, low), limit);
+        b = _mm_min_ps(_mm_max_ps(b, low), limit);
+        c = _mm_min_ps(_mm_max_ps(c, low), limit);
+
+        __m128i ia = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(a, scale), offset));
+        __m128i ib = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(b, scale), offset));
+        __m128i ic = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(c, scale), offset));
+
+        __m128i one = _mm_set1_epi32(1);
+        __m128i index = _mm_add_epi32(_mm_add_epi32(_mm_and_si128(_mm_castps_si128(atLeast1), one), _mm_and_si128(_mm_castps_si128(atLeast2), one)),
+            _mm_and_si128(_mm_castps_si128(isW), one));
+
+        __m128i bits = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(index, 30), _mm_slli_epi32(ia, 20)), _mm_or_si128(_mm_slli_epi32(ib, 10), ic));
+        _mm_storeu_si128((__m128i*)(out + i), bits);
+    }
+
+    QuaternionSoA tail = { q.x + i, q.y + i, q.z + i, q.w + i };
+    PackQuaternionBatchScalar(tail, out + i, count - i);
+}
+
+RMAPI void UnpackQuaternionBatchSSE(const QuaternionPacked* in, QuaternionSoA out, int count)
+{
+    __m128 scale = _mm_set1_ps(QUANTIZE_SQRT1_2/(1023.0f*0.5f));
+    __m128 offset = _mm_set1_ps(QUANTIZE_SQRT1_2);
+    __m128i mask = _mm_set1_epi32(1023);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i bits = _mm_loadu_si128((const __m128i*)(in + i));
+        __m128 a = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(bits, 20), mask)), scale), offset);
+        __m128 b = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(bits, 10), mask)), scale), offset);
+        __m128 c = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(bits, mask)), scale), offset);
+
+        // Same operation order as 1.0f - a*a - b*b - c*c
+        __m128 rest = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(a, a)), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+        __m128 largest = _mm_sqrt_ps(_mm_max_ps(rest, _mm_setzero_ps()));
+
+        __m128i index = _mm_srli_epi32(bits, 30);
+        __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()));
+        __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+        __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+        __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+
+        _mm_storeu_ps(out.x + i, QuantizeSelectSSE(is0, largest, a));
+        _mm_storeu_ps(out.y + i, QuantizeSelectSSE(is0, a, QuantizeSelectSSE(is1, largest, b)));
+        _mm_storeu_ps(out.z + i, QuantizeSelectSSE(is2, largest, QuantizeSelectSSE(is3, c, b)));
+        _mm_storeu_ps(out.w + i, QuantizeSelectSSE(is3, largest, c));
+    }
+
+    QuaternionSoA tail = { out.x + i, out.y + i, out.z + i, out.w + i };
+    UnpackQuaternionBatchScalar(in + i, tail, count - i);
+}
+#endif // SIMD_SSE
+
+// Compress an array of unit quaternions
+RMAPI void PackQuaternionBatch(QuaternionSoA q, QuaternionPacked* out, int count)
+{
+#if SIMD_SSE
+    if (GetSimdLevel() >= SIMD_LEVEL_SSE) { PackQuaternionBatchSSE(q, out, count); return; }
+#endif
+    PackQuaternionBatchScalar(q, out, count);
+}
+
+// Decompress an array of quaternions
+RMAPI void UnpackQuaternionBatch(const QuaternionPacked* in, QuaternionSoA out, int count)
+{
+#if SIMD_SSE
+    if (GetSimdLevel() >= SIMD_LEVEL_SSE) { UnpackQuaternionBatchSSE(in, out, count); return; }
+#endif
+    UnpackQuaternionBatchScalar(in, out, count);
+}
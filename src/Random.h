@@ -0,0 +1,328 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "Simd.h"
+
+//----------------------------------------------------------------------------------
+// Pseudo random number generation
+//
+// xoshiro128+ (Blackman, Vigna) with an explicit 128-bit state, seeded through splitmix64
+// Every thread gets its own default state, so Random() in Math.h needs no locking and
+// never shares hidden state between threads
+//
+// Seeding is deterministic: SeedRandom(seed) resets the calling thread, threads that
+// draw without seeding get stream N of RANDOM_DEFAULT_SEED in the order they first draw
+//
+// Usage:
+//   RandomState rng = CreateRandomState(1234);
+//   float x = RandomRange(&rng, -1.0f, 1.0f);
+//   RandomFill(&rng, lifetimes, count, 0.5f, 2.0f);
+//----------------------------------------------------------------------------------
+
+#ifndef RNGAPI
+#define RNGAPI inline
+#endif
+
+// Independent generators RandomFill interleaves, one per float of an AVX2 register
+#define RANDOM_LANES 8
+
+// Below this count RandomFill draws straight from the state, seeding the lanes costs more
+#ifndef RANDOM_FILL_MIN_COUNT
+#define RANDOM_FILL_MIN_COUNT 64
+#endif
+
+#ifndef RANDOM_DEFAULT_SEED
+#define RANDOM_DEFAULT_SEED 0x853c49e6748fea9bULL
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct RandomState {
+    uint32_t s[4];              // Generator state, never all zero
+} RandomState;
+
+// Lane generators used by RandomFill, state word k of lane l is s[k][l]
+typedef struct RandomLanes {
+    alignas(32) uint32_t s[4][RANDOM_LANES];
+} RandomLanes;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Advance a splitmix64 sequence, used to expand seeds into generator state
+RNGAPI uint64_t SplitMix64(uint64_t* x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+}
+
+// Seed a generator state, the same seed always produces the same sequence
+RNGAPI void SeedRandomState(RandomState* state, uint64_t seed)
+{
+    uint64_t a = SplitMix64(&seed);
+    uint64_t b = SplitMix64(&seed);
+
+    state->s[0] = (uint32_t)a;
+    state->s[1] = (uint32_t)(a >> 32);
+    state->s[2] = (uint32_t)b;
+    state->s[3] = (uint32_t)(b >> 32);
+
+    // All zero is the one state xoshiro never leaves
+    if ((a | b) == 0) state->s[0] = 1;
+}
+
+// Create a generator state from a seed
+RNGAPI RandomState CreateRandomState(uint64_t seed)
+{
+    RandomState result = { 0 };
+    SeedRandomState(&result, seed);
+
+    return result;
+}
+
+// Get the next 32 random bits
+// NOTE: xoshiro128+ low bits are weak, the float and integer functions only use the high bits
+RNGAPI uint32_t NextRandom(RandomState* state)
+{
+    uint32_t* s = state->s;
+    uint32_t result = s[0] + s[3];
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+
+    return result;
+}
+
+// Advance the state by 2^64 draws, gives non-overlapping streams for parallel work
+RNGAPI void JumpRandomState(RandomState* state)
+{
+    static const uint32_t jump[4] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+    uint32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        for (int b = 0; b < 32; b++)
+        {
+            if (jump[i] & (1u << b))
+            {
+                s0 ^= state->s[0];
+                s1 ^= state->s[1];
+                s2 ^= state->s[2];
+                s3 ^= state->s[3];
+            }
+            NextRandom(state);
+        }
+    }
+
+    state->s[0] = s0;
+    state->s[1] = s1;
+    state->s[2] = s2;
+    state->s[3] = s3;
+}
+
+// Convert random bits to a float in [0, 1), uses the top 24 bits so every value is exact
+RNGAPI float RandomBitsToFloat(uint32_t bits)
+{
+    return (float)(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+// Get a random float in [0, 1)
+RNGAPI float RandomFloat(RandomState* state)
+{
+    return RandomBitsToFloat(NextRandom(state));
+}
+
+// Get a random float in [min, max)
+RNGAPI float RandomRange(RandomState* state, float min, float max)
+{
+    return min + (max - min) * RandomFloat(state);
+}
+
+// Get a random integer in [min, max], multiply-shift instead of modulo (bias below range/2^32)
+RNGAPI int RandomInt(RandomState* state, int min, int max)
+{
+    uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+
+    return (int)((int64_t)min + (int64_t)(((uint64_t)NextRandom(state) * range) >> 32));
+}
+
+// Seed the lane generators from a state, advances the state by two draws per lane
+RNGAPI void SeedRandomLanes(RandomState* state, RandomLanes* lanes)
+{
+    for (int l = 0; l < RANDOM_LANES; l++)
+    {
+        // Two statements: the order of two calls in one expression is up to the compiler
+        uint64_t high = NextRandom(state);
+        uint64_t low = NextRandom(state);
+        RandomState lane = CreateRandomState((high << 32) | low);
+        for (int k = 0; k < 4; k++) lanes->s[k][l] = lane.s[k];
+    }
+}
+
+// Draw one float in [min, min + scale) from every lane
+RNGAPI void StepRandomLanes(RandomLanes* lanes, float min, float scale, float* out)
+{
+    for (int l = 0; l < RANDOM_LANES; l++)
+    {
+        RandomState lane = { { lanes->s[0][l], lanes->s[1][l], lanes->s[2][l], lanes->s[3][l] } };
+        out[l] = min + scale * RandomFloat(&lane);
+        for (int k = 0; k < 4; k++) lanes->s[k][l] = lane.s[k];
+    }
+}
+
+// Draws into 'out' in blocks of RANDOM_LANES, the last partial block is cut from a full step
+RNGAPI void RandomFillLanesScalar(RandomLanes* lanes, float* out, int count, float min, float max)
+{
+    float scale = max - min;
+    float block[RANDOM_LANES];
+    int i = 0;
+
+    for (; i + RANDOM_LANES <= count; i += RANDOM_LANES) StepRandomLanes(lanes, min, scale, out + i);
+
+    if (i < count)
+    {
+        StepRandomLanes(lanes, min, scale, block);
+        for (int l = 0; (l < RANDOM_LANES) && (i + l < count); l++) out[i + l] = block[l];
+    }
+}
+
+#if SIMD_SSE
+RNGAPI void RandomFillLanesSSE(RandomLanes* lanes, float* out, int count, float min, float max)
+{
+    float scale = max - min;
+    __m128 vmin = _mm_set1_ps(min);
+    __m128 vscale = _mm_set1_ps(scale);
+    __m128 vunit = _mm_set1_ps(1.0f / 16777216.0f);
+    int i = 0;
+
+    // Lanes 0-3 and 4-7 as two interleaved generators
+    for (int h = 0; h < RANDOM_LANES; h += 4)
+    {
+        __m128i s0 = _mm_load_si128((const __m128i*)&lanes->s[0][h]);
+        __m128i s1 = _mm_load_si128((const __m128i*)&lanes->s[1][h]);
+        __m128i s2 = _mm_load_si128((const __m128i*)&lanes->s[2][h]);
+        __m128i s3 = _mm_load_si128((const __m128i*)&lanes->s[3][h]);
+
+        for (i = 0; i + RANDOM_LANES <= count; i += RANDOM_LANES)
+        {
+            __m128i result = _mm_add_epi32(s0, s3);
+            __m128i t = _mm_slli_epi32(s1, 9);
+            s2 = _mm_xor_si128(s2, s0);
+            s3 = _mm_xor_si128(s3, s1);
+            s1 = _mm_xor_si128(s1, s2);
+            s0 = _mm_xor_si128(s0, s3);
+            s2 = _mm_xor_si128(s2, t);
+            s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+            __m128 f = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(result, 8)), vunit);
+            _mm_storeu_ps(out + i + h, _mm_add_ps(vmin, _mm_mul_ps(vscale, f)));
+        }
+
+        _mm_store_si128((__m128i*)&lanes->s[0][h], s0);
+        _mm_store_si128((__m128i*)&lanes->s[1][h], s1);
+        _mm_store_si128((__m128i*)&lanes->s[2][h], s2);
+        _mm_store_si128((__m128i*)&lanes->s[3][h], s3);
+    }
+
+    RandomFillLanesScalar(lanes, out + i, count - i, min, max);
+}
+#endif
+
+#if SIMD_X86
+SIMD_TARGET_AVX2 RNGAPI void RandomFillLanesAVX2(RandomLanes* lanes, float* out, int count, float min, float max)
+{
+    float scale = max - min;
+    __m256 vmin = _mm256_set1_ps(min);
+    __m256 vscale = _mm256_set1_ps(scale);
+    __m256 vunit = _mm256_set1_ps(1.0f / 16777216.0f);
+
+    __m256i s0 = _mm256_load_si256((const __m256i*)lanes->s[0]);
+    __m256i s1 = _mm256_load_si256((const __m256i*)lanes->s[1]);
+    __m256i s2 = _mm256_load_si256((const __m256i*)lanes->s[2]);
+    __m256i s3 = _mm256_load_si256((const __m256i*)lanes->s[3]);
+
+    int i = 0;
+    for (; i + RANDOM_LANES <= count; i += RANDOM_LANES)
+    {
+        __m256i result = _mm256_add_epi32(s0, s3);
+        __m256i t = _mm256_slli_epi32(s1, 9);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+
+        __m256 f = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(result, 8)), vunit);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(vmin, _mm256_mul_ps(vscale, f)));
+    }
+
+    _mm256_store_si256((__m256i*)lanes->s[0], s0);
+    _mm256_store_si256((__m256i*)lanes->s[1], s1);
+    _mm256_store_si256((__m256i*)lanes->s[2], s2);
+    _mm256_store_si256((__m256i*)lanes->s[3], s3);
+
+    RandomFillLanesScalar(lanes, out + i, count - i, min, max);
+}
+#endif
+
+// Fill an array with random floats in [min, max)
+// NOTE: Large fills run RANDOM_LANES generators seeded from the state side by side,
+// the output for a given state and count is the same on every SIMD level
+RNGAPI void RandomFill(RandomState* state, float* out, int count, float min, float max)
+{
+    if (count < RANDOM_FILL_MIN_COUNT)
+    {
+        // Work on a local copy so the state stays in registers
+        RandomState local = *state;
+        float scale = max - min;
+
+        for (int i = 0; i < count; i++) out[i] = min + scale * RandomFloat(&local);
+
+        *state = local;
+        return;
+    }
+
+    RandomLanes lanes;
+    SeedRandomLanes(state, &lanes);
+
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { RandomFillLanesAVX2(&lanes, out, count, min, max); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { RandomFillLanesSSE(&lanes, out, count, min, max); return; }
+#endif
+    RandomFillLanesScalar(&lanes, out, count, min, max);
+}
+
+// Get the calling thread's default generator state
+RNGAPI RandomState* GetThreadRandomState(void)
+{
+    static std::atomic<uint64_t> threadOrdinal(0);
+    thread_local bool initialized = false;
+    thread_local RandomState state;
+
+    if (!initialized)
+    {
+        SeedRandomState(&state, RANDOM_DEFAULT_SEED + threadOrdinal.fetch_add(1));
+        initialized = true;
+    }
+
+    return &state;
+}
+
+// Seed the calling thread's default generator
+RNGAPI void SeedRandom(uint64_t seed)
+{
+    SeedRandomState(GetThreadRandomState(), seed);
+}
@@ -0,0 +1,686 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include "Simd.h"
+#include <cfloat>
+#include <cmath>
+
+//----------------------------------------------------------------------------------
+// Ray packet kernels (SIMD ray vs triangle and ray vs box)
+//
+// GetRayCollisionTriangle() and GetRayCollisionBox() test one primitive per call. These
+// kernels test one ray against up to RAY_PACKET_WIDTH triangles or boxes, or up to
+// RAY_PACKET_WIDTH rays against one triangle or box, with Moller-Trumbore and the slab test
+//
+// Packets are SoA (one array per coordinate) with RAY_PACKET_WIDTH lanes and a lane count.
+// The AVX2 path tests the 8 lanes at once, the SSE path 4 lanes at a time and skips the
+// second half of packets of up to 4, the scalar path loops over the lanes
+//
+// Intersect*() kernels return a bit mask of the lanes hit and the distance of every lane
+// hit, GetRayCollision*() wrappers turn them into RayCollision (point and normal are only
+// computed for the hits that are returned)
+//
+// Usage:
+//   TrianglePacket triangles = TrianglePacketFromPoints(points, 8);      // p1, p2, p3 per triangle
+//   RayCollision hit = GetRayCollisionTrianglePacket(ray, &triangles, &lane);  // closest of 8
+//   RayPacket rays = RayPacketFromRays(bullets, 8);
+//   int mask = IntersectRayPacketBox(&rays, enemyBox, distances);       // 8 bullets, one box
+//
+// NOTE: Every path rounds like GetRayCollisionTriangle() and GetRayCollisionBox(): same
+// operations in the same order, no FMA, a true division for 1/det and 1/direction. Hits,
+// distances, points and normals match raylib bit for bit, including its conventions: no
+// back face culling, and a negative distance from GetRayCollisionBox() when the ray starts
+// inside the box (distances here are raylib's, the sign flip included)
+// NOTE: Bit for bit only without FP contraction, or the compiler fuses the scalar code (and
+// raylib's) into FMA: the CMake build passes -ffp-contract=off, MSVC builds must not use
+// /fp:contract or /fp:fast
+//----------------------------------------------------------------------------------
+
+#ifndef PACKETAPI
+#define PACKETAPI inline
+#endif
+
+#define RAY_PACKET_WIDTH 8
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct RayPacket {
+    alignas(32) float positionX[RAY_PACKET_WIDTH];
+    alignas(32) float positionY[RAY_PACKET_WIDTH];
+    alignas(32) float positionZ[RAY_PACKET_WIDTH];
+    alignas(32) float directionX[RAY_PACKET_WIDTH];
+    alignas(32) float directionY[RAY_PACKET_WIDTH];
+    alignas(32) float directionZ[RAY_PACKET_WIDTH];
+    int count;                      // Lanes in use, the others are ignored
+};
+
+// Triangles as the first point and the two edges Moller-Trumbore starts from
+struct TrianglePacket {
+    alignas(32) float p1X[RAY_PACKET_WIDTH];
+    alignas(32) float p1Y[RAY_PACKET_WIDTH];
+    alignas(32) float p1Z[RAY_PACKET_WIDTH];
+    alignas(32) float edge1X[RAY_PACKET_WIDTH];     // p2 - p1
+    alignas(32) float edge1Y[RAY_PACKET_WIDTH];
+    alignas(32) float edge1Z[RAY_PACKET_WIDTH];
+    alignas(32) float edge2X[RAY_PACKET_WIDTH];     // p3 - p1
+    alignas(32) float edge2Y[RAY_PACKET_WIDTH];
+    alignas(32) float edge2Z[RAY_PACKET_WIDTH];
+    int count;
+};
+
+struct BoxPacket {
+    alignas(32) float minX[RAY_PACKET_WIDTH];
+    alignas(32) float minY[RAY_PACKET_WIDTH];
+    alignas(32) float minZ[RAY_PACKET_WIDTH];
+    alignas(32) float maxX[RAY_PACKET_WIDTH];
+    alignas(32) float maxY[RAY_PACKET_WIDTH];
+    alignas(32) float maxZ[RAY_PACKET_WIDTH];
+    int count;
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Packets
+//----------------------------------------------------------------------------------
+
+// Pack up to RAY_PACKET_WIDTH rays
+PACKETAPI RayPacket RayPacketFromRays(const Ray* rays, int count)
+{
+    RayPacket packet = {};
+    packet.count = (count < RAY_PACKET_WIDTH) ? count : RAY_PACKET_WIDTH;
+    for (int i = 0; i < packet.count; i++)
+    {
+        packet.positionX[i] = rays[i].position.x;
+        packet.positionY[i] = rays[i].position.y;
+        packet.positionZ[i] = rays[i].position.z;
+        packet.directionX[i] = rays[i].direction.x;
+        packet.directionY[i] = rays[i].direction.y;
+        packet.directionZ[i] = rays[i].direction.z;
+    }
+
+    return packet;
+}
+
+// Pack up to RAY_PACKET_WIDTH triangles given as three points each (p1, p2, p3, p1, ...)
+// NOTE: The points are expected in counter-clockwise winding, like GetRayCollisionTriangle()
+PACKETAPI TrianglePacket TrianglePacketFromPoints(const Vector3* points, int count)
+{
+    TrianglePacket packet = {};
+    packet.count = (count < RAY_PACKET_WIDTH) ? count : RAY_PACKET_WIDTH;
+    for (int i = 0; i < packet.count; i++)
+    {
+        Vector3 p1 = points[3*i];
+        Vector3 edge1 = Subtract(points[3*i + 1], p1);
+        Vector3 edge2 = Subtract(points[3*i + 2], p1);
+        packet.p1X[i] = p1.x;
+        packet.p1Y[i] = p1.y;
+        packet.p1Z[i] = p1.z;
+        packet.edge1X[i] = edge1.x;
+        packet.edge1Y[i] = edge1.y;
+        packet.edge1Z[i] = edge1.z;
+        packet.edge2X[i] = edge2.x;
+        packet.edge2Y[i] = edge2.y;
+        packet.edge2Z[i] = edge2.z;
+    }
+
+    return packet;
+}
+
+// Pack up to RAY_PACKET_WIDTH boxes
+PACKETAPI BoxPacket BoxPacketFromBoxes(const BoundingBox* boxes, int count)
+{
+    BoxPacket packet = {};
+    packet.count = (count < RAY_PACKET_WIDTH) ? count : RAY_PACKET_WIDTH;
+    for (int i = 0; i < packet.count; i++)
+    {
+        packet.minX[i] = boxes[i].min.x;
+        packet.minY[i] = boxes[i].min.y;
+        packet.minZ[i] = boxes[i].min.z;
+        packet.maxX[i] = boxes[i].max.x;
+        packet.maxY[i] = boxes[i].max.y;
+        packet.maxZ[i] = boxes[i].max.z;
+    }
+
+    return packet;
+}
+
+PACKETAPI Ray GetPacketRay(const RayPacket* packet, int lane)
+{
+    return Ray{ Vector3{ packet->positionX[lane], packet->positionY[lane], packet->positionZ[lane] },
+        Vector3{ packet->directionX[lane], packet->directionY[lane], packet->directionZ[lane] } };
+}
+
+PACKETAPI BoundingBox GetPacketBox(const BoxPacket* packet, int lane)
+{
+    return BoundingBox{ Vector3{ packet->minX[lane], packet->minY[lane], packet->minZ[lane] }, Vector3{ packet->maxX[lane], packet->maxY[lane], packet->maxZ[lane] } };
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Scalar kernels
+//----------------------------------------------------------------------------------
+
+// Moller-Trumbore with the tests of GetRayCollisionTriangle(), distance in *distance
+PACKETAPI bool IntersectRayTriangleScalar(Ray ray, Vector3 p1, Vector3 edge1, Vector3 edge2, float* distance)
+{
+    Vector3 p = Cross(ray.direction, edge2);
+    float det = Dot(edge1, p);
+    if ((det > -EPSILON) && (det < EPSILON)) return false;
+
+    float invDet = 1.0f/det;
+    Vector3 tv = Subtract(ray.position, p1);
+    float u = Dot(tv, p)*invDet;
+    if ((u < 0.0f) || (u > 1.0f)) return false;
+
+    Vector3 q = Cross(tv, edge1);
+    float v = Dot(ray.direction, q)*invDet;
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return false;
+
+    *distance = Dot(edge2, q)*invDet;
+
+    return *distance > EPSILON;
+}
+
+// Slab test with the conventions of GetRayCollisionBox(), distance in *distance
+PACKETAPI bool IntersectRayBoxScalar(Ray ray, BoundingBox box, float* distance)
+{
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+    if (insideBox) ray.direction = Negate(ray.direction);
+
+    float invX = 1.0f/ray.direction.x;
+    float invY = 1.0f/ray.direction.y;
+    float invZ = 1.0f/ray.direction.z;
+    float t0 = (box.min.x - ray.position.x)*invX, t1 = (box.max.x - ray.position.x)*invX;
+    float t2 = (box.min.y - ray.position.y)*invY, t3 = (box.max.y - ray.position.y)*invY;
+    float t4 = (box.min.z - ray.position.z)*invZ, t5 = (box.max.z - ray.position.z)*invZ;
+    float tNear = fmaxf(fmaxf(fminf(t0, t1), fminf(t2, t3)), fminf(t4, t5));
+    float tFar = fminf(fminf(fmaxf(t0, t1), fmaxf(t2, t3)), fmaxf(t4, t5));
+
+    *distance = insideBox ? -tNear : tNear;
+
+    return !((tFar < 0) || (tNear > tFar));
+}
+
+PACKETAPI int IntersectTrianglePacketScalar(Ray ray, const TrianglePacket* packet, float* distances)
+{
+    int mask = 0;
+    for (int i = 0; i < packet->count; i++)
+    {
+        Vector3 p1 = { packet->p1X[i], packet->p1Y[i], packet->p1Z[i] };
+        Vector3 edge1 = { packet->edge1X[i], packet->edge1Y[i], packet->edge1Z[i] };
+        Vector3 edge2 = { packet->edge2X[i], packet->edge2Y[i], packet->edge2Z[i] };
+        if (IntersectRayTriangleScalar(ray, p1, edge1, edge2, &distances[i])) mask |= 1 << i;
+    }
+
+    return mask;
+}
+
+PACKETAPI int IntersectBoxPacketScalar(Ray ray, const BoxPacket* packet, float* distances)
+{
+    int mask = 0;
+    for (int i = 0; i < packet->count; i++) if (IntersectRayBoxScalar(ray, GetPacketBox(packet, i), &distances[i])) mask |= 1 << i;
+
+    return mask;
+}
+
+PACKETAPI int IntersectRayPacketTriangleScalar(const RayPacket* packet, Vector3 p1, Vector3 edge1, Vector3 edge2, float* distances)
+{
+    int mask = 0;
+    for (int i = 0; i < packet->count; i++) if (IntersectRayTriangleScalar(GetPacketRay(packet, i), p1, edge1, edge2, &distances[i])) mask |= 1 << i;
+
+    return mask;
+}
+
+PACKETAPI int IntersectRayPacketBoxScalar(const RayPacket* packet, BoundingBox box, float* distances)
+{
+    int mask = 0;
+    for (int i = 0; i < packet->count; i++) if (IntersectRayBoxScalar(GetPacketRay(packet, i), box, &distances[i])) mask |= 1 << i;
+
+    return mask;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - SSE kernels (4 lanes)
+//
+// One core per primitive works on lanes of rays and primitives, the entry points load or
+// broadcast whichever side is the packet
+//----------------------------------------------------------------------------------
+#if SIMD_SSE
+
+// fminf()/fmaxf() semantics: a NaN operand is ignored (min/max instructions return the second one)
+PACKETAPI __m128 FminPacketSSE(__m128 a, __m128 b)
+{
+    __m128 nanB = _mm_cmpunord_ps(b, b);
+    return _mm_or_ps(_mm_andnot_ps(nanB, _mm_min_ps(a, b)), _mm_and_ps(nanB, a));
+}
+
+PACKETAPI __m128 FmaxPacketSSE(__m128 a, __m128 b)
+{
+    __m128 nanB = _mm_cmpunord_ps(b, b);
+    return _mm_or_ps(_mm_andnot_ps(nanB, _mm_max_ps(a, b)), _mm_and_ps(nanB, a));
+}
+
+// ray: position xyz, direction xyz. triangle: p1 xyz, edge1 xyz, edge2 xyz. Returns the hit lanes
+PACKETAPI int IntersectTriangleLanesSSE(const __m128* ray, const __m128* triangle, float* distances)
+{
+    const __m128 epsilon = _mm_set1_ps(EPSILON);
+    __m128 dx = ray[3], dy = ray[4], dz = ray[5];
+    __m128 e1x = triangle[3], e1y = triangle[4], e1z = triangle[5];
+    __m128 e2x = triangle[6], e2y = triangle[7], e2z = triangle[8];
+
+    // p = Cross(direction, edge2), det = Dot(edge1, p)
+    __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+    __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+    __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+    __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+    __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+    // tv = position - p1, u = Dot(tv, p)*invDet
+    __m128 tvx = _mm_sub_ps(ray[0], triangle[0]);
+    __m128 tvy = _mm_sub_ps(ray[1], triangle[1]);
+    __m128 tvz = _mm_sub_ps(ray[2], triangle[2]);
+    __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tvx, px), _mm_mul_ps(tvy, py)), _mm_mul_ps(tvz, pz)), invDet);
+
+    // q = Cross(tv, edge1), v = Dot(direction, q)*invDet, t = Dot(edge2, q)*invDet
+    __m128 qx = _mm_sub_ps(_mm_mul_ps(tvy, e1z), _mm_mul_ps(tvz, e1y));
+    __m128 qy = _mm_sub_ps(_mm_mul_ps(tvz, e1x), _mm_mul_ps(tvx, e1z));
+    __m128 qz = _mm_sub_ps(_mm_mul_ps(tvx, e1y), _mm_mul_ps(tvy, e1x));
+    __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+    __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+
+    // Ordered compares are false for NaN, like the scalar branches
+    __m128 reject = _mm_and_ps(_mm_cmpgt_ps(det, _mm_set1_ps(-EPSILON)), _mm_cmplt_ps(det, epsilon));
+    reject = _mm_or_ps(reject, _mm_or_ps(_mm_cmplt_ps(u, _mm_setzero_ps()), _mm_cmpgt_ps(u, _mm_set1_ps(1.0f))));
+    reject = _mm_or_ps(reject, _mm_or_ps(_mm_cmplt_ps(v, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f))));
+    __m128 hit = _mm_andnot_ps(reject, _mm_cmpgt_ps(t, epsilon));
+
+    _mm_storeu_ps(distances, t);
+
+    return _mm_movemask_ps(hit);
+}
+
+// ray: position xyz, direction xyz. box: min xyz, max xyz. Returns the hit lanes
+PACKETAPI int IntersectBoxLanesSSE(const __m128* ray, const __m128* box, float* distances)
+{
+    __m128 ox = ray[0], oy = ray[1], oz = ray[2];
+    __m128 inside = _mm_and_ps(_mm_cmpgt_ps(ox, box[0]), _mm_cmplt_ps(ox, box[3]));
+    inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmpgt_ps(oy, box[1]), _mm_cmplt_ps(oy, box[4])));
+    inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmpgt_ps(oz, box[2]), _mm_cmplt_ps(oz, box[5])));
+
+    // Rays starting inside are reversed, and so is their distance
+    __m128 flip = _mm_and_ps(inside, _mm_set1_ps(-0.0f));
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 invX = _mm_div_ps(one, _mm_xor_ps(ray[3], flip));
+    __m128 invY = _mm_div_ps(one, _mm_xor_ps(ray[4], flip));
+    __m128 invZ = _mm_div_ps(one, _mm_xor_ps(ray[5], flip));
+
+    __m128 t0 = _mm_mul_ps(_mm_sub_ps(box[0], ox), invX), t1 = _mm_mul_ps(_mm_sub_ps(box[3], ox), invX);
+    __m128 t2 = _mm_mul_ps(_mm_sub_ps(box[1], oy), invY), t3 = _mm_mul_ps(_mm_sub_ps(box[4], oy), invY);
+    __m128 t4 = _mm_mul_ps(_mm_sub_ps(box[2], oz), invZ), t5 = _mm_mul_ps(_mm_sub_ps(box[5], oz), invZ);
+    __m128 tNear = FmaxPacketSSE(FmaxPacketSSE(FminPacketSSE(t0, t1), FminPacketSSE(t2, t3)), FminPacketSSE(t4, t5));
+    __m128 tFar = FminPacketSSE(FminPacketSSE(FmaxPacketSSE(t0, t1), FmaxPacketSSE(t2, t3)), FmaxPacketSSE(t4, t5));
+
+    __m128 miss = _mm_or_ps(_mm_cmplt_ps(tFar, _mm_setzero_ps()), _mm_cmpgt_ps(tNear, tFar));
+    _mm_storeu_ps(distances, _mm_xor_ps(tNear, flip));
+
+    return _mm_movemask_ps(miss) ^ 0xf;
+}
+
+PACKETAPI int IntersectTrianglePacketSSE(Ray ray, const TrianglePacket* packet, float* distances)
+{
+    __m128 lanes[6] = { _mm_set1_ps(ray.position.x), _mm_set1_ps(ray.position.y), _mm_set1_ps(ray.position.z),
+        _mm_set1_ps(ray.direction.x), _mm_set1_ps(ray.direction.y), _mm_set1_ps(ray.direction.z) };
+
+    int mask = 0;
+    for (int i = 0; i < packet->count; i += 4)
+    {
+        __m128 triangle[9] = { _mm_load_ps(packet->p1X + i), _mm_load_ps(packet->p1Y + i), _mm_load_ps(packet->p1Z + i),
+            _mm_load_ps(packet->edge1X + i), _mm_load_ps(packet->edge1Y + i), _mm_load_ps(packet->edge1Z + i),
+            _mm_load_ps(packet->edge2X + i), _mm_load_ps(packet->edge2Y + i), _mm_load_ps(packet->edge2Z + i) };
+        mask |= IntersectTriangleLanesSSE(lanes, triangle, distances + i) << i;
+    }
+
+    return mask & ((1 << packet->count) - 1);
+}
+
+PACKETAPI int IntersectBoxPacketSSE(Ray ray, const BoxPacket* packet, float* distances)
+{
+    __m128 lanes[6] = { _mm_set1_ps(ray.position.x), _mm_set1_ps(ray.position.y), _mm_set1_ps(ray.position.z),
+        _mm_set1_ps(ray.direction.x), _mm_set1_ps(ray.direction.y), _mm_set1_ps(ray.direction.z) };
+
+    int mask = 0;
+    for (int i = 0; i < packet->count; i += 4)
+    {
+        __m128 box[6] = { _mm_load_ps(packet->minX + i), _mm_load_ps(packet->minY + i), _mm_load_ps(packet->minZ + i),
+            _mm_load_ps(packet->maxX + i), _mm_load_ps(packet->maxY + i), _mm_load_ps(packet->maxZ + i) };
+        mask |= IntersectBoxLanesSSE(lanes, box, distances + i) << i;
+    }
+
+    return mask & ((1 << packet->count) - 1);
+}
+
+PACKETAPI int IntersectRayPacketTriangleSSE(const RayPacket* packet, Vector3 p1, Vector3 edge1, Vector3 edge2, float* distances)
+{
+    __m128 triangle[9] = { _mm_set1_ps(p1.x), _mm_set1_ps(p1.y), _mm_set1_ps(p1.z),
+        _mm_set1_ps(edge1.x), _mm_set1_ps(edge1.y), _mm_set1_ps(edge1.z),
+        _mm_set1_ps(edge2.x), _mm_set1_ps(edge2.y), _mm_set1_ps(edge2.z) };
+
+    int mask = 0;
+    for (int i = 0; i < packet->count; i += 4)
+    {
+        __m128 lanes[6] = { _mm_load_ps(packet->positionX + i), _mm_load_ps(packet->positionY + i), _mm_load_ps(packet->positionZ + i),
+            _mm_load_ps(packet->directionX + i), _mm_load_ps(packet->directionY + i), _mm_load_ps(packet->directionZ + i) };
+        mask |= IntersectTriangleLanesSSE(lanes, triangle, distances + i) << i;
+    }
+
+    return mask & ((1 << packet->count) - 1);
+}
+
+PACKETAPI int IntersectRayPacketBoxSSE(const RayPacket* packet, BoundingBox box, float* distances)
+{
+    __m128 bounds[6] = { _mm_set1_ps(box.min.x), _mm_set1_ps(box.min.y), _mm_set1_ps(box.min.z),
+        _mm_set1_ps(box.max.x), _mm_set1_ps(box.max.y), _mm_set1_ps(box.max.z) };
+
+    int mask = 0;
+    for (int i = 0; i < packet->count; i += 4)
+    {
+        __m128 lanes[6] = { _mm_load_ps(packet->positionX + i), _mm_load_ps(packet->positionY + i), _mm_load_ps(packet->positionZ + i),
+            _mm_load_ps(packet->directionX + i), _mm_load_ps(packet->directionY + i), _mm_load_ps(packet->directionZ + i) };
+        mask |= IntersectBoxLanesSSE(lanes, bounds, distances + i) << i;
+    }
+
+    return mask & ((1 << packet->count) - 1);
+}
+
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - AVX2 kernels (8 lanes)
+//----------------------------------------------------------------------------------
+#if SIMD_X86
+
+SIMD_TARGET_AVX2 PACKETAPI __m256 FminPacketAVX2(__m256 a, __m256 b)
+{
+    return _mm256_blendv_ps(_mm256_min_ps(a, b), a, _mm256_cmp_ps(b, b, _CMP_UNORD_Q));
+}
+
+SIMD_TARGET_AVX2 PACKETAPI __m256 FmaxPacketAVX2(__m256 a, __m256 b)
+{
+    return _mm256_blendv_ps(_mm256_max_ps(a, b), a, _mm256_cmp_ps(b, b, _CMP_UNORD_Q));
+}
+
+SIMD_TARGET_AVX2 PACKETAPI int IntersectTriangleLanesAVX2(const __m256* ray, const __m256* triangle, float* distances)
+{
+    const __m256 epsilon = _mm256_set1_ps(EPSILON);
+    __m256 dx = ray[3], dy = ray[4], dz = ray[5];
+    __m256 e1x = triangle[3], e1y = triangle[4], e1z = triangle[5];
+    __m256 e2x = triangle[6], e2y = triangle[7], e2z = triangle[8];
+
+    __m256 px = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+    __m256 py = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+    __m256 pz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+    __m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+    __m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+
+    __m256 tvx = _mm256_sub_ps(ray[0], triangle[0]);
+    __m256 tvy = _mm256_sub_ps(ray[1], triangle[1]);
+    __m256 tvz = _mm256_sub_ps(ray[2], triangle[2]);
+    __m256 u = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(tvx, px), _mm256_mul_ps(tvy, py)), _mm256_mul_ps(tvz, pz)), invDet);
+
+    __m256 qx = _mm256_sub_ps(_mm256_mul_ps(tvy, e1z), _mm256_mul_ps(tvz, e1y));
+    __m256 qy = _mm256_sub_ps(_mm256_mul_ps(tvz, e1x), _mm256_mul_ps(tvx, e1z));
+    __m256 qz = _mm256_sub_ps(_mm256_mul_ps(tvx, e1y), _mm256_mul_ps(tvy, e1x));
+    __m256 v = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, qx), _mm256_mul_ps(dy, qy)), _mm256_mul_ps(dz, qz)), invDet);
+    __m256 t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), invDet);
+
+    __m256 reject = _mm256_and_ps(_mm256_cmp_ps(det, _mm256_set1_ps(-EPSILON), _CMP_GT_OQ), _mm256_cmp_ps(det, epsilon, _CMP_LT_OQ));
+    reject = _mm256_or_ps(reject, _mm256_or_ps(_mm256_cmp_ps(u, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_cmp_ps(u, _mm256_set1_ps(1.0f), _CMP_GT_OQ)));
+    reject = _mm256_or_ps(reject, _mm256_or_ps(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_cmp_ps(_mm256_add_ps(u, v), _mm256_set1_ps(1.0f), _CMP_GT_OQ)));
+    __m256 hit = _mm256_andnot_ps(reject, _mm256_cmp_ps(t, epsilon, _CMP_GT_OQ));
+
+    _mm256_storeu_ps(distances, t);
+
+    return _mm256_movemask_ps(hit);
+}
+
+SIMD_TARGET_AVX2 PACKETAPI int IntersectBoxLanesAVX2(const __m256* ray, const __m256* box, float* distances)
+{
+    __m256 ox = ray[0], oy = ray[1], oz = ray[2];
+    __m256 inside = _mm256_and_ps(_mm256_cmp_ps(ox, box[0], _CMP_GT_OQ), _mm256_cmp_ps(ox, box[3], _CMP_LT_OQ));
+    inside = _mm256_and_ps(inside, _mm256_and_ps(_mm256_cmp_ps(oy, box[1], _CMP_GT_OQ), _mm256_cmp_ps(oy, box[4], _CMP_LT_OQ)));
+    inside = _mm256_and_ps(inside, _mm256_and_ps(_mm256_cmp_ps(oz, box[2], _CMP_GT_OQ), _mm256_cmp_ps(oz, box[5], _CMP_LT_OQ)));
+
+    __m256 flip = _mm256_and_ps(inside, _mm256_set1_ps(-0.0f));
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 invX = _mm256_div_ps(one, _mm256_xor_ps(ray[3], flip));
+    __m256 invY = _mm256_div_ps(one, _mm256_xor_ps(ray[4], flip));
+    __m256 invZ = _mm256_div_ps(one, _mm256_xor_ps(ray[5], flip));
+
+    __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(box[0], ox), invX), t1 = _mm256_mul_ps(_mm256_sub_ps(box[3], ox), invX);
+    __m256 t2 = _mm256_mul_ps(_mm256_sub_ps(box[1], oy), invY), t3 = _mm256_mul_ps(_mm256_sub_ps(box[4], oy), invY);
+    __m256 t4 = _mm256_mul_ps(_mm256_sub_ps(box[2], oz), invZ), t5 = _mm256_mul_ps(_mm256_sub_ps(box[5], oz), invZ);
+    __m256 tNear = FmaxPacketAVX2(FmaxPacketAVX2(FminPacketAVX2(t0, t1), FminPacketAVX2(t2, t3)), FminPacketAVX2(t4, t5));
+    __m256 tFar = FminPacketAVX2(FminPacketAVX2(FmaxPacketAVX2(t0, t1), FmaxPacketAVX2(t2, t3)), FmaxPacketAVX2(t4, t5));
+
+    __m256 miss = _mm256_or_ps(_mm256_cmp_ps(tFar, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_cmp_ps(tNear, tFar, _CMP_GT_OQ));
+    _mm256_storeu_ps(distances, _mm256_xor_ps(tNear, flip));
+
+    return _mm256_movemask_ps(miss) ^ 0xff;
+}
+
+SIMD_TARGET_AVX2 PACKETAPI int IntersectTrianglePacketAVX2(Ray ray, const TrianglePacket* packet, float* distances)
+{
+    __m256 lanes[6] = { _mm256_set1_ps(ray.position.x), _mm256_set1_ps(ray.position.y), _mm256_set1_ps(ray.position.z),
+        _mm256_set1_ps(ray.direction.x), _mm256_set1_ps(ray.direction.y), _mm256_set1_ps(ray.direction.z) };
+    __m256 triangle[9] = { _mm256_load_ps(packet->p1X), _mm256_load_ps(packet->p1Y), _mm256_load_ps(packet->p1Z),
+        _mm256_load_ps(packet->edge1X), _mm256_load_ps(packet->edge1Y), _mm256_load_ps(packet->edge1Z),
+        _mm256_load_ps(packet->edge2X), _mm256_load_ps(packet->edge2Y), _mm256_load_ps(packet->edge2Z) };
+
+    return IntersectTriangleLanesAVX2(lanes, triangle, distances) & ((1 << packet->count) - 1);
+}
+
+SIMD_TARGET_AVX2 PACKETAPI int IntersectBoxPacketAVX2(Ray ray, const BoxPacket* packet, float* distances)
+{
+    __m256 lanes[6] = { _mm256_set1_ps(ray.position.x), _mm256_set1_ps(ray.position.y), _mm256_set1_ps(ray.position.z),
+        _mm256_set1_ps(ray.direction.x), _mm256_set1_ps(ray.direction.y), _mm256_set1_ps(ray.direction.z) };
+    __m256 box[6] = { _mm256_load_ps(packet->minX), _mm256_load_ps(packet->minY), _mm256_load_ps(packet->minZ),
+        _mm256_load_ps(packet->maxX), _mm256_load_ps(packet->maxY), _mm256_load_ps(packet->maxZ) };
+
+    return IntersectBoxLanesAVX2(lanes, box, distances) & ((1 << packet->count) - 1);
+}
+
+SIMD_TARGET_AVX2 PACKETAPI int IntersectRayPacketTriangleAVX2(const RayPacket* packet, Vector3 p1, Vector3 edge1, Vector3 edge2, float* distances)
+{
+    __m256 lanes[6] = { _mm256_load_ps(packet->positionX), _mm256_load_ps(packet->positionY), _mm256_load_ps(packet->positionZ),
+        _mm256_load_ps(packet->directionX), _mm256_load_ps(packet->directionY), _mm256_load_ps(packet->directionZ) };
+    __m256 triangle[9] = { _mm256_set1_ps(p1.x), _mm256_set1_ps(p1.y), _mm256_set1_ps(p1.z),
+        _mm256_set1_ps(edge1.x), _mm256_set1_ps(edge1.y), _mm256_set1_ps(edge1.z),
+        _mm256_set1_ps(edge2.x), _mm256_set1_ps(edge2.y), _mm256_set1_ps(edge2.z) };
+
+    return IntersectTriangleLanesAVX2(lanes, triangle, distances) & ((1 << packet->count) - 1);
+}
+
+SIMD_TARGET_AVX2 PACKETAPI int IntersectRayPacketBoxAVX2(const RayPacket* packet, BoundingBox box, float* distances)
+{
+    __m256 lanes[6] = { _mm256_load_ps(packet->positionX), _mm256_load_ps(packet->positionY), _mm256_load_ps(packet->positionZ),
+        _mm256_load_ps(packet->directionX), _mm256_load_ps(packet->directionY), _mm256_load_ps(packet->directionZ) };
+    __m256 bounds[6] = { _mm256_set1_ps(box.min.x), _mm256_set1_ps(box.min.y), _mm256_set1_ps(box.min.z),
+        _mm256_set1_ps(box.max.x), _mm256_set1_ps(box.max.y), _mm256_set1_ps(box.max.z) };
+
+    return IntersectBoxLanesAVX2(lanes, bounds, distances) & ((1 << packet->count) - 1);
+}
+
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Dispatch (uses GetSimdLevel())
+//
+// Each returns the mask of the lanes hit (bit i for lane i) and writes the distance of
+// every lane hit to distances[RAY_PACKET_WIDTH]. Other lanes hold unspecified values
+//----------------------------------------------------------------------------------
+
+// Test one ray against every triangle of a packet
+PACKETAPI int IntersectTrianglePacket(Ray ray, const TrianglePacket* packet, float* distances)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) return IntersectTrianglePacketAVX2(ray, packet, distances);
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) return IntersectTrianglePacketSSE(ray, packet, distances);
+#endif
+    return IntersectTrianglePacketScalar(ray, packet, distances);
+}
+
+// Test one ray against every box of a packet
+PACKETAPI int IntersectBoxPacket(Ray ray, const BoxPacket* packet, float* distances)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) return IntersectBoxPacketAVX2(ray, packet, distances);
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) return IntersectBoxPacketSSE(ray, packet, distances);
+#endif
+    return IntersectBoxPacketScalar(ray, packet, distances);
+}
+
+// Test every ray of a packet against one triangle
+PACKETAPI int IntersectRayPacketTriangle(const RayPacket* packet, Vector3 p1, Vector3 p2, Vector3 p3, float* distances)
+{
+    Vector3 edge1 = Subtract(p2, p1);
+    Vector3 edge2 = Subtract(p3, p1);
+
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) return IntersectRayPacketTriangleAVX2(packet, p1, edge1, edge2, distances);
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) return IntersectRayPacketTriangleSSE(packet, p1, edge1, edge2, distances);
+#endif
+    return IntersectRayPacketTriangleScalar(packet, p1, edge1, edge2, distances);
+}
+
+// Test every ray of a packet against one box
+PACKETAPI int IntersectRayPacketBox(const RayPacket* packet, BoundingBox box, float* distances)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) return IntersectRayPacketBoxAVX2(packet, box, distances);
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) return IntersectRayPacketBoxSSE(packet, box, distances);
+#endif
+    return IntersectRayPacketBoxScalar(packet, box, distances);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - RayCollision results
+//----------------------------------------------------------------------------------
+
+// Collision info of a triangle hit at 'distance', as GetRayCollisionTriangle() fills it
+PACKETAPI RayCollision RayCollisionFromTriangle(Ray ray, Vector3 edge1, Vector3 edge2, float distance)
+{
+    RayCollision collision = { 0 };
+    collision.hit = true;
+    collision.distance = distance;
+    collision.normal = Normalize(Cross(edge1, edge2));
+    collision.point = Add(ray.position, Scale(ray.direction, distance));
+
+    return collision;
+}
+
+// Collision info of a box hit at 'distance', as GetRayCollisionBox() fills it
+// NOTE: For a ray starting inside, raylib computes the point along the reversed ray
+PACKETAPI RayCollision RayCollisionFromBox(Ray ray, BoundingBox box, float distance)
+{
+    RayCollision collision = { 0 };
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+    if (insideBox)
+    {
+        ray.direction = Negate(ray.direction);
+        distance = -distance;
+    }
+
+    collision.hit = true;
+    collision.distance = distance;
+    collision.point = Add(ray.position, Scale(ray.direction, distance));
+
+    // Scale the center to hit vector to the unit cube, the component beyond 1 is the face
+    collision.normal = Subtract(collision.point, Lerp(box.min, box.max, 0.5f));
+    collision.normal = Divide(Scale(collision.normal, 2.01f), Subtract(box.max, box.min));
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+    collision.normal = Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        collision.distance *= -1.0f;
+        collision.normal = Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Index of the closest lane hit, ties go to the lowest lane, -1 for none
+PACKETAPI int ClosestPacketLane(int mask, const float* distances)
+{
+    int closest = -1;
+    for (int i = 0; mask; i++, mask >>= 1)
+    {
+        if ((mask & 1) && ((closest < 0) || (distances[i] < distances[closest]))) closest = i;
+    }
+
+    return closest;
+}
+
+// Get collision info between ray and the closest triangle of a packet, its lane in *lane (-1 for none)
+PACKETAPI RayCollision GetRayCollisionTrianglePacket(Ray ray, const TrianglePacket* packet, int* lane = nullptr)
+{
+    RayCollision collision = { 0 };
+    alignas(32) float distances[RAY_PACKET_WIDTH];
+    int closest = ClosestPacketLane(IntersectTrianglePacket(ray, packet, distances), distances);
+    if (lane != nullptr) *lane = closest;
+    if (closest < 0) return collision;
+
+    Vector3 edge1 = { packet->edge1X[closest], packet->edge1Y[closest], packet->edge1Z[closest] };
+    Vector3 edge2 = { packet->edge2X[closest], packet->edge2Y[closest], packet->edge2Z[closest] };
+
+    return RayCollisionFromTriangle(ray, edge1, edge2, distances[closest]);
+}
+
+// Get collision info between ray and the closest box of a packet, its lane in *lane (-1 for none)
+PACKETAPI RayCollision GetRayCollisionBoxPacket(Ray ray, const BoxPacket* packet, int* lane = nullptr)
+{
+    RayCollision collision = { 0 };
+    alignas(32) float distances[RAY_PACKET_WIDTH];
+    int closest = ClosestPacketLane(IntersectBoxPacket(ray, packet, distances), distances);
+    if (lane != nullptr) *lane = closest;
+    if (closest < 0) return collision;
+
+    return RayCollisionFromBox(ray, GetPacketBox(packet, closest), distances[closest]);
+}
+
+// Get collision info between every ray of a packet and a triangle, one per lane in use
+PACKETAPI void GetRayPacketCollisionTriangle(const RayPacket* packet, Vector3 p1, Vector3 p2, Vector3 p3, RayCollision* collisions)
+{
+    alignas(32) float distances[RAY_PACKET_WIDTH];
+    int mask = IntersectRayPacketTriangle(packet, p1, p2, p3, distances);
+    for (int i = 0; i < packet->count; i++)
+    {
+        collisions[i] = RayCollision{ 0 };
+        if (mask & (1 << i)) collisions[i] = RayCollisionFromTriangle(GetPacketRay(packet, i), Subtract(p2, p1), Subtract(p3, p1), distances[i]);
+    }
+}
+
+// Get collision info between every ray of a packet and a box, one per lane in use
+PACKETAPI void GetRayPacketCollisionBox(const RayPacket* packet, BoundingBox box, RayCollision* collisions)
+{
+    alignas(32) float distances[RAY_PACKET_WIDTH];
+    int mask = IntersectRayPacketBox(packet, box, distances);
+    for (int i = 0; i < packet->count; i++)
+    {
+        collisions[i] = RayCollision{ 0 };
+        if (mask & (1 << i)) collisions[i] = RayCollisionFromBox(GetPacketRay(packet, i), box, distances[i]);
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+//----------------------------------------------------------------------------------
+// SIMD support detection
+//
+// SIMD_X86      : x86/x64 target, SSE/AVX intrinsics are available
+// SIMD_SSE      : SSE2 (and SSE4.1 when SIMD_SSE41) is enabled for the whole build
+// SIMD_AVX2     : AVX2 is enabled for the whole build (/arch:AVX2, -mavx2)
+//
+// Kernels that have an AVX2 path mark it with SIMD_TARGET_AVX2 so that it can be
+// compiled into an SSE build and selected at runtime with GetSimdLevel()
+//----------------------------------------------------------------------------------
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#else
+#define SIMD_X86 0
+#endif
+
+#if SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if SIMD_X86 && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SIMD_SSE 1
+#else
+#define SIMD_SSE 0
+#endif
+
+#if SIMD_X86 && (defined(__SSE4_1__) || defined(__AVX__))
+#define SIMD_SSE41 1
+#else
+#define SIMD_SSE41 0
+#endif
+
+#if SIMD_X86 && defined(__AVX2__)
+#define SIMD_AVX2 1
+#else
+#define SIMD_AVX2 0
+#endif
+
+// Function attributes enabling AVX2 (and F16C) code generation for a single function
+#if SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define SIMD_TARGET_F16C __attribute__((target("avx2,f16c")))
+#else
+#define SIMD_TARGET_AVX2
+#define SIMD_TARGET_F16C
+#endif
+
+#ifndef SIMDAPI
+#define SIMDAPI inline
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Instruction set used by the batch kernels
+typedef enum SimdLevel {
+    SIMD_LEVEL_SCALAR = 0,      // Plain C loops, always available
+    SIMD_LEVEL_SSE,             // 4-wide SSE2
+    SIMD_LEVEL_AVX2             // 8-wide AVX2
+} SimdLevel;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - CPU feature detection
+//----------------------------------------------------------------------------------
+
+// Query the best instruction set supported by the running CPU and OS
+SIMDAPI SimdLevel DetectSimdLevel(void)
+{
+#if SIMD_X86
+    unsigned int regs[4] = { 0 };
+
+#if defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 1);
+    for (int i = 0; i < 4; i++) regs[i] = (unsigned int)info[i];
+#else
+    __get_cpuid(1, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+
+    bool sse2 = (regs[3] & (1u << 26)) != 0;
+    bool osxsave = (regs[2] & (1u << 27)) != 0;
+    bool avx = (regs[2] & (1u << 28)) != 0;
+    bool f16c = (regs[2] & (1u << 29)) != 0;
+
+    if (!sse2) return SIMD_LEVEL_SCALAR;
+    if (!(osxsave && avx)) return SIMD_LEVEL_SSE;
+
+    // The OS must save the YMM state on context switches (XCR0 bits 1 and 2)
+#if defined(_MSC_VER)
+    unsigned long long xcr0 = _xgetbv(0);
+#else
+    unsigned int xcrLo = 0, xcrHi = 0;
+    __asm__ volatile("xgetbv" : "=a"(xcrLo), "=d"(xcrHi) : "c"(0));
+    unsigned long long xcr0 = ((unsigned long long)xcrHi << 32) | xcrLo;
+#endif
+    if ((xcr0 & 0x6) != 0x6) return SIMD_LEVEL_SSE;
+
+#if defined(_MSC_VER)
+    __cpuidex(info, 7, 0);
+    for (int i = 0; i < 4; i++) regs[i] = (unsigned int)info[i];
+#else
+    __get_cpuid_count(7, 0, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+    bool avx2 = (regs[1] & (1u << 5)) != 0;
+
+    // The AVX2 kernels also use the F16C half conversions, every AVX2 CPU has them
+    return (avx2 && f16c) ? SIMD_LEVEL_AVX2 : SIMD_LEVEL_SSE;
+#else
+    return SIMD_LEVEL_SCALAR;
+#endif
+}
+
+// Storage for the active level, detected on first use
+SIMDAPI SimdLevel& SimdLevelRef(void)
+{
+    static SimdLevel level = DetectSimdLevel();
+
+    return level;
+}
+
+// Get instruction set used by the batch kernels
+SIMDAPI SimdLevel GetSimdLevel(void)
+{
+    return SimdLevelRef();
+}
+
+// Force the batch kernels onto a given instruction set (clamped to what the CPU supports)
+// NOTE: Useful to benchmark or validate the scalar fallback on a SIMD capable machine
+SIMDAPI void SetSimdLevel(SimdLevel level)
+{
+    SimdLevel supported = DetectSimdLevel();
+    SimdLevelRef() = (level > supported) ? supported : level;
+}
+
+// Get a printable name for an instruction set
+SIMDAPI const char* SimdLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+    case SIMD_LEVEL_SSE: return "SSE";
+    case SIMD_LEVEL_AVX2: return "AVX2";
+    default: return "Scalar";
+    }
+}
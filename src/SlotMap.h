@@ -0,0 +1,198 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Slot map with generational handles
+//
+// Stable references to objects that are created and destroyed all the time (bullets,
+// particles, loaded Texture2D/Sound/Model). Values live in a dense array that is iterated
+// like a vector, a handle names a slot that points to the value's current position:
+// insert, erase and lookup are O(1), erase moves the last value into the hole
+//
+// Each slot counts how often it was reused (generation), a handle remembers the generation
+// of its slot when it was issued. A handle to an erased value no longer matches its slot:
+//   - FindSlot() and IsSlotValid() always check the generation, null/false for stale handles
+//   - GetSlot() checks it with assert() only, in release builds (NDEBUG) it is a plain lookup
+//
+// Handles:
+//   SlotHandle      64-bit: 32-bit index, 32-bit generation
+//   SlotHandle32    32-bit: 20-bit index (1M slots), 12-bit generation
+//
+// Usage:
+//   SlotMap<Texture2D, SlotHandle32> textures;
+//   SlotHandle32 wall = InsertSlot(&textures, LoadTexture("wall.png"));
+//   DrawTexture(*GetSlot(&textures, wall), 0, 0, WHITE);
+//   for (Texture2D& texture : textures.values) UnloadTexture(texture);
+//
+// NOTE: Free slots are reused oldest first, so a slot's generation only wraps around after
+// it was reused 2^12 - 1 (SlotHandle32) or 2^32 - 1 (SlotHandle) times: a handle kept that
+// long may see the value that replaced its own
+// NOTE: Pointers to values are invalidated by InsertSlot() and EraseSlot(), keep handles
+//----------------------------------------------------------------------------------
+
+#ifndef SLOTAPI
+#define SLOTAPI inline
+#endif
+
+#define SLOT_NONE 0xffffffffu
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Generation 0 is never issued: a zero handle is the null handle
+struct SlotHandle {
+    uint32_t index;
+    uint32_t generation;
+};
+
+struct SlotHandle32 {
+    uint32_t value;                 // Index in the low 20 bits, generation in the high 12 bits
+};
+
+template <typename H> struct SlotHandleTraits;
+
+template <> struct SlotHandleTraits<SlotHandle> {
+    static constexpr uint32_t MAX_SLOTS = 0xfffffffeu;
+    static constexpr uint32_t GENERATION_MASK = 0xffffffffu;
+    static SlotHandle Make(uint32_t index, uint32_t generation) { return SlotHandle{ index, generation }; }
+    static uint32_t Index(SlotHandle handle) { return handle.index; }
+    static uint32_t Generation(SlotHandle handle) { return handle.generation; }
+};
+
+template <> struct SlotHandleTraits<SlotHandle32> {
+    static constexpr uint32_t MAX_SLOTS = 1u << 20;
+    static constexpr uint32_t GENERATION_MASK = 0xfffu;
+    static SlotHandle32 Make(uint32_t index, uint32_t generation) { return SlotHandle32{ index | (generation << 20) }; }
+    static uint32_t Index(SlotHandle32 handle) { return handle.value & 0xfffffu; }
+    static uint32_t Generation(SlotHandle32 handle) { return handle.value >> 20; }
+};
+
+struct SlotMapSlot {
+    uint32_t dense;                 // Position of the value, next free slot while free
+    uint32_t generation;            // Generation of the current (or next) value
+};
+
+template <typename T, typename H = SlotHandle>
+struct SlotMap {
+    std::vector<T> values;          // Dense values, in no particular order
+    std::vector<H> handles;         // Handle of each value in 'values'
+    std::vector<SlotMapSlot> slots;
+    uint32_t freeHead = SLOT_NONE;  // Oldest free slot
+    uint32_t freeTail = SLOT_NONE;  // Newest free slot
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+template <typename T, typename H>
+SLOTAPI bool IsSlotValid(const SlotMap<T, H>* map, H handle)
+{
+    typedef SlotHandleTraits<H> Traits;
+    uint32_t index = Traits::Index(handle);
+
+    // Erasing bumps the generation, so a free slot never matches an issued handle
+    return (index < map->slots.size()) && (Traits::Generation(handle) != 0) && (map->slots[index].generation == Traits::Generation(handle));
+}
+
+// Store a value and return its handle, a null handle when every slot of H is in use
+template <typename T, typename H>
+SLOTAPI H InsertSlot(SlotMap<T, H>* map, T value)
+{
+    typedef SlotHandleTraits<H> Traits;
+
+    uint32_t index = map->freeHead;
+    if (index != SLOT_NONE)
+    {
+        map->freeHead = map->slots[index].dense;
+        if (map->freeHead == SLOT_NONE) map->freeTail = SLOT_NONE;
+    }
+    else
+    {
+        if (map->slots.size() >= Traits::MAX_SLOTS) return Traits::Make(0, 0);
+        index = (uint32_t)map->slots.size();
+        map->slots.push_back(SlotMapSlot{ 0, 1 });
+    }
+
+    SlotMapSlot& slot = map->slots[index];
+    slot.dense = (uint32_t)map->values.size();
+    H handle = Traits::Make(index, slot.generation);
+    map->values.push_back(std::move(value));
+    map->handles.push_back(handle);
+
+    return handle;
+}
+
+// Erase the value of a handle, false when the handle is stale
+template <typename T, typename H>
+SLOTAPI bool EraseSlot(SlotMap<T, H>* map, H handle)
+{
+    typedef SlotHandleTraits<H> Traits;
+    if (!IsSlotValid(map, handle)) return false;
+
+    // Fill the hole with the last value
+    uint32_t index = Traits::Index(handle);
+    SlotMapSlot& slot = map->slots[index];
+    uint32_t last = (uint32_t)map->values.size() - 1;
+    if (slot.dense != last)
+    {
+        map->values[slot.dense] = std::move(map->values[last]);
+        map->handles[slot.dense] = map->handles[last];
+        map->slots[Traits::Index(map->handles[last])].dense = slot.dense;
+    }
+    map->values.pop_back();
+    map->handles.pop_back();
+
+    // Next generation (never 0), then queue the slot behind the other free ones
+    slot.generation = (slot.generation + 1) & Traits::GENERATION_MASK;
+    if (slot.generation == 0) slot.generation = 1;
+    slot.dense = SLOT_NONE;
+    if (map->freeTail != SLOT_NONE) map->slots[map->freeTail].dense = index;
+    else map->freeHead = index;
+    map->freeTail = index;
+
+    return true;
+}
+
+// Value of a live handle
+// NOTE: Stale handles are only caught by assert(), use FindSlot() when the handle may be stale
+template <typename T, typename H>
+SLOTAPI T* GetSlot(SlotMap<T, H>* map, H handle)
+{
+    assert(IsSlotValid(map, handle) && "Stale slot map handle");
+
+    return &map->values[map->slots[SlotHandleTraits<H>::Index(handle)].dense];
+}
+
+// Value of a handle, null when the handle is stale
+template <typename T, typename H>
+SLOTAPI T* FindSlot(SlotMap<T, H>* map, H handle)
+{
+    return IsSlotValid(map, handle) ? &map->values[map->slots[SlotHandleTraits<H>::Index(handle)].dense] : nullptr;
+}
+
+template <typename T, typename H>
+SLOTAPI int GetSlotMapCount(const SlotMap<T, H>* map)
+{
+    return (int)map->values.size();
+}
+
+// Preallocate for 'count' values, so that inserting up to there does not allocate
+template <typename T, typename H>
+SLOTAPI void ReserveSlotMap(SlotMap<T, H>* map, int count)
+{
+    map->values.reserve(count);
+    map->handles.reserve(count);
+    map->slots.reserve(count);
+}
+
+// Erase every value, the handles issued so far all become stale
+template <typename T, typename H>
+SLOTAPI void ClearSlotMap(SlotMap<T, H>* map)
+{
+    while (!map->handles.empty()) EraseSlot(map, map->handles.back());
+}
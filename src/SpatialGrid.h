@@ -0,0 +1,287 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Uniform spatial hash grid (2D broadphase)
+//
+// Space is cut into square cells of 'cellSize', an unbounded world maps the cells into a
+// power of two table by hashing their coordinates. Each object is stored by its bounding box
+// in every cell the box touches. The grid is rebuilt from scratch every tick with a counting
+// sort: two linear passes and no per-cell allocation, cheaper than updating it in place
+// when most objects move
+//
+// Overlapping pairs are found per table entry. A pair that shares several cells is only
+// reported by the cell holding the top-left corner of the two boxes' intersection, so every
+// pair comes out once without a hash set
+//
+// Usage:
+//   SpatialGrid grid = CreateSpatialGrid(4.0f*maxRadius, 0);
+//   BuildSpatialGridCircles(&grid, centers, radii, count);
+//   FindSpatialGridPairs(&grid, &pairs);
+//   for (GridPair pair : pairs) if (CheckCollisionCircles(...)) ...     // narrowphase
+//   QuerySpatialGridCircle(&grid, GetMousePosition(), 50.0f, &found);
+//
+// NOTE: Pairs and query results test the bounding boxes only, the narrowphase decides
+// NOTE: A cellSize of one to two object diameters works best: smaller cells store every object
+// several times, an object much larger than a cell is stored in every cell it covers
+//----------------------------------------------------------------------------------
+
+#ifndef GRIDAPI
+#define GRIDAPI inline
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct GridBox {
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+};
+
+struct GridPair {
+    int a;                          // Smaller object index
+    int b;
+};
+
+struct SpatialGrid {
+    float cellSize;
+    float inverseCellSize;
+    int requestedTableSize;         // 0: twice the object count
+    unsigned int tableMask;         // Table size - 1
+    std::vector<GridBox> boxes;     // By object index
+    std::vector<int> cellStart;     // Objects of table entry i: cellItems[cellStart[i]..cellStart[i + 1])
+    std::vector<int> cellItems;
+    std::vector<GridBox> cellBoxes;         // Copy of the box of each cellItems entry, read in order by the pair search
+    std::vector<unsigned int> itemEntries;  // Build scratch: table entry of each (object, cell)
+    std::vector<int> itemObjects;           // Build scratch: object of each (object, cell)
+    std::vector<unsigned int> queryMarks;   // Query dedup, by object
+    unsigned int queryStamp;
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+GRIDAPI GridBox GridBoxFromCircle(Vector2 center, float radius)
+{
+    return GridBox{ center.x - radius, center.y - radius, center.x + radius, center.y + radius };
+}
+
+GRIDAPI GridBox GridBoxFromRec(Rectangle rec)
+{
+    return GridBox{ rec.x, rec.y, rec.x + rec.width, rec.y + rec.height };
+}
+
+// Closed intervals, so that touching circles are reported like CheckCollisionCircles() does
+GRIDAPI bool GridBoxesOverlap(GridBox a, GridBox b)
+{
+    return (a.minX <= b.maxX) && (b.minX <= a.maxX) && (a.minY <= b.maxY) && (b.minY <= a.maxY);
+}
+
+// floorf() is a library call without SSE4.1, truncate and step down for negative fractions
+GRIDAPI int GridCell(const SpatialGrid* grid, float coordinate)
+{
+    float scaled = coordinate*grid->inverseCellSize;
+    int cell = (int)scaled;
+
+    return cell - (scaled < (float)cell);
+}
+
+GRIDAPI unsigned int GridEntry(const SpatialGrid* grid, int cellX, int cellY)
+{
+    return (((unsigned int)cellX*73856093u) ^ ((unsigned int)cellY*19349663u)) & grid->tableMask;
+}
+
+// Create an empty grid, tableSize 0 sizes the table to the object count at every build
+GRIDAPI SpatialGrid CreateSpatialGrid(float cellSize, int tableSize)
+{
+    SpatialGrid grid = {};
+    grid.cellSize = cellSize;
+    grid.inverseCellSize = 1.0f/cellSize;
+    grid.requestedTableSize = tableSize;
+
+    return grid;
+}
+
+// Rebuild the table from grid->boxes
+GRIDAPI void RebuildSpatialGrid(SpatialGrid* grid)
+{
+    int count = (int)grid->boxes.size();
+    unsigned int tableSize = 64;
+    unsigned int wanted = (grid->requestedTableSize > 0) ? (unsigned int)grid->requestedTableSize : 2u*(unsigned int)count;
+    while (tableSize < wanted) tableSize *= 2;
+    grid->tableMask = tableSize - 1;
+
+    grid->cellStart.assign(tableSize + 1, 0);
+    grid->itemEntries.clear();
+    grid->itemObjects.clear();
+    if ((int)grid->queryMarks.size() < count) grid->queryMarks.resize(count, 0);
+
+    // Table entries of every cell each box touches, counted per entry
+    for (int i = 0; i < count; i++)
+    {
+        const GridBox& box = grid->boxes[i];
+        int x0 = GridCell(grid, box.minX), x1 = GridCell(grid, box.maxX);
+        int y0 = GridCell(grid, box.minY), y1 = GridCell(grid, box.maxY);
+        size_t first = grid->itemEntries.size();
+
+        for (int y = y0; y <= y1; y++)
+        {
+            for (int x = x0; x <= x1; x++)
+            {
+                // Two cells of the same box can hash to the same entry, store the box once
+                unsigned int entry = GridEntry(grid, x, y);
+                bool stored = false;
+                for (size_t k = first; k < grid->itemEntries.size() && !stored; k++) stored = (grid->itemEntries[k] == entry);
+                if (stored) continue;
+
+                grid->itemEntries.push_back(entry);
+                grid->itemObjects.push_back(i);
+                grid->cellStart[entry + 1]++;
+            }
+        }
+    }
+
+    // Counting sort by entry, the scatter advances every start to the start of the next entry
+    for (unsigned int i = 0; i < tableSize; i++) grid->cellStart[i + 1] += grid->cellStart[i];
+    grid->cellItems.resize(grid->itemEntries.size());
+    grid->cellBoxes.resize(grid->itemEntries.size());
+    for (size_t k = 0; k < grid->itemEntries.size(); k++)
+    {
+        int slot = grid->cellStart[grid->itemEntries[k]]++;
+        grid->cellItems[slot] = grid->itemObjects[k];
+        grid->cellBoxes[slot] = grid->boxes[grid->itemObjects[k]];
+    }
+    for (unsigned int i = tableSize; i > 0; i--) grid->cellStart[i] = grid->cellStart[i - 1];
+    grid->cellStart[0] = 0;
+}
+
+// Rebuild the grid over 'count' bounding boxes, object i is boxes[i]
+GRIDAPI void BuildSpatialGrid(SpatialGrid* grid, const GridBox* boxes, int count)
+{
+    grid->boxes.assign(boxes, boxes + count);
+    RebuildSpatialGrid(grid);
+}
+
+GRIDAPI void BuildSpatialGridCircles(SpatialGrid* grid, const Vector2* centers, const float* radii, int count)
+{
+    grid->boxes.resize(count);
+    for (int i = 0; i < count; i++) grid->boxes[i] = GridBoxFromCircle(centers[i], radii[i]);
+    RebuildSpatialGrid(grid);
+}
+
+GRIDAPI void BuildSpatialGridRecs(SpatialGrid* grid, const Rectangle* recs, int count)
+{
+    grid->boxes.resize(count);
+    for (int i = 0; i < count; i++) grid->boxes[i] = GridBoxFromRec(recs[i]);
+    RebuildSpatialGrid(grid);
+}
+
+// Replace 'pairs' with every pair of objects whose boxes overlap, each pair once
+GRIDAPI int FindSpatialGridPairs(const SpatialGrid* grid, std::vector<GridPair>* pairs)
+{
+    pairs->clear();
+
+    unsigned int tableSize = grid->tableMask + 1;
+    const GridBox* boxes = grid->cellBoxes.data();
+    for (unsigned int entry = 0; entry < tableSize; entry++)
+    {
+        int start = grid->cellStart[entry];
+        int end = grid->cellStart[entry + 1];
+
+        for (int i = start; i < end; i++)
+        {
+            GridBox boxA = boxes[i];
+            for (int j = i + 1; j < end; j++)
+            {
+                GridBox boxB = boxes[j];
+                if (!GridBoxesOverlap(boxA, boxB)) continue;
+
+                // Only the entry of the cell holding the intersection's top-left corner reports the pair
+                int ownerX = GridCell(grid, fmaxf(boxA.minX, boxB.minX));
+                int ownerY = GridCell(grid, fmaxf(boxA.minY, boxB.minY));
+                if (GridEntry(grid, ownerX, ownerY) != entry) continue;
+
+                int a = grid->cellItems[i];
+                int b = grid->cellItems[j];
+                pairs->push_back((a < b) ? GridPair{ a, b } : GridPair{ b, a });
+            }
+        }
+    }
+
+    return (int)pairs->size();
+}
+
+// Append to 'results' the objects whose boxes overlap 'box', returns how many were added
+GRIDAPI int QuerySpatialGridBox(SpatialGrid* grid, GridBox box, std::vector<int>* results)
+{
+    size_t before = results->size();
+    int x0 = GridCell(grid, box.minX), x1 = GridCell(grid, box.maxX);
+    int y0 = GridCell(grid, box.minY), y1 = GridCell(grid, box.maxY);
+
+    // Wider than the table: every entry would be visited anyway, test the boxes directly
+    if ((double)(x1 - x0 + 1)*(double)(y1 - y0 + 1) > (double)(grid->tableMask + 1))
+    {
+        for (int i = 0; i < (int)grid->boxes.size(); i++)
+        {
+            if (GridBoxesOverlap(grid->boxes[i], box)) results->push_back(i);
+        }
+
+        return (int)(results->size() - before);
+    }
+
+    // An object stored in several of the visited cells is reported once
+    if (++grid->queryStamp == 0)
+    {
+        std::fill(grid->queryMarks.begin(), grid->queryMarks.end(), 0);
+        grid->queryStamp = 1;
+    }
+    for (int y = y0; y <= y1; y++)
+    {
+        for (int x = x0; x <= x1; x++)
+        {
+            unsigned int entry = GridEntry(grid, x, y);
+            for (int i = grid->cellStart[entry]; i < grid->cellStart[entry + 1]; i++)
+            {
+                int object = grid->cellItems[i];
+                if (grid->queryMarks[object] == grid->queryStamp) continue;
+
+                grid->queryMarks[object] = grid->queryStamp;
+                if (GridBoxesOverlap(grid->boxes[object], box)) results->push_back(object);
+            }
+        }
+    }
+
+    return (int)(results->size() - before);
+}
+
+GRIDAPI int QuerySpatialGridRec(SpatialGrid* grid, Rectangle rec, std::vector<int>* results)
+{
+    return QuerySpatialGridBox(grid, GridBoxFromRec(rec), results);
+}
+
+// Append the objects whose boxes are within 'radius' of 'center'
+GRIDAPI int QuerySpatialGridCircle(SpatialGrid* grid, Vector2 center, float radius, std::vector<int>* results)
+{
+    size_t before = results->size();
+    QuerySpatialGridBox(grid, GridBoxFromCircle(center, radius), results);
+
+    // Drop the boxes that only touch the circle's bounding square
+    size_t kept = before;
+    for (size_t i = before; i < results->size(); i++)
+    {
+        const GridBox& box = grid->boxes[(*results)[i]];
+        float dx = center.x - Clamp(center.x, box.minX, box.maxX);
+        float dy = center.y - Clamp(center.y, box.minY, box.maxY);
+        if (dx*dx + dy*dy <= radius*radius) (*results)[kept++] = (*results)[i];
+    }
+    results->resize(kept);
+
+    return (int)(kept - before);
+}
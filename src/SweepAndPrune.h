@@ -0,0 +1,335 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include "Simd.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Sort and sweep broadphase (2D, sweep along x)
+//
+// Boxes are kept sorted by their left edge in SoA arrays (minX, maxX, minY, maxY and the
+// object of each slot). Every update copies the new boxes into the slots in last frame's
+// order and restores the order with an insertion sort: objects only pass a few neighbours
+// per frame, so this is close to one linear pass. A scene that changed too much (first
+// update, teleports) falls back to a full sort
+//
+// The sweep walks the sorted boxes: box i only has to be tested against the boxes that start
+// before its right edge, and those follow it in the arrays. They are tested 4 (SSE) or 8
+// (AVX2) at a time, y overlap included, and the hits go straight into a flat pair array
+//
+// Best when the objects spread along x, as in a side-scroller: the number of boxes each
+// sweep passes over grows with the crowding along the sweep axis, not with the area
+//
+// Usage:
+//   SweepAndPrune sap = CreateSweepAndPrune();
+//   UpdateSweepAndPrune(&sap, recs, count);                // every tick, after the moves
+//   FindSweepPairs(&sap, &pairs);
+//   for (SweepPair pair : pairs) if (CheckCollisionRecs(recs[pair.a], recs[pair.b])) ...
+//
+// NOTE: Pairs test the bounding boxes with closed intervals, the narrowphase decides
+// NOTE: Objects are indices 0..count-1 of the arrays passed to the updates, a count change
+// keeps the order of the objects that remain
+//----------------------------------------------------------------------------------
+
+#ifndef SWEEPAPI
+#define SWEEPAPI inline
+#endif
+
+// Sentinel boxes after the last one, the vector sweeps read up to 8 past the end
+#define SWEEP_PADDING 8
+
+// Insertion sort moves allowed per box before the update switches to a full sort
+#ifndef SWEEP_MOVE_BUDGET
+#define SWEEP_MOVE_BUDGET 16
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct SweepBox {
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+};
+
+struct SweepPair {
+    int a;                          // Smaller object index
+    int b;
+};
+
+struct SweepAndPrune {
+    int count;
+    std::vector<int> objects;       // Object in each sorted slot
+    std::vector<float> minX;        // Sorted, +inf in the padding
+    std::vector<float> maxX;
+    std::vector<float> minY;
+    std::vector<float> maxY;
+    int moves;                      // Insertion sort moves of the last update
+    bool fullSort;                  // The last update sorted from scratch
+    std::vector<int> order;         // Full sort scratch
+    std::vector<float> floatScratch;
+    std::vector<int> intScratch;
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Update
+//----------------------------------------------------------------------------------
+
+SWEEPAPI SweepAndPrune CreateSweepAndPrune(void)
+{
+    SweepAndPrune sap = {};
+
+    return sap;
+}
+
+// Set the number of objects: objects past the new count leave, new ones are appended
+SWEEPAPI void ResizeSweepAndPrune(SweepAndPrune* sap, int count)
+{
+    if (count == sap->count) return;
+
+    sap->objects.resize(sap->count);
+    if (count < sap->count)
+    {
+        sap->objects.erase(std::remove_if(sap->objects.begin(), sap->objects.end(), [count](int object) { return object >= count; }), sap->objects.end());
+    }
+    else
+    {
+        for (int object = sap->count; object < count; object++) sap->objects.push_back(object);
+    }
+    sap->count = count;
+
+    size_t size = (size_t)count + SWEEP_PADDING;
+    sap->objects.resize(size, -1);
+    sap->minX.resize(size);
+    sap->maxX.resize(size);
+    sap->minY.resize(size);
+    sap->maxY.resize(size);
+    for (size_t k = count; k < size; k++)
+    {
+        sap->minX[k] = INFINITY;
+        sap->maxX[k] = sap->minY[k] = sap->maxY[k] = 0.0f;
+    }
+}
+
+// Reorder every array by 'order' (slot k takes slot order[k])
+SWEEPAPI void PermuteSweepArrays(SweepAndPrune* sap)
+{
+    int count = sap->count;
+    std::vector<float>* arrays[4] = { &sap->minX, &sap->maxX, &sap->minY, &sap->maxY };
+    sap->floatScratch.resize(count);
+    for (std::vector<float>* values : arrays)
+    {
+        for (int k = 0; k < count; k++) sap->floatScratch[k] = (*values)[sap->order[k]];
+        std::copy(sap->floatScratch.begin(), sap->floatScratch.end(), values->begin());
+    }
+
+    sap->intScratch.resize(count);
+    for (int k = 0; k < count; k++) sap->intScratch[k] = sap->objects[sap->order[k]];
+    std::copy(sap->intScratch.begin(), sap->intScratch.end(), sap->objects.begin());
+}
+
+// Restore the order by left edge, insertion sort first
+SWEEPAPI void SortSweepAndPrune(SweepAndPrune* sap)
+{
+    float* minX = sap->minX.data();
+    float* maxX = sap->maxX.data();
+    float* minY = sap->minY.data();
+    float* maxY = sap->maxY.data();
+    int* objects = sap->objects.data();
+    int count = sap->count;
+    long long budget = (long long)SWEEP_MOVE_BUDGET*count;
+    long long moves = 0;
+
+    sap->fullSort = false;
+    for (int k = 1; (k < count) && (moves <= budget); k++)
+    {
+        float key = minX[k];
+        if (minX[k - 1] <= key) continue;
+
+        float right = maxX[k], top = minY[k], bottom = maxY[k];
+        int object = objects[k];
+        int j = k;
+        for (; (j > 0) && (minX[j - 1] > key); j--)
+        {
+            minX[j] = minX[j - 1];
+            maxX[j] = maxX[j - 1];
+            minY[j] = minY[j - 1];
+            maxY[j] = maxY[j - 1];
+            objects[j] = objects[j - 1];
+        }
+        minX[j] = key;
+        maxX[j] = right;
+        minY[j] = top;
+        maxY[j] = bottom;
+        objects[j] = object;
+        moves += k - j;
+    }
+    sap->moves = (int)((moves < 0x7fffffff) ? moves : 0x7fffffff);
+    if (moves <= budget) return;
+
+    // Too far from sorted: sort from scratch
+    sap->fullSort = true;
+    sap->order.resize(count);
+    for (int k = 0; k < count; k++) sap->order[k] = k;
+    std::sort(sap->order.begin(), sap->order.end(), [minX](int a, int b) { return minX[a] < minX[b]; });
+    PermuteSweepArrays(sap);
+}
+
+// Update from 'count' objects, boxOf(object) returns the SweepBox of an object
+template <typename Fn>
+SWEEPAPI void UpdateSweepAndPruneWith(SweepAndPrune* sap, int count, Fn&& boxOf)
+{
+    ResizeSweepAndPrune(sap, count);
+
+    for (int k = 0; k < count; k++)
+    {
+        SweepBox box = boxOf(sap->objects[k]);
+        sap->minX[k] = box.minX;
+        sap->maxX[k] = box.maxX;
+        sap->minY[k] = box.minY;
+        sap->maxY[k] = box.maxY;
+    }
+
+    SortSweepAndPrune(sap);
+}
+
+SWEEPAPI void UpdateSweepAndPrune(SweepAndPrune* sap, const Rectangle* recs, int count)
+{
+    UpdateSweepAndPruneWith(sap, count, [recs](int object) {
+        const Rectangle& rec = recs[object];
+        return SweepBox{ rec.x, rec.y, rec.x + rec.width, rec.y + rec.height };
+    });
+}
+
+SWEEPAPI void UpdateSweepAndPruneCircles(SweepAndPrune* sap, const Vector2* centers, const float* radii, int count)
+{
+    UpdateSweepAndPruneWith(sap, count, [centers, radii](int object) {
+        Vector2 center = centers[object];
+        float radius = radii[object];
+        return SweepBox{ center.x - radius, center.y - radius, center.x + radius, center.y + radius };
+    });
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Sweep kernels
+//----------------------------------------------------------------------------------
+
+SWEEPAPI int SweepLowestBit(unsigned int mask)
+{
+#if defined(_MSC_VER)
+    unsigned long bit;
+    _BitScanForward(&bit, mask);
+    return (int)bit;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+SWEEPAPI void PushSweepPair(std::vector<SweepPair>* pairs, int a, int b)
+{
+    pairs->push_back((a < b) ? SweepPair{ a, b } : SweepPair{ b, a });
+}
+
+SWEEPAPI void FindSweepPairsScalar(const SweepAndPrune* sap, std::vector<SweepPair>* pairs)
+{
+    const float* minX = sap->minX.data();
+    const float* minY = sap->minY.data();
+    const float* maxY = sap->maxY.data();
+
+    for (int i = 0; i < sap->count; i++)
+    {
+        float right = sap->maxX[i], top = minY[i], bottom = maxY[i];
+
+        // The padding's +inf left edge ends every sweep
+        for (int j = i + 1; minX[j] <= right; j++)
+        {
+            if ((minY[j] <= bottom) && (top <= maxY[j])) PushSweepPair(pairs, sap->objects[i], sap->objects[j]);
+        }
+    }
+}
+
+#if SIMD_SSE
+
+SWEEPAPI void FindSweepPairsSSE(const SweepAndPrune* sap, std::vector<SweepPair>* pairs)
+{
+    const float* minX = sap->minX.data();
+    const float* minY = sap->minY.data();
+    const float* maxY = sap->maxY.data();
+
+    for (int i = 0; i < sap->count; i++)
+    {
+        __m128 right = _mm_set1_ps(sap->maxX[i]);
+        __m128 top = _mm_set1_ps(minY[i]);
+        __m128 bottom = _mm_set1_ps(maxY[i]);
+
+        for (int j = i + 1;; j += 4)
+        {
+            __m128 inX = _mm_cmple_ps(_mm_loadu_ps(minX + j), right);
+            int xMask = _mm_movemask_ps(inX);
+            if (xMask == 0) break;
+
+            __m128 inY = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minY + j), bottom), _mm_cmple_ps(top, _mm_loadu_ps(maxY + j)));
+            unsigned int hits = (unsigned int)_mm_movemask_ps(_mm_and_ps(inX, inY));
+            for (; hits; hits &= hits - 1) PushSweepPair(pairs, sap->objects[i], sap->objects[j + SweepLowestBit(hits)]);
+
+            // Sorted: once one lane starts past the right edge, so does everything after it
+            if (xMask != 0xf) break;
+        }
+    }
+}
+
+#endif
+
+#if SIMD_X86
+
+SIMD_TARGET_AVX2 SWEEPAPI void FindSweepPairsAVX2(const SweepAndPrune* sap, std::vector<SweepPair>* pairs)
+{
+    const float* minX = sap->minX.data();
+    const float* minY = sap->minY.data();
+    const float* maxY = sap->maxY.data();
+
+    for (int i = 0; i < sap->count; i++)
+    {
+        __m256 right = _mm256_set1_ps(sap->maxX[i]);
+        __m256 top = _mm256_set1_ps(minY[i]);
+        __m256 bottom = _mm256_set1_ps(maxY[i]);
+
+        for (int j = i + 1;; j += 8)
+        {
+            __m256 inX = _mm256_cmp_ps(_mm256_loadu_ps(minX + j), right, _CMP_LE_OQ);
+            int xMask = _mm256_movemask_ps(inX);
+            if (xMask == 0) break;
+
+            __m256 inY = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minY + j), bottom, _CMP_LE_OQ), _mm256_cmp_ps(top, _mm256_loadu_ps(maxY + j), _CMP_LE_OQ));
+            unsigned int hits = (unsigned int)_mm256_movemask_ps(_mm256_and_ps(inX, inY));
+            for (; hits; hits &= hits - 1) PushSweepPair(pairs, sap->objects[i], sap->objects[j + SweepLowestBit(hits)]);
+
+            if (xMask != 0xff) break;
+        }
+    }
+}
+
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Dispatch (uses GetSimdLevel())
+//----------------------------------------------------------------------------------
+
+// Replace 'pairs' with every pair of objects whose boxes overlap, each pair once
+SWEEPAPI int FindSweepPairs(const SweepAndPrune* sap, std::vector<SweepPair>* pairs)
+{
+    pairs->clear();
+
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { FindSweepPairsAVX2(sap, pairs); return (int)pairs->size(); }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { FindSweepPairsSSE(sap, pairs); return (int)pairs->size(); }
+#endif
+    FindSweepPairsScalar(sap, pairs);
+
+    return (int)pairs->size();
+}
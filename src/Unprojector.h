@@ -0,0 +1,202 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include <cstring>
+
+//----------------------------------------------------------------------------------
+// Cached screen to world unprojection
+//
+// Unproject(source, projection, view) multiplies and inverts view*projection on every
+// call. An Unprojector keeps the inverse and only rebuilds it when the camera changes,
+// so each unproject costs one matrix-vector multiply and a divide
+//
+// Usage:
+//   Unprojector unprojector = CreateUnprojector(camera, GetScreenWidth(), GetScreenHeight());
+//   ...every frame
+//   UpdateUnprojector(&unprojector, camera, GetScreenWidth(), GetScreenHeight());
+//   Ray ray = GetUnprojectorRay(unprojector, GetMousePosition());
+//----------------------------------------------------------------------------------
+
+// Clip planes used by raylib for the camera projection (rlgl RL_CULL_DISTANCE_NEAR/FAR)
+#ifndef UNPROJECTOR_NEAR
+#define UNPROJECTOR_NEAR 0.01
+#endif
+
+#ifndef UNPROJECTOR_FAR
+#define UNPROJECTOR_FAR 1000.0
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct Unprojector {
+    Matrix projection;          // Projection matrix the inverse was built from
+    Matrix view;                // View matrix the inverse was built from
+    Matrix invViewProj;         // Inverse of view*projection
+    Matrix invViewProjT;        // Transposed inverse, stored rows are the matrix columns (SIMD friendly)
+    Camera3D camera;            // Camera the matrices were built from (when created from a camera)
+    int width;                  // Screen size used to map pixels to normalized device coordinates
+    int height;
+} Unprojector;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Rebuild the cached inverse from a projection and view matrix
+RMAPI void RebuildUnprojector(Unprojector* unprojector)
+{
+    unprojector->invViewProj = Invert(Multiply(unprojector->view, unprojector->projection));
+    unprojector->invViewProjT = Transpose(unprojector->invViewProj);
+}
+
+// Create an unprojector from projection and view matrices, pixel coordinates map to a width x height screen
+// NOTE: The projection type is read from the matrix: Ortho() has m11 = 0 and m15 = 1, Perspective() m11 = -1 and m15 = 0
+RMAPI Unprojector CreateUnprojector(Matrix projection, Matrix view, int width, int height)
+{
+    Unprojector result = { 0 };
+
+    result.projection = projection;
+    result.view = view;
+    result.camera.projection = ((projection.m11 == 0.0f) && (projection.m15 == 1.0f)) ? CAMERA_ORTHOGRAPHIC : CAMERA_PERSPECTIVE;
+    result.camera.position = Multiply(Vector3Zero(), Invert(view));
+    result.width = width;
+    result.height = height;
+    RebuildUnprojector(&result);
+
+    return result;
+}
+
+// Get the view and projection matrices raylib uses for a camera (same as GetMouseRay)
+RMAPI void GetCameraMatrices(Camera3D camera, int width, int height, Matrix* projection, Matrix* view)
+{
+    double aspect = (double)width / (double)height;
+
+    *view = LookAt(camera.position, camera.target, camera.up);
+
+    if (camera.projection == CAMERA_ORTHOGRAPHIC)
+    {
+        double top = camera.fovy / 2.0;
+        double right = top * aspect;
+        *projection = Ortho(-right, right, -top, top, UNPROJECTOR_NEAR, UNPROJECTOR_FAR);
+    }
+    else *projection = Perspective(camera.fovy * DEG2RAD, aspect, UNPROJECTOR_NEAR, UNPROJECTOR_FAR);
+}
+
+// Create an unprojector for a camera and screen size
+RMAPI Unprojector CreateUnprojector(Camera3D camera, int width, int height)
+{
+    Unprojector result = { 0 };
+
+    GetCameraMatrices(camera, width, height, &result.projection, &result.view);
+    result.camera = camera;
+    result.width = width;
+    result.height = height;
+    RebuildUnprojector(&result);
+
+    return result;
+}
+
+// Update the unprojector for new matrices, the inverse is only rebuilt when they changed
+// Returns true if the inverse was rebuilt
+RMAPI bool UpdateUnprojector(Unprojector* unprojector, Matrix projection, Matrix view, int width, int height)
+{
+    unprojector->width = width;
+    unprojector->height = height;
+
+    if ((memcmp(&projection, &unprojector->projection, sizeof(Matrix)) == 0) &&
+        (memcmp(&view, &unprojector->view, sizeof(Matrix)) == 0)) return false;
+
+    *unprojector = CreateUnprojector(projection, view, width, height);
+
+    return true;
+}
+
+// Update the unprojector for a camera, the inverse is only rebuilt when the camera or screen size changed
+// Returns true if the inverse was rebuilt
+RMAPI bool UpdateUnprojector(Unprojector* unprojector, Camera3D camera, int width, int height)
+{
+    if ((memcmp(&camera, &unprojector->camera, sizeof(Camera3D)) == 0) &&
+        (width == unprojector->width) && (height == unprojector->height)) return false;
+
+    *unprojector = CreateUnprojector(camera, width, height);
+
+    return true;
+}
+
+// Projects a Vector3 from normalized device coordinates into world space
+// NOTE: Same result as Unproject(source, projection, view), without rebuilding the inverse
+RMAPI Vector3 Unproject(const Unprojector& unprojector, Vector3 source)
+{
+    Vector3 result = { 0 };
+    const Matrix& mat = unprojector.invViewProj;
+
+    float x = mat.m0 * source.x + mat.m4 * source.y + mat.m8 * source.z + mat.m12;
+    float y = mat.m1 * source.x + mat.m5 * source.y + mat.m9 * source.z + mat.m13;
+    float z = mat.m2 * source.x + mat.m6 * source.y + mat.m10 * source.z + mat.m14;
+    float w = mat.m3 * source.x + mat.m7 * source.y + mat.m11 * source.z + mat.m15;
+
+    result.x = x / w;
+    result.y = y / w;
+    result.z = z / w;
+
+    return result;
+}
+
+// Projects an array of Vector3 from normalized device coordinates into world space
+RMAPI void UnprojectBatch(const Unprojector& unprojector, const Vector3* sources, Vector3* out, int count)
+{
+#if MATH_SIMD_SSE
+    const float* cols = &unprojector.invViewProjT.m0;
+    __m128 c0 = _mm_loadu_ps(cols);
+    __m128 c1 = _mm_loadu_ps(cols + 4);
+    __m128 c2 = _mm_loadu_ps(cols + 8);
+    __m128 c3 = _mm_loadu_ps(cols + 12);
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 s = sources[i];
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(s.x)), _mm_mul_ps(c1, _mm_set1_ps(s.y))),
+            _mm_mul_ps(c2, _mm_set1_ps(s.z))), c3);
+        r = _mm_div_ps(r, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
+
+        float v[4];
+        _mm_storeu_ps(v, r);
+        out[i] = Vector3{ v[0], v[1], v[2] };
+    }
+#else
+    for (int i = 0; i < count; i++) out[i] = Unproject(unprojector, sources[i]);
+#endif
+}
+
+// Convert a screen position in pixels to normalized device coordinates
+RMAPI Vector2 ScreenToNdc(const Unprojector& unprojector, Vector2 position)
+{
+    Vector2 result = { (2.0f * position.x) / (float)unprojector.width - 1.0f, 1.0f - (2.0f * position.y) / (float)unprojector.height };
+
+    return result;
+}
+
+// Get a world space ray through a screen position in pixels (same as GetMouseRay for camera unprojectors)
+RMAPI Ray GetUnprojectorRay(const Unprojector& unprojector, Vector2 position)
+{
+    Ray ray = { 0 };
+
+    Vector2 ndc = ScreenToNdc(unprojector, position);
+    Vector3 nearPoint = Unproject(unprojector, Vector3{ ndc.x, ndc.y, 0.0f });
+    Vector3 farPoint = Unproject(unprojector, Vector3{ ndc.x, ndc.y, 1.0f });
+
+    ray.direction = Normalize(Subtract(farPoint, nearPoint));
+
+    // Perspective rays start at the eye, orthographic rays on the camera plane
+    if (unprojector.camera.projection == CAMERA_ORTHOGRAPHIC) ray.position = Unproject(unprojector, Vector3{ ndc.x, ndc.y, -1.0f });
+    else ray.position = unprojector.camera.position;
+
+    return ray;
+}
+
+// Get world space rays through an array of screen positions in pixels
+RMAPI void GetUnprojectorRays(const Unprojector& unprojector, const Vector2* positions, Ray* rays, int count)
+{
+    for (int i = 0; i < count; i++) rays[i] = GetUnprojectorRay(unprojector, positions[i]);
+}
@@ -0,0 +1,359 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include "Simd.h"
+
+//----------------------------------------------------------------------------------
+// Dimension generic vectors
+//
+// Vec<N, T> holds N components of float, double, int32_t or int16_t and implements the
+// element-wise operations once for every size and type. The Vector2/Vector3/Vector4
+// overloads in Math.h forward here, so double precision world math and integer tile
+// math share the same code paths as the raylib types
+//
+// Operations live in VecOps<N, T>, the 4-wide float case is specialized with SSE.
+// Everything is constexpr, the SSE specialization falls back to the generic code
+// during constant evaluation
+//
+// Usage:
+//   Vec2i tile = Add(Vec2i{ { 3, 4 } }, 1);
+//   Vec3d world = Lerp(a, b, 0.25);
+//   Vector3 v = ToVector3(Scale(ToVec(position), 2.0f));
+//----------------------------------------------------------------------------------
+
+#ifndef VECAPI
+#define VECAPI inline
+#endif
+
+// Define MATH_DISABLE_SIMD to force the scalar implementations of the Matrix and Vec functions
+#if SIMD_SSE && !defined(MATH_DISABLE_SIMD)
+#define MATH_SIMD_SSE 1
+#else
+#define MATH_SIMD_SSE 0
+#endif
+
+// Functions with an SSE path switch to their scalar reference during constant evaluation,
+// that needs __builtin_is_constant_evaluated() (GCC 9, Clang 9, MSVC 19.25)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define MATH_HAS_CONSTANT_EVALUATED
+#endif
+#endif
+#if !defined(MATH_HAS_CONSTANT_EVALUATED) && !defined(__clang__) && \
+    ((defined(__GNUC__) && (__GNUC__ >= 9)) || (defined(_MSC_VER) && (_MSC_VER >= 1925)))
+#define MATH_HAS_CONSTANT_EVALUATED
+#endif
+
+#if defined(MATH_HAS_CONSTANT_EVALUATED)
+#define MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define MATH_IS_CONSTANT_EVALUATED() false
+#endif
+
+// SSE specialization of VecOps<4, float>, only where it can stay constexpr
+#if MATH_SIMD_SSE && defined(MATH_HAS_CONSTANT_EVALUATED)
+#define VEC_SIMD_SSE 1
+#else
+#define VEC_SIMD_SSE 0
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+template <int N, typename T>
+struct Vec {
+    static_assert(N >= 1, "Vec needs at least one component");
+
+    typedef T Scalar;
+    typedef typename std::conditional<std::is_same<T, double>::value, double, float>::type Real;   // Interpolation amounts
+
+    T v[N];
+};
+
+typedef Vec<2, float> Vec2f;
+typedef Vec<3, float> Vec3f;
+typedef Vec<4, float> Vec4f;
+typedef Vec<2, double> Vec2d;
+typedef Vec<3, double> Vec3d;
+typedef Vec<4, double> Vec4d;
+typedef Vec<2, int32_t> Vec2i;
+typedef Vec<3, int32_t> Vec3i;
+typedef Vec<4, int32_t> Vec4i;
+typedef Vec<2, int16_t> Vec2s;
+typedef Vec<3, int16_t> Vec3s;
+typedef Vec<4, int16_t> Vec4s;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Generic implementation
+//----------------------------------------------------------------------------------
+
+// Element-wise operations, one loop for every size and type
+// NOTE: Results are cast back to T, int16_t arithmetic wraps like the raw integer type would
+template <int N, typename T>
+struct VecScalarOps {
+    typedef Vec<N, T> V;
+    typedef typename V::Real Real;
+
+    static constexpr V Add(V a, V b)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] + b.v[i]);
+        return result;
+    }
+
+    static constexpr V Add(V a, T add)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] + add);
+        return result;
+    }
+
+    static constexpr V Subtract(V a, V b)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] - b.v[i]);
+        return result;
+    }
+
+    static constexpr V Subtract(V a, T sub)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] - sub);
+        return result;
+    }
+
+    static constexpr V Multiply(V a, V b)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] * b.v[i]);
+        return result;
+    }
+
+    static constexpr V Divide(V a, V b)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] / b.v[i]);
+        return result;
+    }
+
+    static constexpr V Scale(V a, T scale)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] * scale);
+        return result;
+    }
+
+    static constexpr V Negate(V a)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(-a.v[i]);
+        return result;
+    }
+
+    static constexpr V Lerp(V a, V b, Real amount)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (T)(a.v[i] + amount * (b.v[i] - a.v[i]));
+        return result;
+    }
+
+    static constexpr V Min(V a, V b)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (a.v[i] < b.v[i]) ? a.v[i] : b.v[i];
+        return result;
+    }
+
+    static constexpr V Max(V a, V b)
+    {
+        V result = {};
+        for (int i = 0; i < N; i++) result.v[i] = (a.v[i] > b.v[i]) ? a.v[i] : b.v[i];
+        return result;
+    }
+
+    // Sums left to right, the same order as the hand written Vector2/Vector3 Dot
+    static constexpr T Dot(V a, V b)
+    {
+        T result = (T)(a.v[0] * b.v[0]);
+        for (int i = 1; i < N; i++) result = (T)(result + a.v[i] * b.v[i]);
+        return result;
+    }
+};
+
+// Operations used by the free functions, specialized per size and type where SIMD pays off
+template <int N, typename T>
+struct VecOps : VecScalarOps<N, T> {};
+
+#if VEC_SIMD_SSE
+// 4-wide float: one SSE instruction per operation
+// NOTE: Same operations in the same order as the generic code, results are bit identical
+template <>
+struct VecOps<4, float> : VecScalarOps<4, float> {
+    typedef Vec<4, float> V;
+    typedef VecScalarOps<4, float> Scalar;
+
+    static __m128 Load(const V& a) { return _mm_loadu_ps(a.v); }
+    static V Store(__m128 x) { V result = {}; _mm_storeu_ps(result.v, x); return result; }
+
+    static constexpr V Add(V a, V b)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Add(a, b);
+        return Store(_mm_add_ps(Load(a), Load(b)));
+    }
+
+    static constexpr V Add(V a, float add)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Add(a, add);
+        return Store(_mm_add_ps(Load(a), _mm_set1_ps(add)));
+    }
+
+    static constexpr V Subtract(V a, V b)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Subtract(a, b);
+        return Store(_mm_sub_ps(Load(a), Load(b)));
+    }
+
+    static constexpr V Subtract(V a, float sub)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Subtract(a, sub);
+        return Store(_mm_sub_ps(Load(a), _mm_set1_ps(sub)));
+    }
+
+    static constexpr V Multiply(V a, V b)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Multiply(a, b);
+        return Store(_mm_mul_ps(Load(a), Load(b)));
+    }
+
+    static constexpr V Divide(V a, V b)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Divide(a, b);
+        return Store(_mm_div_ps(Load(a), Load(b)));
+    }
+
+    static constexpr V Scale(V a, float scale)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Scale(a, scale);
+        return Store(_mm_mul_ps(Load(a), _mm_set1_ps(scale)));
+    }
+
+    static constexpr V Negate(V a)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Negate(a);
+        return Store(_mm_xor_ps(Load(a), _mm_set1_ps(-0.0f)));
+    }
+
+    static constexpr V Lerp(V a, V b, float amount)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Lerp(a, b, amount);
+        __m128 va = Load(a);
+        return Store(_mm_add_ps(va, _mm_mul_ps(_mm_set1_ps(amount), _mm_sub_ps(Load(b), va))));
+    }
+
+    // Operand order matches the generic compare-select: min returns b unless a < b
+    static constexpr V Min(V a, V b)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Min(a, b);
+        return Store(_mm_min_ps(Load(a), Load(b)));
+    }
+
+    static constexpr V Max(V a, V b)
+    {
+        if (MATH_IS_CONSTANT_EVALUATED()) return Scalar::Max(a, b);
+        return Store(_mm_max_ps(Load(a), Load(b)));
+    }
+};
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vec functions and operators
+//----------------------------------------------------------------------------------
+
+// Add two vectors (a + b)
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Add(Vec<N, T> a, Vec<N, T> b) { return VecOps<N, T>::Add(a, b); }
+
+// Add value to every component
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Add(Vec<N, T> a, typename Vec<N, T>::Scalar add) { return VecOps<N, T>::Add(a, add); }
+
+// Subtract two vectors (a - b)
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Subtract(Vec<N, T> a, Vec<N, T> b) { return VecOps<N, T>::Subtract(a, b); }
+
+// Subtract value from every component
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Subtract(Vec<N, T> a, typename Vec<N, T>::Scalar sub) { return VecOps<N, T>::Subtract(a, sub); }
+
+// Multiply vector by vector, component-wise
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Multiply(Vec<N, T> a, Vec<N, T> b) { return VecOps<N, T>::Multiply(a, b); }
+
+// Divide vector by vector, component-wise
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Divide(Vec<N, T> a, Vec<N, T> b) { return VecOps<N, T>::Divide(a, b); }
+
+// Multiply every component by value
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Scale(Vec<N, T> a, typename Vec<N, T>::Scalar scale) { return VecOps<N, T>::Scale(a, scale); }
+
+// Negate every component
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Negate(Vec<N, T> a) { return VecOps<N, T>::Negate(a); }
+
+// Calculate linear interpolation between two vectors
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Lerp(Vec<N, T> a, Vec<N, T> b, typename Vec<N, T>::Real amount) { return VecOps<N, T>::Lerp(a, b, amount); }
+
+// Get min value for each pair of components
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Min(Vec<N, T> a, Vec<N, T> b) { return VecOps<N, T>::Min(a, b); }
+
+// Get max value for each pair of components
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> Max(Vec<N, T> a, Vec<N, T> b) { return VecOps<N, T>::Max(a, b); }
+
+// Calculate two vectors dot product
+template <int N, typename T>
+VECAPI constexpr T Dot(Vec<N, T> a, Vec<N, T> b) { return VecOps<N, T>::Dot(a, b); }
+
+// Calculate vector square length
+template <int N, typename T>
+VECAPI constexpr T LengthSqr(Vec<N, T> a) { return VecOps<N, T>::Dot(a, a); }
+
+// Calculate square distance between two vectors
+template <int N, typename T>
+VECAPI constexpr T DistanceSqr(Vec<N, T> a, Vec<N, T> b)
+{
+    Vec<N, T> d = VecOps<N, T>::Subtract(a, b);
+    return VecOps<N, T>::Dot(d, d);
+}
+
+// Check whether two vectors are exactly equal
+template <int N, typename T>
+VECAPI constexpr bool operator==(const Vec<N, T>& a, const Vec<N, T>& b)
+{
+    for (int i = 0; i < N; i++) if (a.v[i] != b.v[i]) return false;
+    return true;
+}
+
+template <int N, typename T>
+VECAPI constexpr bool operator!=(const Vec<N, T>& a, const Vec<N, T>& b) { return !(a == b); }
+
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> operator+(const Vec<N, T>& a, const Vec<N, T>& b) { return Add(a, b); }
+
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> operator-(const Vec<N, T>& a, const Vec<N, T>& b) { return Subtract(a, b); }
+
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> operator*(const Vec<N, T>& a, const Vec<N, T>& b) { return Multiply(a, b); }
+
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> operator/(const Vec<N, T>& a, const Vec<N, T>& b) { return Divide(a, b); }
+
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> operator*(const Vec<N, T>& a, typename Vec<N, T>::Scalar b) { return Scale(a, b); }
+
+template <int N, typename T>
+VECAPI constexpr Vec<N, T> operator-(const Vec<N, T>& a) { return Negate(a); }
@@ -0,0 +1,253 @@
+#pragma once
+#include "Math.h"
+
+//----------------------------------------------------------------------------------
+// Register resident Vector4/Quaternion
+//
+// Vector4Simd wraps one __m128, so it is 16-byte aligned and lives in an XMM register
+// between calls. Chains such as Normalize(Multiply(q1, q2)) compile to register to register
+// shuffles and arithmetic, the raylib structs are only loaded and stored at the ends
+//
+// Same conventions as the Math.h Quaternion functions: QuaternionSimd is a typedef of
+// Vector4Simd and Multiply() is the quaternion product. Results match Math.h within float
+// rounding (the SSE horizontal sums add in a different order)
+//
+// Usage:
+//   QuaternionSimd q = Normalize(Multiply(ToSimd(parent), ToSimd(local)));
+//   bone.rotation = ToQuaternion(q);
+//
+// NOTE: Not constexpr, build tables with the Math.h functions and convert
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct alignas(16) Vector4Simd {
+#if MATH_SIMD_SSE
+    __m128 v;                   // x, y, z, w in lanes 0..3
+#else
+    Vector4 v;
+#endif
+} Vector4Simd;
+
+typedef Vector4Simd QuaternionSimd;
+
+#if MATH_SIMD_SSE
+#define VECTOR4_SWIZZLE(v, x, y, z, w) _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x))
+
+// Dot product broadcast to all lanes, lanes add as (x + z) + (y + w)
+RMAPI __m128 Vector4SimdDot(__m128 a, __m128 b)
+{
+    __m128 m = _mm_mul_ps(a, b);
+    __m128 s = _mm_add_ps(m, _mm_movehl_ps(m, m));
+    return _mm_add_ps(VECTOR4_SWIZZLE(s, 0, 0, 0, 0), VECTOR4_SWIZZLE(s, 1, 1, 1, 1));
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Conversion
+//----------------------------------------------------------------------------------
+
+// Load a raylib Vector4/Quaternion
+RMAPI Vector4Simd ToSimd(Vector4 v)
+{
+    Vector4Simd result;
+#if MATH_SIMD_SSE
+    result.v = _mm_loadu_ps(&v.x);
+#else
+    result.v = v;
+#endif
+
+    return result;
+}
+
+// Store back to a raylib Vector4
+RMAPI Vector4 ToVector4(Vector4Simd v)
+{
+#if MATH_SIMD_SSE
+    Vector4 result = { 0 };
+    _mm_storeu_ps(&result.x, v.v);
+
+    return result;
+#else
+    return v.v;
+#endif
+}
+
+// Store back to a raylib Quaternion
+RMAPI Quaternion ToQuaternion(QuaternionSimd q)
+{
+    return ToVector4(q);
+}
+
+// Get identity quaternion
+RMAPI QuaternionSimd QuaternionSimdIdentity(void)
+{
+    QuaternionSimd result;
+#if MATH_SIMD_SSE
+    result.v = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+#else
+    result.v = QuaternionIdentity();
+#endif
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector4Simd/QuaternionSimd math
+//----------------------------------------------------------------------------------
+
+// Add two vectors
+RMAPI Vector4Simd Add(Vector4Simd a, Vector4Simd b)
+{
+    Vector4Simd result;
+#if MATH_SIMD_SSE
+    result.v = _mm_add_ps(a.v, b.v);
+#else
+    result.v = Add(a.v, b.v);
+#endif
+
+    return result;
+}
+
+// Subtract two vectors (a - b)
+RMAPI Vector4Simd Subtract(Vector4Simd a, Vector4Simd b)
+{
+    Vector4Simd result;
+#if MATH_SIMD_SSE
+    result.v = _mm_sub_ps(a.v, b.v);
+#else
+    result.v = Subtract(a.v, b.v);
+#endif
+
+    return result;
+}
+
+// Scale vector by float value
+RMAPI Vector4Simd Scale(Vector4Simd a, float scale)
+{
+    Vector4Simd result;
+#if MATH_SIMD_SSE
+    result.v = _mm_mul_ps(a.v, _mm_set1_ps(scale));
+#else
+    result.v = Scale(a.v, scale);
+#endif
+
+    return result;
+}
+
+// Calculate two vectors dot product
+RMAPI float Dot(Vector4Simd a, Vector4Simd b)
+{
+#if MATH_SIMD_SSE
+    return _mm_cvtss_f32(Vector4SimdDot(a.v, b.v));
+#else
+    return a.v.x * b.v.x + a.v.y * b.v.y + a.v.z * b.v.z + a.v.w * b.v.w;
+#endif
+}
+
+// Computes the length of a quaternion
+RMAPI float Length(Vector4Simd a)
+{
+#if MATH_SIMD_SSE
+    return _mm_cvtss_f32(_mm_sqrt_ss(Vector4SimdDot(a.v, a.v)));
+#else
+    return Length(a.v);
+#endif
+}
+
+// Normalize provided quaternion, zero length is left unchanged like Normalize(Quaternion)
+RMAPI Vector4Simd Normalize(Vector4Simd a)
+{
+    Vector4Simd result;
+#if MATH_SIMD_SSE
+    __m128 length = _mm_sqrt_ps(Vector4SimdDot(a.v, a.v));
+    __m128 one = _mm_set1_ps(1.0f);
+    length = _mm_or_ps(_mm_and_ps(_mm_cmpeq_ps(length, _mm_setzero_ps()), one), length);
+    result.v = _mm_mul_ps(a.v, _mm_div_ps(one, length));
+#else
+    result.v = Normalize(a.v);
+#endif
+
+    return result;
+}
+
+// Invert provided quaternion
+RMAPI QuaternionSimd Invert(QuaternionSimd q)
+{
+    QuaternionSimd result;
+#if MATH_SIMD_SSE
+    __m128 lengthSq = Vector4SimdDot(q.v, q.v);
+    __m128 invLength = _mm_div_ps(_mm_setr_ps(-1.0f, -1.0f, -1.0f, 1.0f), lengthSq);
+    __m128 nonZero = _mm_cmpneq_ps(lengthSq, _mm_setzero_ps());
+    __m128 inverted = _mm_mul_ps(q.v, invLength);
+    result.v = _mm_or_ps(_mm_and_ps(nonZero, inverted), _mm_andnot_ps(nonZero, q.v));
+#else
+    result.v = Invert(q.v);
+#endif
+
+    return result;
+}
+
+// Calculate two quaternion multiplication
+RMAPI QuaternionSimd Multiply(QuaternionSimd q1, QuaternionSimd q2)
+{
+    QuaternionSimd result;
+#if MATH_SIMD_SSE
+    // Each lane of q1 scales a signed permutation of q2, summed as a tree to shorten the dependency chain
+    __m128 a = q1.v;
+    __m128 b = q2.v;
+    __m128 rw = _mm_mul_ps(VECTOR4_SWIZZLE(a, 3, 3, 3, 3), b);
+    __m128 rx = _mm_mul_ps(VECTOR4_SWIZZLE(a, 0, 0, 0, 0), _mm_xor_ps(VECTOR4_SWIZZLE(b, 3, 2, 1, 0), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+    __m128 ry = _mm_mul_ps(VECTOR4_SWIZZLE(a, 1, 1, 1, 1), _mm_xor_ps(VECTOR4_SWIZZLE(b, 2, 3, 0, 1), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f)));
+    __m128 rz = _mm_mul_ps(VECTOR4_SWIZZLE(a, 2, 2, 2, 2), _mm_xor_ps(VECTOR4_SWIZZLE(b, 1, 0, 3, 2), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+    __m128 r = _mm_add_ps(_mm_add_ps(rw, rx), _mm_add_ps(ry, rz));
+    result.v = r;
+#else
+    result.v = Multiply(q1.v, q2.v);
+#endif
+
+    return result;
+}
+
+// Calculate linear interpolation between two quaternions
+RMAPI Vector4Simd Lerp(Vector4Simd a, Vector4Simd b, float amount)
+{
+    Vector4Simd result;
+#if MATH_SIMD_SSE
+    result.v = _mm_add_ps(a.v, _mm_mul_ps(_mm_set1_ps(amount), _mm_sub_ps(b.v, a.v)));
+#else
+    result.v = Lerp(a.v, b.v, amount);
+#endif
+
+    return result;
+}
+
+// Calculate slerp-optimized interpolation between two quaternions
+RMAPI QuaternionSimd Nlerp(QuaternionSimd q1, QuaternionSimd q2, float amount)
+{
+    return Normalize(Lerp(q1, q2, amount));
+}
+
+// Transform a vector by quaternion rotation, v + 2w(q x v) + 2(q x (q x v)) with the w lane ignored
+// NOTE: q must be normalized
+RMAPI Vector3 Rotate(Vector3 v, QuaternionSimd q)
+{
+#if MATH_SIMD_SSE
+    __m128 p = _mm_setr_ps(v.x, v.y, v.z, 0.0f);
+    __m128 t = _mm_sub_ps(_mm_mul_ps(VECTOR4_SWIZZLE(q.v, 1, 2, 0, 3), VECTOR4_SWIZZLE(p, 2, 0, 1, 3)),
+        _mm_mul_ps(VECTOR4_SWIZZLE(q.v, 2, 0, 1, 3), VECTOR4_SWIZZLE(p, 1, 2, 0, 3)));
+    t = _mm_add_ps(t, t);
+    __m128 c = _mm_sub_ps(_mm_mul_ps(VECTOR4_SWIZZLE(q.v, 1, 2, 0, 3), VECTOR4_SWIZZLE(t, 2, 0, 1, 3)),
+        _mm_mul_ps(VECTOR4_SWIZZLE(q.v, 2, 0, 1, 3), VECTOR4_SWIZZLE(t, 1, 2, 0, 3)));
+    __m128 r = _mm_add_ps(_mm_add_ps(p, _mm_mul_ps(VECTOR4_SWIZZLE(q.v, 3, 3, 3, 3), t)), c);
+
+    alignas(16) float out[4];
+    _mm_store_ps(out, r);
+    Vector3 result = { out[0], out[1], out[2] };
+
+    return result;
+#else
+    return Rotate(v, q.v);
+#endif
+}
@@ -0,0 +1,383 @@
+#pragma once
+#include "Math.h"
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Lazily evaluated Vector2/Vector3 arrays
+//
+// Vector2Array and Vector3Array store their components as SoA float arrays. The usual
+// operators build an expression tree instead of a result, nothing runs until the tree is
+// assigned to an array. Assignment evaluates the whole expression in one pass, 8 (AVX2) or
+// 4 (SSE) elements at a time, without allocating temporary arrays:
+//
+//   Vector3Array pos(count), vel(count), acc(count);
+//   pos = pos + vel*dt + acc*(0.5f*dt*dt);     // one loop, no temporaries
+//   vel += acc*dt;
+//
+// Operands can be arrays, sub-expressions, Vector2/Vector3 values and floats. Every lane is
+// computed with the same operations, in the same order, as the Math.h operators, so the
+// results are identical to a hand written loop over Vector3 values
+//
+// NOTE: All operations are component-wise, so the destination may appear on the right side
+// NOTE: Arrays of different sizes evaluate over the smallest one
+// NOTE: Expressions keep pointers into the arrays, evaluate them before resizing an operand
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+template <int N> struct VectorArrayTraits;
+template <> struct VectorArrayTraits<2> { typedef Vector2 Vector; };
+template <> struct VectorArrayTraits<3> { typedef Vector3 Vector; };
+
+// Base of every expression node, E implements:
+//   int Size() const                   number of elements, -1 for broadcast values
+//   float Get(int c, int i) const      component c of element i
+//   __m128 Get4(int c, int i) const    component c of elements i..i+3 (SSE)
+//   __m256 Get8(int c, int i) const    component c of elements i..i+7 (AVX2)
+template <int N, typename E>
+struct VectorExpr {
+    const E& Self() const { return static_cast<const E&>(*this); }
+};
+
+// Owning SoA array of N-component vectors
+template <int N>
+struct VectorArray : VectorExpr<N, VectorArray<N>> {
+    typedef typename VectorArrayTraits<N>::Vector Vector;
+
+    std::vector<float> c[N];            // Component arrays: x, y (, z)
+
+    VectorArray() = default;
+    explicit VectorArray(int count) { Resize(count); }
+    VectorArray(const Vector* values, int count) { Resize(count); for (int i = 0; i < count; i++) Set(i, values[i]); }
+
+    template <typename E>
+    VectorArray(const VectorExpr<N, E>& e) { Assign(e.Self()); }
+
+    int Size() const { return (int)c[0].size(); }
+    void Resize(int count) { for (int k = 0; k < N; k++) c[k].resize(count); }
+
+    float* Data(int component) { return c[component].data(); }
+    const float* Data(int component) const { return c[component].data(); }
+
+    Vector Get(int i) const
+    {
+        Vector result = { 0 };
+        for (int k = 0; k < N; k++) (&result.x)[k] = c[k][i];
+        return result;
+    }
+
+    void Set(int i, Vector v) { for (int k = 0; k < N; k++) c[k][i] = (&v.x)[k]; }
+
+    // Copy to an AoS array of 'Size()' vectors
+    void Store(Vector* out) const { for (int i = 0; i < Size(); i++) out[i] = Get(i); }
+
+    // Evaluate an expression into this array, resized to the expression size
+    template <typename E>
+    VectorArray& operator=(const VectorExpr<N, E>& e) { Assign(e.Self()); return *this; }
+
+    template <typename E>
+    VectorArray& operator+=(const VectorExpr<N, E>& e);
+    template <typename E>
+    VectorArray& operator-=(const VectorExpr<N, E>& e);
+    VectorArray& operator*=(float scale);
+    VectorArray& operator/=(float scale);
+
+    template <typename E>
+    void Assign(const E& e);
+};
+
+typedef VectorArray<2> Vector2Array;
+typedef VectorArray<3> Vector3Array;
+
+// Non-owning leaf referencing the components of a VectorArray
+template <int N>
+struct VectorArrayRef : VectorExpr<N, VectorArrayRef<N>> {
+    const float* c[N];
+    int count;
+
+    VectorArrayRef(const VectorArray<N>& a) : count(a.Size()) { for (int k = 0; k < N; k++) c[k] = a.Data(k); }
+
+    int Size() const { return count; }
+    float Get(int k, int i) const { return c[k][i]; }
+#if SIMD_SSE
+    __m128 Get4(int k, int i) const { return _mm_loadu_ps(c[k] + i); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 __m256 Get8(int k, int i) const { return _mm256_loadu_ps(c[k] + i); }
+#endif
+};
+
+// Vector2/Vector3 value broadcast to every element
+template <int N>
+struct VectorConstant : VectorExpr<N, VectorConstant<N>> {
+    float v[N];
+
+    VectorConstant(typename VectorArrayTraits<N>::Vector value) { for (int k = 0; k < N; k++) v[k] = (&value.x)[k]; }
+
+    int Size() const { return -1; }
+    float Get(int k, int) const { return v[k]; }
+#if SIMD_SSE
+    __m128 Get4(int k, int) const { return _mm_set1_ps(v[k]); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 __m256 Get8(int k, int) const { return _mm256_set1_ps(v[k]); }
+#endif
+};
+
+// Float broadcast to every component of every element
+template <int N>
+struct VectorScalar : VectorExpr<N, VectorScalar<N>> {
+    float v;
+
+    VectorScalar(float value) : v(value) {}
+
+    int Size() const { return -1; }
+    float Get(int, int) const { return v; }
+#if SIMD_SSE
+    __m128 Get4(int, int) const { return _mm_set1_ps(v); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 __m256 Get8(int, int) const { return _mm256_set1_ps(v); }
+#endif
+};
+
+// Expression nodes store their operands by value, arrays are replaced by a VectorArrayRef
+template <typename E> struct VectorExprNode { typedef E Type; };
+template <int N> struct VectorExprNode<VectorArray<N>> { typedef VectorArrayRef<N> Type; };
+
+// Element-wise operations
+struct VectorAddOp {
+    static float Apply(float a, float b) { return a + b; }
+#if SIMD_SSE
+    static __m128 Apply(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 static __m256 Apply(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+#endif
+};
+
+struct VectorSubtractOp {
+    static float Apply(float a, float b) { return a - b; }
+#if SIMD_SSE
+    static __m128 Apply(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 static __m256 Apply(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+#endif
+};
+
+struct VectorMultiplyOp {
+    static float Apply(float a, float b) { return a*b; }
+#if SIMD_SSE
+    static __m128 Apply(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 static __m256 Apply(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+#endif
+};
+
+struct VectorDivideOp {
+    static float Apply(float a, float b) { return a/b; }
+#if SIMD_SSE
+    static __m128 Apply(__m128 a, __m128 b) { return _mm_div_ps(a, b); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 static __m256 Apply(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+#endif
+};
+
+template <int N, typename Op, typename L, typename R>
+struct VectorBinaryExpr : VectorExpr<N, VectorBinaryExpr<N, Op, L, R>> {
+    L a;
+    R b;
+
+    VectorBinaryExpr(const L& a, const R& b) : a(a), b(b) {}
+
+    int Size() const
+    {
+        int sa = a.Size();
+        int sb = b.Size();
+        return (sa < 0) ? sb : (sb < 0) ? sa : (sa < sb) ? sa : sb;
+    }
+
+    float Get(int k, int i) const { return Op::Apply(a.Get(k, i), b.Get(k, i)); }
+#if SIMD_SSE
+    __m128 Get4(int k, int i) const { return Op::Apply(a.Get4(k, i), b.Get4(k, i)); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 __m256 Get8(int k, int i) const { return Op::Apply(a.Get8(k, i), b.Get8(k, i)); }
+#endif
+};
+
+template <int N, typename E>
+struct VectorNegateExpr : VectorExpr<N, VectorNegateExpr<N, E>> {
+    E a;
+
+    VectorNegateExpr(const E& a) : a(a) {}
+
+    int Size() const { return a.Size(); }
+    float Get(int k, int i) const { return -a.Get(k, i); }
+#if SIMD_SSE
+    __m128 Get4(int k, int i) const { return _mm_xor_ps(a.Get4(k, i), _mm_set1_ps(-0.0f)); }
+#endif
+#if SIMD_X86
+    SIMD_TARGET_AVX2 __m256 Get8(int k, int i) const { return _mm256_xor_ps(a.Get8(k, i), _mm256_set1_ps(-0.0f)); }
+#endif
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Evaluation
+//----------------------------------------------------------------------------------
+
+template <int N, typename E>
+RMAPI void EvaluateScalar(float* const* out, const E& expr, int begin, int count)
+{
+    E e = expr;     // Local copy: stores to out cannot alias its broadcast values, they stay in registers
+
+    for (int i = begin; i < count; i++)
+    {
+        for (int k = 0; k < N; k++) out[k][i] = e.Get(k, i);
+    }
+}
+
+#if SIMD_SSE
+template <int N, typename E>
+RMAPI void EvaluateSSE(float* const* out, const E& expr, int count)
+{
+    E e = expr;     // Local copy: stores to out cannot alias its broadcast values, they stay in registers
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        for (int k = 0; k < N; k++) _mm_storeu_ps(out[k] + i, e.Get4(k, i));
+    }
+    EvaluateScalar<N>(out, e, i, count);
+}
+#endif
+
+#if SIMD_X86
+template <int N, typename E>
+SIMD_TARGET_AVX2 RMAPI void EvaluateAVX2(float* const* out, const E& expr, int count)
+{
+    E e = expr;     // Local copy: stores to out cannot alias its broadcast values, they stay in registers
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        for (int k = 0; k < N; k++) _mm256_storeu_ps(out[k] + i, e.Get8(k, i));
+    }
+    EvaluateScalar<N>(out, e, i, count);
+}
+#endif
+
+// Evaluate 'count' elements of an expression into SoA component arrays
+// NOTE: Every lane of a given component is read before it is written, so out may alias the operands
+template <int N, typename E>
+RMAPI void Evaluate(float* const* out, const E& e, int count)
+{
+#if SIMD_X86
+    if (GetSimdLevel() == SIMD_LEVEL_AVX2) { EvaluateAVX2<N>(out, e, count); return; }
+#endif
+#if SIMD_SSE
+    if (GetSimdLevel() == SIMD_LEVEL_SSE) { EvaluateSSE<N>(out, e, count); return; }
+#endif
+    EvaluateScalar<N>(out, e, 0, count);
+}
+
+template <int N>
+template <typename E>
+void VectorArray<N>::Assign(const E& e)
+{
+    // The expression holds its own pointers, resizing only reallocates when the destination is not an operand
+    typename VectorExprNode<E>::Type node(e);
+    int count = node.Size();
+    if (count < 0) count = Size();
+    Resize(count);
+
+    float* out[N];
+    for (int k = 0; k < N; k++) out[k] = c[k].data();
+    Evaluate<N>(out, node, count);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Operators
+//----------------------------------------------------------------------------------
+
+template <int N, typename Op, typename L, typename R>
+RMAPI VectorBinaryExpr<N, Op, typename VectorExprNode<L>::Type, typename VectorExprNode<R>::Type> MakeVectorExpr(const L& a, const R& b)
+{
+    return VectorBinaryExpr<N, Op, typename VectorExprNode<L>::Type, typename VectorExprNode<R>::Type>(a, b);
+}
+
+// Array (or expression) with array (or expression), element by element
+template <int N, typename L, typename R>
+RMAPI auto operator+(const VectorExpr<N, L>& a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorAddOp>(a.Self(), b.Self()); }
+
+template <int N, typename L, typename R>
+RMAPI auto operator-(const VectorExpr<N, L>& a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorSubtractOp>(a.Self(), b.Self()); }
+
+template <int N, typename L, typename R>
+RMAPI auto operator*(const VectorExpr<N, L>& a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorMultiplyOp>(a.Self(), b.Self()); }
+
+template <int N, typename L, typename R>
+RMAPI auto operator/(const VectorExpr<N, L>& a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorDivideOp>(a.Self(), b.Self()); }
+
+// Array with one Vector2/Vector3 value
+template <int N, typename L>
+RMAPI auto operator+(const VectorExpr<N, L>& a, typename VectorArrayTraits<N>::Vector b) { return MakeVectorExpr<N, VectorAddOp>(a.Self(), VectorConstant<N>(b)); }
+
+template <int N, typename L>
+RMAPI auto operator-(const VectorExpr<N, L>& a, typename VectorArrayTraits<N>::Vector b) { return MakeVectorExpr<N, VectorSubtractOp>(a.Self(), VectorConstant<N>(b)); }
+
+template <int N, typename L>
+RMAPI auto operator*(const VectorExpr<N, L>& a, typename VectorArrayTraits<N>::Vector b) { return MakeVectorExpr<N, VectorMultiplyOp>(a.Self(), VectorConstant<N>(b)); }
+
+template <int N, typename L>
+RMAPI auto operator/(const VectorExpr<N, L>& a, typename VectorArrayTraits<N>::Vector b) { return MakeVectorExpr<N, VectorDivideOp>(a.Self(), VectorConstant<N>(b)); }
+
+template <int N, typename R>
+RMAPI auto operator+(typename VectorArrayTraits<N>::Vector a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorAddOp>(VectorConstant<N>(a), b.Self()); }
+
+template <int N, typename R>
+RMAPI auto operator-(typename VectorArrayTraits<N>::Vector a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorSubtractOp>(VectorConstant<N>(a), b.Self()); }
+
+template <int N, typename R>
+RMAPI auto operator*(typename VectorArrayTraits<N>::Vector a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorMultiplyOp>(VectorConstant<N>(a), b.Self()); }
+
+// Array with a float applied to every component, as the Vector2/Vector3 operators in Math.h
+template <int N, typename L>
+RMAPI auto operator+(const VectorExpr<N, L>& a, float b) { return MakeVectorExpr<N, VectorAddOp>(a.Self(), VectorScalar<N>(b)); }
+
+template <int N, typename L>
+RMAPI auto operator-(const VectorExpr<N, L>& a, float b) { return MakeVectorExpr<N, VectorSubtractOp>(a.Self(), VectorScalar<N>(b)); }
+
+template <int N, typename L>
+RMAPI auto operator*(const VectorExpr<N, L>& a, float b) { return MakeVectorExpr<N, VectorMultiplyOp>(a.Self(), VectorScalar<N>(b)); }
+
+template <int N, typename R>
+RMAPI auto operator*(float a, const VectorExpr<N, R>& b) { return MakeVectorExpr<N, VectorMultiplyOp>(b.Self(), VectorScalar<N>(a)); }
+
+// NOTE: Multiplies by 1/b like operator/(Vector3, float)
+template <int N, typename L>
+RMAPI auto operator/(const VectorExpr<N, L>& a, float b) { return MakeVectorExpr<N, VectorMultiplyOp>(a.Self(), VectorScalar<N>(1.0f/b)); }
+
+template <int N, typename E>
+RMAPI VectorNegateExpr<N, typename VectorExprNode<E>::Type> operator-(const VectorExpr<N, E>& a)
+{
+    return VectorNegateExpr<N, typename VectorExprNode<E>::Type>(a.Self());
+}
+
+template <int N>
+template <typename E>
+VectorArray<N>& VectorArray<N>::operator+=(const VectorExpr<N, E>& e) { Assign(*this + e); return *this; }
+
+template <int N>
+template <typename E>
+VectorArray<N>& VectorArray<N>::operator-=(const VectorExpr<N, E>& e) { Assign(*this - e); return *this; }
+
+template <int N>
+VectorArray<N>& VectorArray<N>::operator*=(float scale) { Assign(*this*scale); return *this; }
+
+template <int N>
+VectorArray<N>& VectorArray<N>::operator/=(float scale) { Assign(*this/scale); return *this; }
@@ -1,18 +1,54 @@
 #include "raylib.h"
 #include "Math.h"
+#include "Game.h"
+#include "Headless.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    InitWindow(800, 800, "Game");
-    SetTargetFPS(60);
+    static Game game;
+    HeadlessOptions options = ParseHeadlessOptions(argc, argv);
+    JobSystem* jobs = CreateJobSystem(options.threadCount);
+    InitGame(&game, options.ballCount, options.seed, jobs);
+
+#if defined(GAME_HEADLESS)
+    options.enabled = true;
+#endif
+    if (options.enabled)
+    {
+        PrintHeadlessResult(game, options, RunHeadless(&game, options));
+        DestroyJobSystem(jobs);
+        return 0;
+    }
+
+#if !defined(GAME_HEADLESS)
+    // Rendering follows the display refresh, the simulation ticks at GAME_TICKS_PER_SECOND regardless
+    SetConfigFlags(FLAG_VSYNC_HINT);
+    InitWindow(GAME_SCREEN_SIZE, GAME_SCREEN_SIZE, "Game");
+
+    DrawList list = {};
+    FrameArena frame = CreateFrameArena(0);
     while (!WindowShouldClose())
     {
+        // Ticks fan out the ball updates over the job system and are done before drawing
+        StepGame(&game, GetTime());
+
+        ClearDrawList(&list);
+        DrawGame(game, &list, &frame);
+
         BeginDrawing();
         ClearBackground(RAYWHITE);
+        ReplayDrawList(list);
         DrawText("Hello World!", 10, 10, 20, GRAY);
+        DrawFPS(10, 40);
         EndDrawing();
+
+        // Per-frame scratch memory (DrawGame's HUD text) is released here
+        EndFrameArena(&frame);
     }
 
+    DestroyFrameArena(&frame);
     CloseWindow();
+    DestroyJobSystem(jobs);
+#endif
     return 0;
 }